@@ -23,8 +23,11 @@
 
 #include "MathLib/Curve/CreatePiecewiseLinearCurve.h"
 #include "MathLib/InterpolationAlgorithms/PiecewiseLinearInterpolation.h"
+#include "MeshLib/ElementStatus.h"
 #include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/SpaceFillingCurveReordering.h"
 
+#include "NumLib/DOF/DOFReordering.h"
 #include "NumLib/ODESolver/ConvergenceCriterion.h"
 #include "ProcessLib/CreateJacobianAssembler.h"
 
@@ -80,13 +83,26 @@ ProjectData::ProjectData(BaseLib::ConfigTree const& project_config,
         std::string const mesh_file = BaseLib::copyPathToFileName(
             mesh_param.getValue<std::string>(), project_directory);
 
-        MeshLib::Mesh* const mesh = MeshLib::IO::readMeshFromFile(mesh_file);
+        MeshLib::Mesh* mesh = MeshLib::IO::readMeshFromFile(mesh_file);
         if (!mesh)
         {
             OGS_FATAL("Could not read mesh from \'%s\' file. No mesh added.",
                       mesh_file.c_str());
         }
 
+        if (auto const reordering =
+                //! \ogs_file_attr{prj__mesh__reordering}
+            mesh_param.getConfigAttributeOptional<std::string>("reordering"))
+        {
+            INFO("Reordering the mesh along a %s curve.",
+                 reordering->c_str());
+            std::unique_ptr<MeshLib::Mesh> const original_mesh(mesh);
+            mesh = MeshLib::reorderMeshAlongSpaceFillingCurve(
+                       *original_mesh,
+                       MeshLib::convertStringToSpaceFillingCurve(*reordering))
+                       .release();
+        }
+
         if (auto const axially_symmetric =
                 //! \ogs_file_attr{prj__mesh__axially_symmetric}
             mesh_param.getConfigAttributeOptional<bool>("axially_symmetric"))
@@ -496,6 +512,45 @@ void ProjectData::parseProcesses(BaseLib::ConfigTree const& processes_config,
             OGS_FATAL("Unknown process type: %s", type.c_str());
         }
 
+        //! \ogs_file_param{prj__processes__process__dof_reordering}
+        if (auto const dof_reordering =
+                process_config.getConfigParameterOptional<std::string>(
+                    "dof_reordering"))
+        {
+            process->setDOFReordering(
+                NumLib::convertStringToDOFReordering(*dof_reordering));
+        }
+
+        if (auto const inactive_material_ids =
+                //! \ogs_file_param{prj__processes__process__inactive_material_ids}
+                process_config.getConfigParameterOptional<std::vector<int>>(
+                    "inactive_material_ids"))
+        {
+            if (!_mesh_vec[0]->getProperties().existsPropertyVector<int>(
+                    "MaterialIDs"))
+            {
+                OGS_FATAL(
+                    "Inactive material ids are given for process '%s', but "
+                    "the mesh has no MaterialIDs.",
+                    name.c_str());
+            }
+            process->setElementStatus(std::make_unique<MeshLib::ElementStatus>(
+                _mesh_vec[0], *inactive_material_ids));
+        }
+
+        //! \ogs_file_param{prj__processes__process__assemble_once}
+        if (process_config.getConfigParameter<bool>("assemble_once", false))
+        {
+            if (!process->isLinear())
+            {
+                OGS_FATAL(
+                    "The process '%s' is nonlinear and cannot be assembled "
+                    "only once.",
+                    name.c_str());
+            }
+            process->setAssembleOnce(true);
+        }
+
         BaseLib::insertIfKeyUniqueElseError(_processes,
                                             name,
                                             std::move(process),
@@ -10,7 +10,10 @@
  *
  */
 
+#include <algorithm>
 #include <chrono>
+#include <vector>
+
 #include <tclap/CmdLine.h>
 
 #ifdef USE_PETSC
@@ -142,9 +145,25 @@ int main(int argc, char *argv[])
 #endif
 
             INFO("Initialize processes.");
+            std::vector<ProcessLib::Process const*> initialized_processes;
             for (auto& p : project.getProcesses())
             {
+                // Processes with identical DOF layouts, e.g. in staggered
+                // coupling, share their DOF tables and sparsity patterns.
+                auto const dof_table_source = std::find_if(
+                    initialized_processes.begin(), initialized_processes.end(),
+                    [&p](ProcessLib::Process const* other) {
+                        return p.second->canShareDOFTableWith(*other);
+                    });
+                if (dof_table_source != initialized_processes.end())
+                {
+                    INFO("Process %s reuses the DOF table of another process.",
+                         p.first.c_str());
+                    p.second->setDOFTableSource(**dof_table_source);
+                }
+
                 p.second->initialize();
+                initialized_processes.push_back(p.second.get());
             }
 
             // Check intermediately that config parsing went fine.
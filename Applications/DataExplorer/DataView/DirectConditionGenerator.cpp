@@ -36,7 +36,7 @@ DirectConditionGenerator::directToSurfaceNodes(const MeshLib::Mesh& mesh,
     if (_direct_values.empty())
     {
         GeoLib::Raster* raster(
-            FileIO::AsciiRasterInterface::readRaster(filename));
+            FileIO::AsciiRasterInterface::getRasterUsingCacheFile(filename));
         if (!raster)
         {
             ERR("Error in DirectConditionGenerator::directToSurfaceNodes() - "
@@ -77,7 +77,7 @@ const std::vector< std::pair<std::size_t,double> >& DirectConditionGenerator::di
     }
 
     std::unique_ptr<GeoLib::Raster> raster(
-        FileIO::AsciiRasterInterface::readRaster(filename));
+        FileIO::AsciiRasterInterface::getRasterUsingCacheFile(filename));
     if (!raster) {
         ERR("Error in DirectConditionGenerator::directWithSurfaceIntegration()"
             "- could not load raster file.");
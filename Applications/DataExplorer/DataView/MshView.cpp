@@ -164,7 +164,8 @@ void MshView::openMap2dMeshDialog()
     if (dlg.useRasterMapping())
     {
         std::unique_ptr<GeoLib::Raster> raster{
-            FileIO::AsciiRasterInterface::readRaster(dlg.getRasterPath())};
+            FileIO::AsciiRasterInterface::getRasterUsingCacheFile(
+                dlg.getRasterPath())};
         if (!raster)
         {
             OGSError::box(QString::fromStdString(
@@ -46,10 +46,10 @@ vtkImageAlgorithm* VtkRaster::loadImage(const std::string &fileName,
 
 
     std::unique_ptr<GeoLib::Raster> raster(nullptr);
-    if (fileInfo.suffix().toLower() == "asc")
-        raster.reset(FileIO::AsciiRasterInterface::getRasterFromASCFile(fileName));
-    else if (fileInfo.suffix().toLower() == "grd")
-        raster.reset(FileIO::AsciiRasterInterface::getRasterFromSurferFile(fileName));
+    if (fileInfo.suffix().toLower() == "asc" ||
+        fileInfo.suffix().toLower() == "grd")
+        raster.reset(
+            FileIO::AsciiRasterInterface::getRasterUsingCacheFile(fileName));
     if (raster)
         return VtkRaster::loadImageFromArray(raster->begin(), raster->getHeader());
     if ((fileInfo.suffix().toLower() == "tif") ||
@@ -818,10 +818,12 @@ void MainWindow::mapGeometry(const std::string &geo_name)
     {
         if (fi.suffix().toLower() == "asc" || fi.suffix().toLower() == "grd")
         {
-            std::unique_ptr<GeoLib::Raster> raster (
-                FileIO::AsciiRasterInterface::getRasterFromASCFile(file_name.toStdString()));
+            std::unique_ptr<GeoLib::Raster> raster(
+                FileIO::AsciiRasterInterface::getRasterUsingCacheFile(
+                    file_name.toStdString()));
+            // The geo mapper takes the ownership of the raster.
             if (raster)
-                geo_mapper.mapOnDEM(raster.get());
+                geo_mapper.mapOnDEM(raster.release());
             else
                 OGSError::box("Error reading raster file.");
             _geo_model->updateGeometry(geo_name);
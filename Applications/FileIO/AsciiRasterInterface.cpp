@@ -13,14 +13,177 @@
 
 #include "AsciiRasterInterface.h"
 
+#include <algorithm>
+#include <cctype>
+#include <cstdlib>
+
+#include <sys/stat.h>
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 #include <logog/include/logog.hpp>
 #include <boost/optional.hpp>
 
 #include "BaseLib/FileTools.h"
 #include "BaseLib/StringTools.h"
 
+#include "GeoLib/IO/RasterCacheFile.h"
 #include "GeoLib/Raster.h"
 
+namespace
+{
+bool isWhitespace(char const c)
+{
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+/// Parses the whitespace separated values in [begin, end), where end points
+/// to a whitespace or the terminating null character. Tokens that are not a
+/// number are read as zero.
+void parseValues(char const* const begin, char const* const end,
+                 std::vector<double>& values)
+{
+    char const* p = begin;
+    while (true)
+    {
+        while (p < end && isWhitespace(*p))
+            ++p;
+        if (p >= end)
+            return;
+
+        char* q;
+        double const value = std::strtod(p, &q);
+        if (q == p)
+        {
+            while (q < end && !isWhitespace(*q))
+                ++q;
+        }
+        values.push_back(q == p ? 0.0 : value);
+        p = q;
+    }
+}
+
+/// Parses the values in the buffer, which ends with a whitespace or the end of
+/// the data. The buffer is split into parts which are parsed in parallel.
+std::vector<double> parseValues(std::string const& buffer)
+{
+    std::size_t number_of_parts = 1;
+#ifdef _OPENMP
+    number_of_parts = omp_get_max_threads();
+#endif
+    std::vector<std::size_t> part_begins{0};
+    for (std::size_t k(1); k < number_of_parts; ++k)
+    {
+        auto const pos = buffer.find_first_of(
+            " \t\r\n", std::max(part_begins.back(),
+                                 buffer.size() * k / number_of_parts));
+        if (pos == std::string::npos)
+            break;
+        part_begins.push_back(pos);
+    }
+    part_begins.push_back(buffer.size());
+
+    std::vector<std::vector<double>> parts(part_begins.size() - 1);
+    auto const n_parts = static_cast<long>(parts.size());
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (long k = 0; k < n_parts; ++k)
+        parseValues(buffer.data() + part_begins[k],
+                    buffer.data() + part_begins[k + 1], parts[k]);
+
+    std::vector<double> values;
+    for (auto& part : parts)
+        values.insert(values.end(), part.begin(), part.end());
+    return values;
+}
+
+/// Reads up to \c n whitespace separated values from the stream in chunks
+/// and calls f(first, values) for each chunk, where \c first is the index of
+/// the first value of the chunk. A comma is accepted as decimal separator.
+/// Returns the number of values read.
+template <typename F>
+std::size_t readValuesInChunks(std::istream& in, std::size_t const n, F&& f)
+{
+    // The chunk size is limited by the size of the remaining stream.
+    auto const position = in.tellg();
+    in.seekg(0, std::ios::end);
+    auto const remaining = static_cast<std::size_t>(in.tellg() - position);
+    in.seekg(position);
+    std::size_t const chunk_size =
+        std::min(std::size_t{1} << 26, remaining + 1);
+
+    std::string buffer;
+    std::string carry;
+    std::size_t count = 0;
+    while (count < n && in)
+    {
+        buffer.swap(carry);
+        auto const offset = buffer.size();
+        buffer.resize(offset + chunk_size);
+        in.read(&buffer[offset], chunk_size);
+        buffer.resize(offset + static_cast<std::size_t>(in.gcount()));
+        carry.clear();
+
+        // Keep a possibly incomplete last value for the next chunk.
+        if (in)
+        {
+            auto const pos = buffer.find_last_of(" \t\r\n");
+            if (pos == std::string::npos)
+            {
+                carry.swap(buffer);
+                continue;
+            }
+            carry.assign(buffer, pos + 1, std::string::npos);
+            buffer.resize(pos + 1);
+        }
+
+        std::replace(buffer.begin(), buffer.end(), ',', '.');
+        auto values = parseValues(buffer);
+        values.resize(std::min(values.size(), n - count));
+        if (values.empty())
+            continue;
+        f(count, values);
+        count += values.size();
+    }
+    return count;
+}
+
+/// Splits the consecutive values beginning at the index \c first into parts
+/// belonging to a single raster row and calls f(row, col, values, n) for each.
+template <typename F>
+void forEachRowPart(std::size_t const first, std::vector<double> const& values,
+                    std::size_t const n_cols, F&& f)
+{
+    std::size_t k = 0;
+    while (k < values.size())
+    {
+        std::size_t const row = (first + k) / n_cols;
+        std::size_t const col = (first + k) % n_cols;
+        std::size_t const n = std::min(n_cols - col, values.size() - k);
+        f(row, col, values.data() + k, n);
+        k += n;
+    }
+}
+
+/// Returns the size and the modification time of the given file, which
+/// identify the raster file a cache file was created from.
+GeoLib::IO::RasterCacheSource getRasterCacheSource(std::string const& fname)
+{
+    GeoLib::IO::RasterCacheSource source;
+    struct stat buffer;
+    if (stat(fname.c_str(), &buffer) == 0)
+    {
+        source.size = static_cast<std::uint64_t>(buffer.st_size);
+        source.modification_time =
+            static_cast<std::int64_t>(buffer.st_mtime);
+    }
+    return source;
+}
+}  // namespace
+
 namespace FileIO
 {
 
@@ -47,27 +210,50 @@ GeoLib::Raster* AsciiRasterInterface::getRasterFromASCFile(std::string const& fn
     // header information
     GeoLib::RasterHeader header;
     if (readASCHeader(in, header)) {
-        auto* values = new double[header.n_cols * header.n_rows];
-        std::string s;
-        // read the data into the double-array
-        for (std::size_t j(0); j < header.n_rows; ++j) {
-            const std::size_t idx ((header.n_rows - j - 1) * header.n_cols);
-            for (std::size_t i(0); i < header.n_cols; ++i) {
-                in >> s;
-                values[idx + i] = strtod(
-                    BaseLib::replaceString(",", ".", s).c_str(), nullptr);
-            }
-        }
+        std::vector<double> values(header.n_cols * header.n_rows);
+        readASCValues(in, header,
+                      [&values](std::size_t const index,
+                                double const* const v, std::size_t const n) {
+                          std::copy(v, v + n, values.begin() + index);
+                      });
         in.close();
-        GeoLib::Raster *raster(new GeoLib::Raster(header, values, values+header.n_cols*header.n_rows));
-        delete [] values;
-        return raster;
+        return new GeoLib::Raster(header, values.begin(), values.end());
     }
     WARN("Raster::getRasterFromASCFile(): Could not read header of file %s",
          fname.c_str());
     return nullptr;
 }
 
+void AsciiRasterInterface::readASCValues(std::ifstream& in,
+                                         GeoLib::RasterHeader const& header,
+                                         ValueWriter const& write_values)
+{
+    // The rows of an asc-file are given from top to bottom.
+    auto const n_cols = header.n_cols;
+    auto const n_rows = header.n_rows;
+    auto const write_rows = [&](std::size_t const first,
+                                std::vector<double> const& values) {
+        forEachRowPart(first, values, n_cols,
+                       [&](std::size_t const row, std::size_t const col,
+                           double const* const v, std::size_t const n) {
+                           write_values((n_rows - row - 1) * n_cols + col, v,
+                                        n);
+                       });
+    };
+
+    std::size_t const n_values = n_cols * n_rows;
+    std::size_t const count = readValuesInChunks(in, n_values, write_rows);
+    if (count < n_values)
+    {
+        WARN(
+            "AsciiRasterInterface::readASCValues(): Found only %d of %d "
+            "values, the remaining values are set to no data.",
+            count, n_values);
+        write_rows(count,
+                   std::vector<double>(n_values - count, header.no_data));
+    }
+}
+
 bool AsciiRasterInterface::readASCHeader(std::ifstream &in, GeoLib::RasterHeader &header)
 {
     std::string tag, value;
@@ -137,31 +323,47 @@ GeoLib::Raster* AsciiRasterInterface::getRasterFromSurferFile(std::string const&
 
     if (readSurferHeader(in, header, min, max))
     {
-        const double no_data_val (min-1);
-        auto* values = new double[header.n_cols * header.n_rows];
-        std::string s;
-        // read the data into the double-array
-        for (std::size_t j(0); j < header.n_rows; ++j)
-        {
-            const std::size_t idx (j * header.n_cols);
-            for (std::size_t i(0); i < header.n_cols; ++i)
-            {
-                in >> s;
-                const double val(strtod(
-                    BaseLib::replaceString(",", ".", s).c_str(), nullptr));
-                values[idx+i] = (val > max || val < min) ? no_data_val : val;
-            }
-        }
+        std::vector<double> values(header.n_cols * header.n_rows);
+        readSurferValues(in, header, min, max,
+                         [&values](std::size_t const index,
+                                   double const* const v, std::size_t const n) {
+                             std::copy(v, v + n, values.begin() + index);
+                         });
         in.close();
-        GeoLib::Raster *raster(new GeoLib::Raster(header, values, values+header.n_cols*header.n_rows));
-        delete [] values;
-        return raster;
+        return new GeoLib::Raster(header, values.begin(), values.end());
     }
     ERR("Raster::getRasterFromASCFile() - could not read header of file %s",
         fname.c_str());
     return nullptr;
 }
 
+void AsciiRasterInterface::readSurferValues(std::ifstream& in,
+                                            GeoLib::RasterHeader const& header,
+                                            double const min, double const max,
+                                            ValueWriter const& write_values)
+{
+    // The rows of a grd-file are given from bottom to top.
+    auto const no_data = header.no_data;
+    auto const write = [&](std::size_t const first,
+                           std::vector<double>& values) {
+        for (auto& v : values)
+            v = (v > max || v < min) ? no_data : v;
+        write_values(first, values.data(), values.size());
+    };
+
+    std::size_t const n_values = header.n_cols * header.n_rows;
+    std::size_t const count = readValuesInChunks(in, n_values, write);
+    if (count < n_values)
+    {
+        WARN(
+            "AsciiRasterInterface::readSurferValues(): Found only %d of %d "
+            "values, the remaining values are set to no data.",
+            count, n_values);
+        std::vector<double> missing(n_values - count, no_data);
+        write(count, missing);
+    }
+}
+
 bool AsciiRasterInterface::readSurferHeader(
     std::ifstream &in, GeoLib::RasterHeader &header, double &min, double &max)
 {
@@ -227,6 +429,75 @@ void AsciiRasterInterface::writeRasterAsASC(GeoLib::Raster const& raster, std::s
     out.close();
 }
 
+bool AsciiRasterInterface::createRasterCacheFile(std::string const& fname,
+                                                 std::string const& cache_fname)
+{
+    std::string ext (BaseLib::getFileExtension(fname));
+    std::transform(ext.begin(), ext.end(), ext.begin(), tolower);
+    if (ext != "asc" && ext != "grd")
+    {
+        ERR("AsciiRasterInterface::createRasterCacheFile(): Unknown raster "
+            "format of file %s.", fname.c_str());
+        return false;
+    }
+
+    std::ifstream in(fname.c_str());
+    if (!in.is_open()) {
+        ERR("AsciiRasterInterface::createRasterCacheFile(): Could not open "
+            "file %s.", fname.c_str());
+        return false;
+    }
+
+    GeoLib::RasterHeader header;
+    double min(0.0), max(0.0);
+    if (!(ext == "asc" ? readASCHeader(in, header)
+                       : readSurferHeader(in, header, min, max)))
+    {
+        ERR("AsciiRasterInterface::createRasterCacheFile(): Could not read "
+            "header of file %s.", fname.c_str());
+        return false;
+    }
+
+    GeoLib::IO::RasterCacheFileWriter writer(cache_fname, header,
+                                             getRasterCacheSource(fname));
+    auto const write_values = [&writer](std::size_t const index,
+                                        double const* const values,
+                                        std::size_t const n) {
+        writer.write(index, values, n);
+    };
+    if (ext == "asc")
+        readASCValues(in, header, write_values);
+    else
+        readSurferValues(in, header, min, max, write_values);
+
+    if (!writer.good())
+    {
+        ERR("AsciiRasterInterface::createRasterCacheFile(): Could not write "
+            "file %s.", cache_fname.c_str());
+        return false;
+    }
+    return true;
+}
+
+GeoLib::Raster* AsciiRasterInterface::getRasterUsingCacheFile(
+    std::string const& fname)
+{
+    std::string const cache_fname(fname + ".ogsraster");
+
+    GeoLib::RasterHeader header;
+    GeoLib::IO::RasterCacheSource source;
+    if (!GeoLib::IO::readRasterCacheFileHeader(cache_fname, header, source) ||
+        source != getRasterCacheSource(fname))
+    {
+        INFO("Creating raster cache file %s.", cache_fname.c_str());
+        if (!createRasterCacheFile(fname, cache_fname))
+        {
+            WARN("Reading raster file %s into memory instead.", fname.c_str());
+            return readRaster(fname);
+        }
+    }
+    return GeoLib::Raster::createFromCacheFile(cache_fname);
+}
 
 /// Checks if all raster files actually exist
 static bool allRastersExist(std::vector<std::string> const& raster_paths)
@@ -241,14 +512,17 @@ static bool allRastersExist(std::vector<std::string> const& raster_paths)
 }
 
 boost::optional<std::vector<GeoLib::Raster const*>> readRasters(
-    std::vector<std::string> const& raster_paths)
+    std::vector<std::string> const& raster_paths, bool const use_cache_files)
 {
     if (!allRastersExist(raster_paths)) return boost::none;
 
     std::vector<GeoLib::Raster const*> rasters;
     rasters.reserve(raster_paths.size());
     for (auto const& path : raster_paths)
-        rasters.push_back(FileIO::AsciiRasterInterface::readRaster(path));
+        rasters.push_back(
+            use_cache_files
+                ? FileIO::AsciiRasterInterface::getRasterUsingCacheFile(path)
+                : FileIO::AsciiRasterInterface::readRaster(path));
     return boost::make_optional(rasters);
 }
 } // end namespace FileIO
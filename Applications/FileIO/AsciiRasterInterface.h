@@ -14,6 +14,7 @@
 #pragma once
 
 #include <fstream>
+#include <functional>
 #include <vector>
 #include <string>
 #include <boost/optional.hpp>
@@ -26,6 +27,11 @@ namespace FileIO
  * Interface for reading and writing a number of ASCII raster formats.
  * Currently supported are reading and writing of Esri asc-files and
  * reading of Surfer grd-files.
+ *
+ * The raster values are parsed in large chunks, each of which is split into
+ * parts that are parsed in parallel if OpenMP is enabled. Rasters exceeding the
+ * main memory can be converted into a raster cache file once, which then is
+ * mapped into memory, see getRasterUsingCacheFile().
  */
 class AsciiRasterInterface {
 public:
@@ -41,8 +47,39 @@ public:
     /// Writes an Esri asc-file
     static void writeRasterAsASC(GeoLib::Raster const& raster, std::string const& file_name);
 
+    /// Converts the asc- or grd-file into a raster cache file, see
+    /// GeoLib::IO::RasterCacheFileWriter, without holding the raster in
+    /// memory. Returns false on error.
+    static bool createRasterCacheFile(std::string const& fname,
+                                      std::string const& cache_fname);
+
+    /// Returns the raster mapped from the cache file belonging to the given
+    /// asc- or grd-file, which is named like the raster file with the
+    /// additional extension ".ogsraster". The cache file is created if it does
+    /// not exist or if the size or the modification time of the raster file
+    /// differ from the ones stored in the cache file. If the cache file cannot
+    /// be written, e.g. in a read-only directory, the raster is read into
+    /// memory by readRaster().
+    static GeoLib::Raster* getRasterUsingCacheFile(std::string const& fname);
 
 private:
+    /// Receives \c n consecutive raster values beginning at position
+    /// \c index in the order of GeoLib::Raster::begin().
+    using ValueWriter = std::function<void(
+        std::size_t index, double const* values, std::size_t n)>;
+
+    /// Reads the values of an Esri asc-file following the header.
+    static void readASCValues(std::ifstream& in,
+                              GeoLib::RasterHeader const& header,
+                              ValueWriter const& write_values);
+
+    /// Reads the values of a Surfer grd-file following the header. Values
+    /// outside [min, max] are replaced by the no data value.
+    static void readSurferValues(std::ifstream& in,
+                                 GeoLib::RasterHeader const& header,
+                                 double min, double max,
+                                 ValueWriter const& write_values);
+
     /// Reads the header of a Esri asc-file.
     static bool readASCHeader(std::ifstream &in, GeoLib::RasterHeader &header);
 
@@ -53,6 +90,9 @@ private:
 
 /// Reads a vector of rasters given by file names. On error nothing is returned,
 /// otherwise the returned vector contains pointers to the read rasters.
+/// If \c use_cache_files is set, the rasters are mapped from cache files, see
+/// AsciiRasterInterface::getRasterUsingCacheFile().
 boost::optional<std::vector<GeoLib::Raster const*>> readRasters(
-    std::vector<std::string> const& raster_paths);
+    std::vector<std::string> const& raster_paths,
+    bool use_cache_files = false);
 } // end namespace FileIO
@@ -0,0 +1,68 @@
+/**
+ * @file BIN2VTK.cpp
+ * @brief Converts a mesh in the binary OGS mesh format into a VTK mesh.
+ *
+ * @copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+
+#include "MeshLib/IO/BinaryIO/BinaryMeshReader.h"
+#include "MeshLib/IO/VtkIO/VtuInterface.h"
+#include "MeshLib/Mesh.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Converts a mesh in the binary OGS mesh format (ogsmesh) into a VTK "
+        "mesh.",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::string> mesh_in(
+        "i", "mesh-input-file",
+        "the name of the file containing the input mesh", true, "",
+        "file name of input mesh");
+    cmd.add(mesh_in);
+    TCLAP::ValueArg<std::string> mesh_out(
+        "o", "mesh-output-file",
+        "the name of the file the mesh will be written to", true, "",
+        "file name of output mesh");
+    cmd.add(mesh_out);
+    TCLAP::MultiArg<std::string> property_names(
+        "p", "property",
+        "name of a property to be converted; all properties are converted if "
+        "none is given",
+        false, "property name");
+    cmd.add(property_names);
+    cmd.parse(argc, argv);
+
+    MeshLib::IO::BinaryMeshReader const reader(mesh_in.getValue());
+    if (!reader.good())
+        return EXIT_FAILURE;
+
+    std::unique_ptr<MeshLib::Mesh const> mesh(
+        property_names.getValue().empty()
+            ? reader.readMesh()
+            : reader.readMesh(property_names.getValue()));
+    if (!mesh)
+        return EXIT_FAILURE;
+    INFO("Mesh read: %d nodes, %d elements.", mesh->getNumberOfNodes(),
+         mesh->getNumberOfElements());
+
+    MeshLib::IO::VtuInterface vtu(mesh.get());
+    if (!vtu.writeToFile(mesh_out.getValue()))
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
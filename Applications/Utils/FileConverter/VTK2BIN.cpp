@@ -0,0 +1,58 @@
+/**
+ * @file VTK2BIN.cpp
+ * @brief Converts a mesh into the binary OGS mesh format.
+ *
+ * @copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ */
+
+#include <memory>
+#include <string>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+
+#include "MeshLib/IO/BinaryIO/BinaryMeshWriter.h"
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/Mesh.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Converts a mesh (vtu or msh) into the binary OGS mesh format "
+        "(ogsmesh).",
+        ' ', "0.1");
+    TCLAP::ValueArg<std::string> mesh_in(
+        "i", "mesh-input-file",
+        "the name of the file containing the input mesh", true, "",
+        "file name of input mesh");
+    cmd.add(mesh_in);
+    TCLAP::ValueArg<std::string> mesh_out(
+        "o", "mesh-output-file",
+        "the name of the file the mesh will be written to", true, "",
+        "file name of output mesh");
+    cmd.add(mesh_out);
+    TCLAP::SwitchArg compress_arg("c", "compress",
+                                  "compress the sections using zlib");
+    cmd.add(compress_arg);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh const> mesh(
+        MeshLib::IO::readMeshFromFile(mesh_in.getValue()));
+    if (!mesh)
+        return EXIT_FAILURE;
+    INFO("Mesh read: %d nodes, %d elements.", mesh->getNumberOfNodes(),
+         mesh->getNumberOfElements());
+
+    if (!MeshLib::IO::writeBinaryMesh(*mesh, mesh_out.getValue(),
+                                      compress_arg.getValue()))
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
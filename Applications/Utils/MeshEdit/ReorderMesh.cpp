@@ -0,0 +1,67 @@
+/**
+ * @copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/LICENSE.txt
+ *
+ */
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <tclap/CmdLine.h>
+
+#include "Applications/ApplicationsLib/LogogSetup.h"
+
+#include "BaseLib/BuildInfo.h"
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/SpaceFillingCurveReordering.h"
+
+#include "MeshLib/IO/readMeshFromFile.h"
+#include "MeshLib/IO/writeMeshToFile.h"
+
+int main(int argc, char* argv[])
+{
+    ApplicationsLib::LogogSetup logog_setup;
+
+    TCLAP::CmdLine cmd(
+        "Reorders the nodes and elements of a mesh along a space-filling "
+        "curve to improve the memory locality of element loops. All node and "
+        "cell properties are reordered accordingly.",
+        ' ', BaseLib::BuildInfo::git_describe);
+    TCLAP::ValueArg<std::string> input_arg("i", "input-mesh-file",
+                                           "input mesh file", true, "",
+                                           "string");
+    cmd.add(input_arg);
+    TCLAP::ValueArg<std::string> output_arg("o", "output-mesh-file",
+                                            "output mesh file", true, "",
+                                            "string");
+    cmd.add(output_arg);
+    std::vector<std::string> curves{"hilbert", "morton"};
+    TCLAP::ValuesConstraint<std::string> allowed_curves(curves);
+    TCLAP::ValueArg<std::string> curve_arg(
+        "c", "curve", "the space-filling curve (default: hilbert)", false,
+        "hilbert", &allowed_curves);
+    cmd.add(curve_arg);
+    cmd.parse(argc, argv);
+
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::IO::readMeshFromFile(input_arg.getValue()));
+    if (!mesh)
+        return EXIT_FAILURE;
+    INFO("Mesh read: %d nodes, %d elements.", mesh->getNumberOfNodes(),
+         mesh->getNumberOfElements());
+
+    INFO("Reordering along the %s curve...", curve_arg.getValue().c_str());
+    auto const reordered_mesh = MeshLib::reorderMeshAlongSpaceFillingCurve(
+        *mesh, MeshLib::convertStringToSpaceFillingCurve(curve_arg.getValue()));
+
+    if (MeshLib::IO::writeMeshToFile(*reordered_mesh, output_arg.getValue()) !=
+        0)
+        return EXIT_FAILURE;
+
+    return EXIT_SUCCESS;
+}
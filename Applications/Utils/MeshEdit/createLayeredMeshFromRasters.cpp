@@ -85,6 +85,12 @@ int main (int argc, char* argv[])
         false, min_thickness, "minimum layer thickness");
     cmd.add(min_thickness_arg);
 
+    TCLAP::SwitchArg cache_arg("c", "cache-rasters",
+        "Convert the rasters once into binary cache files (raster file name "
+        "with the extension .ogsraster), which are mapped into memory. This "
+        "allows the use of rasters exceeding the main memory.", false);
+    cmd.add(cache_arg);
+
     cmd.parse(argc, argv);
 
     if (min_thickness_arg.isSet())
@@ -114,7 +120,7 @@ int main (int argc, char* argv[])
         return EXIT_FAILURE;
 
     MeshLib::MeshLayerMapper mapper;
-    if (auto rasters = FileIO::readRasters(raster_paths))
+    if (auto rasters = FileIO::readRasters(raster_paths, cache_arg.getValue()))
     {
         if (!mapper.createLayers(*sfc_mesh, *rasters, min_thickness))
             return EXIT_FAILURE;
@@ -14,12 +14,15 @@
 
 #include "NodeWiseMeshPartitioner.h"
 
+#include <algorithm>
 #include <limits>
 #include <iomanip>
 #include <cstdio>  // for binary output
+#include <future>
 #include <numeric>
 
 #include <logog/include/logog.hpp>
+#include <metis.h>
 
 #include "BaseLib/Error.h"
 
@@ -82,84 +85,170 @@ void NodeWiseMeshPartitioner::readMetisData(const std::string& file_name_base)
     std::remove(fname_eparts.c_str());
 }
 
-void NodeWiseMeshPartitioner::findNonGhostNodesInPartition(
-    std::size_t const part_id,
+void NodeWiseMeshPartitioner::computeNodePartitionsWithMETIS(
+    std::vector<IntegerType> const& element_weights)
+{
+    std::vector<MeshLib::Element*> const& elements = _mesh->getElements();
+    if (!element_weights.empty() && element_weights.size() != elements.size())
+    {
+        OGS_FATAL(
+            "The number of element weights (%d) differs from the number of "
+            "elements (%d).",
+            element_weights.size(), elements.size());
+    }
+
+    if (_npartitions == 1)
+    {
+        std::fill(_nodes_partition_ids.begin(), _nodes_partition_ids.end(), 0);
+        return;
+    }
+
+    // The mesh in the compressed format of METIS.
+    idx_t number_of_elements = elements.size();
+    idx_t number_of_nodes = _mesh->getNumberOfNodes();
+    std::vector<idx_t> eptr;
+    eptr.reserve(elements.size() + 1);
+    std::vector<idx_t> eind;
+    eptr.push_back(0);
+    for (const auto* elem : elements)
+    {
+        for (unsigned i = 0; i < elem->getNumberOfNodes(); i++)
+            eind.push_back(elem->getNodeIndex(i));
+        eptr.push_back(eind.size());
+    }
+
+    // Vertex weights: the sum of the weights of the adjacent elements.
+    std::vector<idx_t> node_weights;
+    if (!element_weights.empty())
+    {
+        node_weights.resize(number_of_nodes, 0);
+        for (std::size_t e = 0; e < elements.size(); e++)
+        {
+            for (unsigned i = 0; i < elements[e]->getNumberOfNodes(); i++)
+                node_weights[elements[e]->getNodeIndex(i)] +=
+                    element_weights[e];
+        }
+        // Isolated nodes must not have zero weight.
+        for (auto& w : node_weights)
+            w = std::max(w, idx_t{1});
+    }
+
+    idx_t numflag = 0;
+    idx_t* xadj = nullptr;
+    idx_t* adjncy = nullptr;
+    if (METIS_MeshToNodal(&number_of_elements, &number_of_nodes, eptr.data(),
+                          eind.data(), &numflag, &xadj,
+                          &adjncy) != METIS_OK)
+    {
+        OGS_FATAL("METIS could not create the nodal graph of the mesh.");
+    }
+    // The element data are not needed anymore.
+    std::vector<idx_t>().swap(eind);
+    std::vector<idx_t>().swap(eptr);
+
+    idx_t number_of_constraints = 1;
+    idx_t number_of_partitions = _npartitions;
+    idx_t edge_cut = 0;
+    std::vector<idx_t> node_partitions(number_of_nodes);
+    int const status = METIS_PartGraphKway(
+        &number_of_nodes, &number_of_constraints, xadj, adjncy,
+        node_weights.empty() ? nullptr : node_weights.data(), nullptr,
+        nullptr, &number_of_partitions, nullptr, nullptr, nullptr, &edge_cut,
+        node_partitions.data());
+    METIS_Free(xadj);
+    METIS_Free(adjncy);
+    if (status != METIS_OK)
+    {
+        OGS_FATAL("METIS failed to partition the mesh, error code %d.",
+                  status);
+    }
+    INFO("METIS partitioned the nodal graph with an edge cut of %d.",
+         edge_cut);
+
+    std::copy(node_partitions.begin(), node_partitions.end(),
+              _nodes_partition_ids.begin());
+}
+
+void NodeWiseMeshPartitioner::findNonGhostNodesInPartitions(
     const bool is_mixed_high_order_linear_elems,
-    std::vector<MeshLib::Node*>& extra_nodes)
+    std::vector<std::vector<MeshLib::Node*>>& extra_nodes)
 {
     std::vector<MeshLib::Node*> const& nodes = _mesh->getNodes();
-    auto& partition = _partitions[part_id];
     // -- Extra nodes for high order elements
     for (std::size_t i = 0; i < _mesh->getNumberOfNodes(); i++)
     {
-        if (_nodes_partition_ids[i] == part_id)
-        {
-            splitOfHigherOrderNode(nodes, is_mixed_high_order_linear_elems,
-                                   i, partition.nodes, extra_nodes);
-        }
+        auto const part_id = _nodes_partition_ids[i];
+        splitOfHigherOrderNode(nodes, is_mixed_high_order_linear_elems, i,
+                               _partitions[part_id].nodes,
+                               extra_nodes[part_id]);
+    }
+
+    for (std::size_t part_id = 0; part_id < _partitions.size(); part_id++)
+    {
+        auto& partition = _partitions[part_id];
+        partition.number_of_non_ghost_base_nodes = partition.nodes.size();
+        partition.number_of_non_ghost_nodes =
+            partition.number_of_non_ghost_base_nodes +
+            extra_nodes[part_id].size();
     }
-    partition.number_of_non_ghost_base_nodes = partition.nodes.size();
-    partition.number_of_non_ghost_nodes =
-        partition.number_of_non_ghost_base_nodes + extra_nodes.size();
 }
 
-void NodeWiseMeshPartitioner::findElementsInPartition(std::size_t const part_id)
+void NodeWiseMeshPartitioner::findElementsInPartitions()
 {
-    auto& partition = _partitions[part_id];
-    std::vector<MeshLib::Element*> const& elements = _mesh->getElements();
-    std::vector<bool> _is_regular_element(elements.size(), false);
+    // Distinct partitions the nodes of the current element belong to.
+    std::vector<std::size_t> element_partition_ids;
 
-    for (std::size_t elem_id = 0; elem_id < elements.size(); elem_id++)
+    for (const auto* elem : _mesh->getElements())
     {
-        const auto* elem = elements[elem_id];
-        if (_is_regular_element[elem_id])
-            continue;
-
-        std::size_t non_ghost_node_number = 0;
+        element_partition_ids.clear();
         for (unsigned i = 0; i < elem->getNumberOfNodes(); i++)
         {
-            if (_nodes_partition_ids[elem->getNodeIndex(i)] == part_id)
-            {
-                non_ghost_node_number++;
-            }
+            auto const part_id = _nodes_partition_ids[elem->getNodeIndex(i)];
+            if (std::find(element_partition_ids.begin(),
+                          element_partition_ids.end(),
+                          part_id) == element_partition_ids.end())
+                element_partition_ids.push_back(part_id);
         }
 
-        if (non_ghost_node_number == 0)
-            continue;
-
-        if (non_ghost_node_number == elem->getNumberOfNodes())
-        {
-            partition.regular_elements.push_back(elem);
-            _is_regular_element[elem_id] = true;
-        }
-        else
+        if (element_partition_ids.size() == 1)
         {
-            partition.ghost_elements.push_back(elem);
+            _partitions[element_partition_ids.front()]
+                .regular_elements.push_back(elem);
+            continue;
         }
+
+        for (auto const part_id : element_partition_ids)
+            _partitions[part_id].ghost_elements.push_back(elem);
     }
 }
 
-void NodeWiseMeshPartitioner::findGhostNodesInPartition(
-    std::size_t const part_id,
+void NodeWiseMeshPartitioner::findGhostNodesInPartitions(
     const bool is_mixed_high_order_linear_elems,
-    std::vector<MeshLib::Node*>& extra_nodes)
+    std::vector<std::vector<MeshLib::Node*>>& extra_nodes)
 {
-    auto& partition = _partitions[part_id];
     std::vector<MeshLib::Node*> const& nodes = _mesh->getNodes();
-    std::vector<bool> nodes_reserved(_mesh->getNumberOfNodes(), false);
-    for (const auto* ghost_elem : partition.ghost_elements)
+    // The partition for which a node has been reserved last. Sharing this
+    // vector between the partitions avoids a full size vector per partition.
+    std::vector<std::size_t> nodes_reserved(_mesh->getNumberOfNodes(),
+                                            _partitions.size());
+    for (std::size_t part_id = 0; part_id < _partitions.size(); part_id++)
     {
-        for (unsigned i = 0; i < ghost_elem->getNumberOfNodes(); i++)
+        auto& partition = _partitions[part_id];
+        for (const auto* ghost_elem : partition.ghost_elements)
         {
-            const unsigned node_id = ghost_elem->getNodeIndex(i);
-            if (nodes_reserved[node_id])
-                continue;
-
-            if (_nodes_partition_ids[node_id] != part_id)
+            for (unsigned i = 0; i < ghost_elem->getNumberOfNodes(); i++)
             {
-                splitOfHigherOrderNode(nodes, is_mixed_high_order_linear_elems,
-                                       node_id, partition.nodes, extra_nodes);
-                nodes_reserved[node_id] = true;
+                const unsigned node_id = ghost_elem->getNodeIndex(i);
+                if (nodes_reserved[node_id] == part_id)
+                    continue;
+
+                if (_nodes_partition_ids[node_id] != part_id)
+                {
+                    splitOfHigherOrderNode(
+                        nodes, is_mixed_high_order_linear_elems, node_id,
+                        partition.nodes, extra_nodes[part_id]);
+                    nodes_reserved[node_id] = part_id;
+                }
             }
         }
     }
@@ -185,24 +274,6 @@ void NodeWiseMeshPartitioner::splitOfHigherOrderNode(
     }
 }
 
-void NodeWiseMeshPartitioner::processPartition(std::size_t const part_id,
-    const bool is_mixed_high_order_linear_elems)
-{
-    std::vector<MeshLib::Node*> extra_nodes;
-    findNonGhostNodesInPartition(part_id, is_mixed_high_order_linear_elems,
-                                 extra_nodes);
-
-    findElementsInPartition(part_id);
-    findGhostNodesInPartition(part_id, is_mixed_high_order_linear_elems,
-                              extra_nodes);
-    auto& partition = _partitions[part_id];
-    partition.number_of_base_nodes = partition.nodes.size();
-
-    if (is_mixed_high_order_linear_elems)
-        partition.nodes.insert(partition.nodes.end(), extra_nodes.begin(),
-                               extra_nodes.end());
-}
-
 void NodeWiseMeshPartitioner::processNodeProperties()
 {
     std::size_t const total_number_of_tuples =
@@ -276,10 +347,26 @@ void NodeWiseMeshPartitioner::processCellProperties()
 void NodeWiseMeshPartitioner::partitionByMETIS(
     const bool is_mixed_high_order_linear_elems)
 {
+    // All partitions are processed together, each of the following steps
+    // walks over the mesh only once.
+    std::vector<std::vector<MeshLib::Node*>> extra_nodes(_partitions.size());
+    INFO("Finding non-ghost nodes of all partitions.");
+    findNonGhostNodesInPartitions(is_mixed_high_order_linear_elems,
+                                  extra_nodes);
+    INFO("Finding regular and ghost elements of all partitions.");
+    findElementsInPartitions();
+    INFO("Finding ghost nodes of all partitions.");
+    findGhostNodesInPartitions(is_mixed_high_order_linear_elems, extra_nodes);
+
     for (std::size_t part_id = 0; part_id < _partitions.size(); part_id++)
     {
-        INFO("Processing partition: %d", part_id);
-        processPartition(part_id, is_mixed_high_order_linear_elems);
+        auto& partition = _partitions[part_id];
+        partition.number_of_base_nodes = partition.nodes.size();
+
+        if (is_mixed_high_order_linear_elems)
+            partition.nodes.insert(partition.nodes.end(),
+                                   extra_nodes[part_id].begin(),
+                                   extra_nodes[part_id].end());
     }
 
     renumberNodeIndices(is_mixed_high_order_linear_elems);
@@ -548,18 +635,13 @@ void NodeWiseMeshPartitioner::writeElementsBinary
     fname =
         file_name_base + "_partitioned_msh_ele_g" + npartitions_str + ".bin";
     FILE* of_bin_ele_g = fopen(fname.c_str(), "wb");
+    std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
     for (std::size_t i = 0; i < _partitions.size(); i++)
     {
         const auto& partition = _partitions[i];
 
         // Set the local node indices of the current partition.
-        IntegerType node_local_id_offset = 0;
-        std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
-        for (const auto* node : partition.nodes)
-        {
-            nodes_local_ids[node->getID()] = node_local_id_offset;
-            node_local_id_offset++;
-        }
+        setLocalNodeIndices(partition, nodes_local_ids);
 
         // A vector contians all element integer variales of
         // the non-ghost elements of this partition
@@ -594,6 +676,8 @@ void NodeWiseMeshPartitioner::writeElementsBinary
         // Write vector data of ghost elements
         fwrite(ele_info.data(), 1, (num_g_elem_integers[i]) * sizeof(IntegerType),
                of_bin_ele_g);
+
+        resetLocalNodeIndices(partition, nodes_local_ids);
     }
 
     fclose(of_bin_ele);
@@ -629,8 +713,17 @@ void NodeWiseMeshPartitioner::writeNodesBinary(const std::string& file_name_base
 
 void NodeWiseMeshPartitioner::writeBinary(const std::string& file_name_base)
 {
-    writeNodePropertiesBinary(file_name_base);
-    writeCellPropertiesBinary(file_name_base);
+    // The files are independent of each other and are written concurrently;
+    // the writers only read the partition data.
+    auto node_properties = std::async(std::launch::async, [&]() {
+        writeNodePropertiesBinary(file_name_base);
+    });
+    auto cell_properties = std::async(std::launch::async, [&]() {
+        writeCellPropertiesBinary(file_name_base);
+    });
+    auto nodes = std::async(std::launch::async,
+                            [&]() { writeNodesBinary(file_name_base); });
+
     const auto elem_integers = writeConfigDataBinary(file_name_base);
 
     const std::vector<IntegerType>& num_elem_integers
@@ -640,7 +733,15 @@ void NodeWiseMeshPartitioner::writeBinary(const std::string& file_name_base)
     writeElementsBinary(file_name_base, num_elem_integers,
                         num_g_elem_integers);
 
-    writeNodesBinary(file_name_base);
+    // Rethrows exceptions of the writers.
+    node_properties.get();
+    cell_properties.get();
+    nodes.get();
+
+    // Allows to read the partitions with a smaller number of processes,
+    // each of which merges several partitions.
+    std::ofstream os_parts(file_name_base + "_partitioned_msh_parts.txt");
+    os_parts << _npartitions << "\n";
 }
 
 void NodeWiseMeshPartitioner::writeConfigDataASCII
@@ -685,16 +786,11 @@ void NodeWiseMeshPartitioner::writeElementsASCII(const std::string& file_name_ba
     const std::string fname = file_name_base + "_partitioned_elems_"
                               + std::to_string(_npartitions) + ".msh";
     std::fstream os_subd(fname, std::ios::out | std::ios::trunc);
+    std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
     for (const auto& partition : _partitions)
     {
         // Set the local node indices of the current partition.
-        IntegerType node_local_id_offset = 0;
-        std::vector<IntegerType> nodes_local_ids(_mesh->getNumberOfNodes(), -1);
-        for (const auto* node : partition.nodes)
-        {
-            nodes_local_ids[node->getID()] = node_local_id_offset;
-            node_local_id_offset++;
-        }
+        setLocalNodeIndices(partition, nodes_local_ids);
 
         for (const auto* elem : partition.regular_elements)
         {
@@ -705,6 +801,8 @@ void NodeWiseMeshPartitioner::writeElementsASCII(const std::string& file_name_ba
             writeLocalElementNodeIndices(os_subd, *elem, nodes_local_ids);
         }
         os_subd << std::endl;
+
+        resetLocalNodeIndices(partition, nodes_local_ids);
     }
 }
 
@@ -735,6 +833,24 @@ void NodeWiseMeshPartitioner::writeASCII(const std::string& file_name_base)
     writeNodesASCII(file_name_base);
 }
 
+void NodeWiseMeshPartitioner::setLocalNodeIndices(
+    Partition const& partition, std::vector<IntegerType>& local_node_ids) const
+{
+    IntegerType node_local_id_offset = 0;
+    for (const auto* node : partition.nodes)
+    {
+        local_node_ids[node->getID()] = node_local_id_offset;
+        node_local_id_offset++;
+    }
+}
+
+void NodeWiseMeshPartitioner::resetLocalNodeIndices(
+    Partition const& partition, std::vector<IntegerType>& local_node_ids) const
+{
+    for (const auto* node : partition.nodes)
+        local_node_ids[node->getID()] = -1;
+}
+
 void NodeWiseMeshPartitioner::getElementIntegerVariables(
     const MeshLib::Element& elem,
     const std::vector<IntegerType>& local_node_ids,
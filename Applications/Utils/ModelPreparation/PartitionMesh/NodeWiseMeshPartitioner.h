@@ -71,6 +71,16 @@ public:
     /// \param file_name_base The prefix of the file name.
     void readMetisData(const std::string& file_name_base);
 
+    /// Computes the partition of each node by calling the METIS library on
+    /// the nodal graph of the mesh, which is set up in memory. Two nodes are
+    /// connected in this graph if they share an element, which is the same
+    /// graph the mpmetis tool uses with option -gtype=nodal.
+    /// \param element_weights The computational cost of each element, which
+    /// is distributed to the element's nodes to form the vertex weights of
+    /// the graph. If empty, all nodes have the same weight.
+    void computeNodePartitionsWithMETIS(
+        std::vector<IntegerType> const& element_weights);
+
     /// Write mesh to METIS input file
     /// \param file_name File name with an extension of mesh.
     void writeMETIS(const std::string& file_name);
@@ -79,10 +89,16 @@ public:
     /// \param file_name_base The prefix of the file name.
     void writeASCII(const std::string& file_name_base);
 
-    /// Write the partitions into binary files
+    /// Write the partitions into binary files. The number of partitions is
+    /// written to file_name_base+_partitioned_msh_parts.txt, such that the
+    /// partitions can be read by any number of processes up to the number of
+    /// partitions.
     /// \param file_name_base The prefix of the file name.
     void writeBinary(const std::string& file_name_base);
 
+    /// The partitions, which are set up by partitionByMETIS().
+    std::vector<Partition> const& getPartitions() const { return _partitions; }
+
 private:
     /// Number of partitions.
     IntegerType _npartitions;
@@ -131,30 +147,41 @@ private:
                                     std::vector<IntegerType>& elem_info,
                                     IntegerType& counter);
 
+    /// Sets the local indices of the nodes of the partition in
+    /// \c local_node_ids, which is indexed by global node IDs.
+    void setLocalNodeIndices(Partition const& partition,
+                             std::vector<IntegerType>& local_node_ids) const;
+
+    /// Resets the entries set by setLocalNodeIndices() to -1, such that the
+    /// vector can be reused for the next partition without reallocation.
+    void resetLocalNodeIndices(Partition const& partition,
+                               std::vector<IntegerType>& local_node_ids) const;
+
     void writeNodePropertiesBinary(std::string const& file_name_base) const;
     void writeCellPropertiesBinary(std::string const& file_name_base) const;
 
-    /// 1 copy pointers to nodes belonging to the partition part_id
-    /// 2 collect non-linear element nodes belonging to the partition part_id in
-    /// extra_nodes
-    void findNonGhostNodesInPartition(
-        std::size_t const part_id,
+    /// 1 copy pointers to nodes to the partitions they belong to
+    /// 2 collect non-linear element nodes of each partition in the
+    /// corresponding entry of extra_nodes
+    /// All nodes are visited once.
+    void findNonGhostNodesInPartitions(
         const bool is_mixed_high_order_linear_elems,
-        std::vector<MeshLib::Node*>& extra_nodes);
+        std::vector<std::vector<MeshLib::Node*>>& extra_nodes);
 
-    /// 1 find elements belonging to the partition part_id:
-    /// fills vector partition.regular_elements
-    /// 2 find ghost elements belonging to the partition part_id
-    /// fills vector partition.ghost_elements
-    void findElementsInPartition(std::size_t const part_id);
+    /// Classifies all elements in a single pass: an element whose nodes all
+    /// belong to one partition is a regular element of that partition,
+    /// otherwise it is a ghost element of each partition owning one of its
+    /// nodes. Fills the vectors partition.regular_elements and
+    /// partition.ghost_elements.
+    void findElementsInPartitions();
 
     /// Prerequisite: the ghost elements has to be found (using
-    /// findElementsInPartition).
+    /// findElementsInPartitions).
     /// Finds ghost nodes and non-linear element ghost nodes by walking over
     /// ghost elements.
-    void findGhostNodesInPartition(std::size_t const part_id,
-                                   const bool is_mixed_high_order_linear_elems,
-                                   std::vector<MeshLib::Node*>& extra_nodes);
+    void findGhostNodesInPartitions(
+        const bool is_mixed_high_order_linear_elems,
+        std::vector<std::vector<MeshLib::Node*>>& extra_nodes);
 
     void splitOfHigherOrderNode(std::vector<MeshLib::Node*> const& nodes,
                                 bool const is_mixed_high_order_linear_elems,
@@ -162,9 +189,6 @@ private:
                                 std::vector<MeshLib::Node*>& base_nodes,
                                 std::vector<MeshLib::Node*>& extra_nodes);
 
-    void processPartition(std::size_t const part_id,
-                          const bool is_mixed_high_order_linear_elems);
-
     void processNodeProperties();
     void processCellProperties();
 
@@ -183,7 +207,7 @@ private:
         partitioned_pv->resize(total_number_of_tuples *
                                pv->getNumberOfComponents());
         std::size_t position_offset(0);
-        for (auto p : _partitions)
+        for (auto const& p : _partitions)
         {
             for (std::size_t i = 0; i < p.nodes.size(); ++i)
             {
@@ -12,6 +12,10 @@
 
 */
 
+#include <map>
+#include <string>
+#include <vector>
+
 #include <tclap/CmdLine.h>
 
 #ifdef WIN32
@@ -21,6 +25,7 @@
 #endif
 
 #include "Applications/ApplicationsLib/LogogSetup.h"
+#include "BaseLib/Error.h"
 #include "BaseLib/FileTools.h"
 #include "BaseLib/CPUTime.h"
 #include "BaseLib/RunTime.h"
@@ -29,6 +34,56 @@
 
 #include "NodeWiseMeshPartitioner.h"
 
+/// Element weights for the graph partitioning from the element types and
+/// the material groups. Returns an empty vector for uniform weights.
+std::vector<ApplicationUtils::NodeWiseMeshPartitioner::IntegerType>
+computeElementWeights(MeshLib::Mesh const& mesh, bool const by_element_type,
+                      std::vector<std::string> const& material_weights)
+{
+    using IntegerType = ApplicationUtils::NodeWiseMeshPartitioner::IntegerType;
+    std::vector<IntegerType> weights;
+    if (!by_element_type && material_weights.empty())
+        return weights;
+
+    auto const& elements = mesh.getElements();
+    weights.resize(elements.size(), 1);
+
+    if (by_element_type)
+    {
+        for (std::size_t e = 0; e < elements.size(); e++)
+            weights[e] = elements[e]->getNumberOfNodes();
+    }
+
+    if (material_weights.empty())
+        return weights;
+
+    std::map<int, IntegerType> weight_of_material;
+    for (auto const& str : material_weights)
+    {
+        auto const separator = str.find(':');
+        if (separator == std::string::npos)
+            OGS_FATAL("Material weight '%s' is not of the form ID:weight.",
+                      str.c_str());
+        weight_of_material[std::stoi(str.substr(0, separator))] =
+            std::stol(str.substr(separator + 1));
+    }
+
+    auto const* const material_ids =
+        mesh.getProperties().existsPropertyVector<int>("MaterialIDs")
+            ? mesh.getProperties().getPropertyVector<int>("MaterialIDs")
+            : nullptr;
+    if (material_ids == nullptr)
+        OGS_FATAL("Material weights require the MaterialIDs of the mesh.");
+
+    for (std::size_t e = 0; e < elements.size(); e++)
+    {
+        auto const it = weight_of_material.find((*material_ids)[e]);
+        if (it != weight_of_material.end())
+            weights[e] *= it->second;
+    }
+    return weights;
+}
+
 int main(int argc, char* argv[])
 {
     ApplicationsLib::LogogSetup logog_setup;
@@ -37,12 +92,10 @@ int main(int argc, char* argv[])
         "Partition a mesh for parallel computing."
         "The tasks of this tool are in twofold:\n"
         "1. Convert mesh file to the input file of the partitioning tool,\n"
-        "2. Partition a mesh using the partitioning tool,\n"
+        "2. Partition a mesh using the METIS library or the output of mpmetis,\n"
         "\tcreate the mesh data of each partition,\n"
         "\trenumber the node indices of each partition,\n"
-        "\tand output the results for parallel computing.\n"
-        "Note: If this tool is installed as a system command,\n"
-        "\tthe command must be run with its full path.";
+        "\tand output the results for parallel computing.";
 
     TCLAP::CmdLine cmd(m_str, ' ', "0.1");
     TCLAP::ValueArg<std::string> mesh_input(
@@ -50,8 +103,11 @@ int main(int argc, char* argv[])
         "the name of the file containing the input mesh", true, "",
         "file name of input mesh");
     cmd.add(mesh_input);
-    TCLAP::ValueArg<int> nparts("n", "np", "the number of partitions", false, 2,
-                                "integer");
+    TCLAP::ValueArg<int> nparts(
+        "n", "np",
+        "the number of partitions. The binary output can be used by any "
+        "number of processes up to the number of partitions.",
+        false, 2, "integer");
     cmd.add(nparts);
 
     TCLAP::SwitchArg ogs2metis_flag(
@@ -60,10 +116,27 @@ int main(int argc, char* argv[])
         false);
 
     TCLAP::SwitchArg exe_metis_flag(
-        "m", "exe_metis", "Call mpmetis inside the programme via system().",
+        "m", "exe_metis",
+        "Partition the mesh with the METIS library inside the programme. "
+        "Otherwise the partitions are read from the output of mpmetis.",
         false);
     cmd.add(exe_metis_flag);
 
+    TCLAP::SwitchArg element_type_weights_flag(
+        "t", "weight-by-element-type",
+        "Balance the partitions by element cost, estimated by the number of "
+        "nodes of each element. Only used with option -m.",
+        false);
+    cmd.add(element_type_weights_flag);
+
+    TCLAP::MultiArg<std::string> material_weights_arg(
+        "w", "material-weight",
+        "Weight of the elements of a material group in the form "
+        "MaterialID:weight, e.g., 3:10 for expensive elements of material 3. "
+        "The weight of other materials is 1. Only used with option -m.",
+        false, "MaterialID:weight");
+    cmd.add(material_weights_arg);
+
     TCLAP::SwitchArg lh_elems_flag(
         "q", "lh_elements", "Mixed linear and high order elements.", false);
     cmd.add(lh_elems_flag);
@@ -86,8 +159,9 @@ int main(int argc, char* argv[])
          mesh_ptr->getNumberOfNodes(),
          mesh_ptr->getNumberOfElements());
 
-    std::size_t const number_of_nodes(mesh_ptr->getNumberOfNodes());
-    std::size_t const number_of_elements(mesh_ptr->getNumberOfElements());
+    auto const element_weights = computeElementWeights(
+        *mesh_ptr, element_type_weights_flag.getValue(),
+        material_weights_arg.getValue());
 
     ApplicationUtils::NodeWiseMeshPartitioner mesh_partitioner(
         nparts.getValue(), std::move(mesh_ptr));
@@ -100,50 +174,16 @@ int main(int argc, char* argv[])
     }
     else
     {
-        const int num_partitions = nparts.getValue();
-
-        // Execute mpmetis via system(...)
-        if (num_partitions > 1 && exe_metis_flag.getValue())
+        if (exe_metis_flag.getValue())
         {
             INFO("METIS is running ...");
-            const std::string exe_name = argv[0];
-            const std::string exe_path = BaseLib::extractPath(exe_name);
-            INFO("Path to mpmetis is: \n\t%s", exe_path.c_str());
-
-            const std::string mpmetis_com =
-                exe_path + "/mpmetis " + " -gtype=nodal " + file_name_base +
-                ".mesh " + std::to_string(nparts.getValue());
-
-            const int status = system(mpmetis_com.c_str());
-            if (status != 0)
-            {
-                INFO("Failed in system calling.");
-                INFO("Return value of system call %d ", status);
-                return EXIT_FAILURE;
-            }
+            mesh_partitioner.computeNodePartitionsWithMETIS(element_weights);
         }
-        else if (num_partitions == 1 && exe_metis_flag.getValue())
+        else
         {
-            // The mpmetis tool can not be used for 'partitioning' in only one
-            // domain. For this reason the according files are written for just
-            // one domain in the metis output format in the following.
-            auto writePartitionFile = [&file_name_base](
-                std::string const& file_name_extension, std::size_t number) {
-                std::string const name(file_name_base + file_name_extension);
-                std::ofstream os(name);
-                if (!os)
-                    OGS_FATAL("Couldn't open file '%s' for writing.",
-                              name.c_str());
-                for (std::size_t n(0); n < number; ++n)
-                    os << "0\n";
-            };
-
-            writePartitionFile(".mesh.npart.1", number_of_nodes);
-            writePartitionFile(".mesh.epart.1", number_of_elements);
+            mesh_partitioner.readMetisData(file_name_base);
         }
 
-        mesh_partitioner.readMetisData(file_name_base);
-
         INFO("Partitioning the mesh in the node wise way ...");
         mesh_partitioner.partitionByMETIS(lh_elems_flag.getValue());
         if (ascii_flag.getValue())
@@ -15,8 +15,10 @@
 #include "AnalyticalGeometry.h"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <limits>
+#include <tuple>
 
 #include <logog/include/logog.hpp>
 
@@ -312,34 +314,167 @@ std::unique_ptr<GeoLib::Point> triangleLineIntersection(
                                            u * a[2] + v * b[2] + w * c[2]);
 }
 
-void computeAndInsertAllIntersectionPoints(GeoLib::PointVec &pnt_vec,
-    std::vector<GeoLib::Polyline*> & plys)
+namespace
+{
+/// A line segment of a polyline together with its axis aligned bounding box.
+/// The box is enlarged by the tolerances used in lineSegmentIntersect().
+struct SegmentWithBox
+{
+    SegmentWithBox(std::size_t const polyline_, std::size_t const segment_,
+                   GeoLib::LineSegment const& line_segment_)
+        : polyline(polyline_), segment(segment_), line_segment(line_segment_)
+    {
+        auto const& a = line_segment.getBeginPoint();
+        auto const& b = line_segment.getEndPoint();
+        double const eps =
+            1e-6 * std::sqrt(MathLib::sqrDist(a, b)) +
+            std::sqrt(std::numeric_limits<double>::epsilon());
+        for (std::size_t k(0); k < 3; ++k)
+        {
+            min[k] = std::min(a[k], b[k]) - eps;
+            max[k] = std::max(a[k], b[k]) + eps;
+        }
+    }
+
+    bool overlaps(SegmentWithBox const& other) const
+    {
+        for (std::size_t k(0); k < 3; ++k)
+        {
+            if (max[k] < other.min[k] || other.max[k] < min[k])
+                return false;
+        }
+        return true;
+    }
+
+    std::size_t polyline;
+    std::size_t segment;
+    GeoLib::LineSegment line_segment;
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+};
+
+/// The intersection point of two line segments of different polylines. The
+/// position of the point within a segment is given by the parameter \f$t \in
+/// [0,1]\f$ along the segment.
+struct SegmentIntersection
+{
+    std::size_t polyline0;
+    std::size_t segment0;
+    double t0;
+    std::size_t polyline1;
+    std::size_t segment1;
+    double t1;
+    GeoLib::Point point;
+};
+
+double parameterAlongSegment(GeoLib::LineSegment const& segment,
+                             MathLib::Point3d const& p)
+{
+    MathLib::Vector3 const v(segment.getBeginPoint(), segment.getEndPoint());
+    MathLib::Vector3 const w(segment.getBeginPoint(), p);
+    return MathLib::scalarProduct(v, w) / v.getSqrLength();
+}
+
+/// Computes the intersections of the line segments of different polylines by
+/// a sweep along the x axis over the bounding boxes of the segments. Only
+/// segments whose boxes overlap are tested for an intersection.
+std::vector<SegmentIntersection> computeAllSegmentIntersections(
+    std::vector<GeoLib::Polyline*> const& plys)
 {
-    auto computeSegmentIntersections = [&pnt_vec](GeoLib::Polyline& poly0,
-                                                  GeoLib::Polyline& poly1)
+    std::vector<SegmentWithBox> segments;
+    for (std::size_t p(0); p < plys.size(); ++p)
     {
-        for (auto seg0_it(poly0.begin()); seg0_it != poly0.end(); ++seg0_it)
+        for (auto seg_it(plys[p]->begin()); seg_it != plys[p]->end(); ++seg_it)
+            segments.emplace_back(p, seg_it.getSegmentNumber(), *seg_it);
+    }
+    std::sort(segments.begin(), segments.end(),
+              [](SegmentWithBox const& s0, SegmentWithBox const& s1) {
+                  return s0.min[0] < s1.min[0];
+              });
+
+    std::vector<SegmentIntersection> intersections;
+    // Segments whose boxes may still overlap the boxes of subsequent segments.
+    std::vector<SegmentWithBox const*> active;
+    for (auto const& segment : segments)
+    {
+        active.erase(std::remove_if(active.begin(), active.end(),
+                                    [&segment](SegmentWithBox const* s) {
+                                        return s->max[0] < segment.min[0];
+                                    }),
+                     active.end());
+
+        for (auto const* other : active)
         {
-            for (auto seg1_it(poly1.begin()); seg1_it != poly1.end(); ++seg1_it)
+            if (other->polyline == segment.polyline ||
+                !segment.overlaps(*other))
+                continue;
+
+            // Order the pair such that the first polyline has the lower index.
+            auto const& s0 =
+                other->polyline < segment.polyline ? *other : segment;
+            auto const& s1 =
+                other->polyline < segment.polyline ? segment : *other;
+            GeoLib::Point s(0.0, 0.0, 0.0);
+            if (lineSegmentIntersect(s0.line_segment, s1.line_segment, s))
             {
-                GeoLib::Point s(0.0, 0.0, 0.0, pnt_vec.size());
-                if (lineSegmentIntersect(*seg0_it, *seg1_it, s))
-                {
-                    std::size_t const id(
-                        pnt_vec.push_back(new GeoLib::Point(s)));
-                    poly0.insertPoint(seg0_it.getSegmentNumber() + 1, id);
-                    poly1.insertPoint(seg1_it.getSegmentNumber() + 1, id);
-                }
+                intersections.push_back(
+                    {s0.polyline, s0.segment,
+                     parameterAlongSegment(s0.line_segment, s), s1.polyline,
+                     s1.segment, parameterAlongSegment(s1.line_segment, s),
+                     s});
             }
         }
+        active.push_back(&segment);
+    }
+    return intersections;
+}
+}  // namespace
+
+void computeAndInsertAllIntersectionPoints(GeoLib::PointVec &pnt_vec,
+    std::vector<GeoLib::Polyline*> & plys)
+{
+    auto intersections = computeAllSegmentIntersections(plys);
+
+    // The ids of the new points are assigned in the order of the polylines,
+    // and along the polyline with the lower index.
+    std::sort(intersections.begin(), intersections.end(),
+              [](SegmentIntersection const& i0, SegmentIntersection const& i1) {
+                  return std::tie(i0.polyline0, i0.polyline1, i0.segment0,
+                                  i0.t0) < std::tie(i1.polyline0, i1.polyline1,
+                                                    i1.segment0, i1.t0);
+              });
+
+    // Insert all points at once and collect the points to be inserted into
+    // each segment of the polylines.
+    struct SplitPoint
+    {
+        std::size_t segment;
+        double t;
+        std::size_t id;
     };
+    std::vector<std::vector<SplitPoint>> split_points(plys.size());
+    for (auto const& intersection : intersections)
+    {
+        std::size_t const id(
+            pnt_vec.push_back(new GeoLib::Point(intersection.point)));
+        split_points[intersection.polyline0].push_back(
+            {intersection.segment0, intersection.t0, id});
+        split_points[intersection.polyline1].push_back(
+            {intersection.segment1, intersection.t1, id});
+    }
 
-    for (auto it0(plys.begin()); it0 != plys.end(); ++it0) {
-        auto it1(it0);
-        ++it1;
-        for (; it1 != plys.end(); ++it1) {
-            computeSegmentIntersections(*(*it0), *(*it1));
-        }
+    // Split the segments beginning at the end of each polyline, such that the
+    // segment numbers of the not yet processed segments remain valid.
+    for (std::size_t p(0); p < plys.size(); ++p)
+    {
+        auto& points = split_points[p];
+        std::sort(points.begin(), points.end(),
+                  [](SplitPoint const& p0, SplitPoint const& p1) {
+                      return std::tie(p0.segment, p0.t) >
+                             std::tie(p1.segment, p1.t);
+                  });
+        for (auto const& point : points)
+            plys[p]->insertPoint(point.segment + 1, point.id);
     }
 }
 
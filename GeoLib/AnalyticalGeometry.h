@@ -229,6 +229,10 @@ std::unique_ptr<GeoLib::Point> triangleLineIntersection(
  * (@see computeIntersectionPoints()) and pushes each intersection point in the GeoLib::PointVec
  * pnt_vec. For each intersection an id is returned.  This id is used to split the two
  * intersecting straight line segments in four straight line segments.
+ *
+ * Only pairs of segments with overlapping bounding boxes, which are found by a
+ * sweep along the x axis, are tested for intersection. All intersection points
+ * are inserted before the polylines are split.
  */
 void computeAndInsertAllIntersectionPoints(GeoLib::PointVec &pnt_vec,
     std::vector<GeoLib::Polyline*> & plys);
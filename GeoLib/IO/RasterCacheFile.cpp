@@ -0,0 +1,116 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "RasterCacheFile.h"
+
+#include <array>
+#include <cstring>
+
+namespace
+{
+char const magic[8] = {'O', 'G', 'S', 'R', 'A', 'S', 'T', 'R'};
+std::uint32_t const version = 2;
+
+/// Fixed size part of the header; the remainder up to
+/// raster_cache_file_header_size bytes is zero.
+struct CacheFileHeader
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t size_of_double;
+    std::uint64_t n_cols;
+    std::uint64_t n_rows;
+    std::uint64_t source_size;
+    std::int64_t source_modification_time;
+    double origin[3];
+    double cell_size;
+    double no_data;
+};
+
+static_assert(sizeof(CacheFileHeader) <=
+                  GeoLib::IO::raster_cache_file_header_size,
+              "The raster cache file header does not fit its reserved size.");
+}  // namespace
+
+namespace GeoLib
+{
+namespace IO
+{
+RasterCacheFileWriter::RasterCacheFileWriter(std::string const& file_name,
+                                             RasterHeader const& header,
+                                             RasterCacheSource const& source)
+    : _out(file_name, std::ios::binary | std::ios::trunc)
+{
+    CacheFileHeader h;
+    std::memcpy(h.magic, magic, sizeof(magic));
+    h.version = version;
+    h.size_of_double = sizeof(double);
+    h.n_cols = header.n_cols;
+    h.n_rows = header.n_rows;
+    h.source_size = source.size;
+    h.source_modification_time = source.modification_time;
+    for (std::size_t k(0); k < 3; ++k)
+        h.origin[k] = header.origin[k];
+    h.cell_size = header.cell_size;
+    h.no_data = header.no_data;
+
+    std::array<char, raster_cache_file_header_size> buffer{};
+    std::memcpy(buffer.data(), &h, sizeof(h));
+    _out.write(buffer.data(), buffer.size());
+
+    // Extend the file to its final size.
+    std::size_t const n = header.n_cols * header.n_rows;
+    if (n > 0)
+    {
+        _out.seekp(raster_cache_file_header_size + n * sizeof(double) - 1);
+        _out.put('\0');
+    }
+}
+
+void RasterCacheFileWriter::write(std::size_t const index,
+                                  double const* const values,
+                                  std::size_t const n)
+{
+    _out.seekp(raster_cache_file_header_size + index * sizeof(double));
+    _out.write(reinterpret_cast<char const*>(values), n * sizeof(double));
+}
+
+bool readRasterCacheFileHeader(std::string const& file_name,
+                               RasterHeader& header,
+                               RasterCacheSource& source)
+{
+    std::ifstream in(file_name, std::ios::binary | std::ios::ate);
+    if (!in)
+        return false;
+    auto const file_size = static_cast<std::uint64_t>(in.tellg());
+    in.seekg(0);
+
+    CacheFileHeader h;
+    if (!in.read(reinterpret_cast<char*>(&h), sizeof(h)))
+        return false;
+    if (std::memcmp(h.magic, magic, sizeof(magic)) != 0 ||
+        h.version != version || h.size_of_double != sizeof(double))
+        return false;
+    if (file_size !=
+        raster_cache_file_header_size + h.n_cols * h.n_rows * sizeof(double))
+        return false;
+
+    header.n_cols = h.n_cols;
+    header.n_rows = h.n_rows;
+    header.origin = MathLib::Point3d(
+        std::array<double, 3>{{h.origin[0], h.origin[1], h.origin[2]}});
+    header.cell_size = h.cell_size;
+    header.no_data = h.no_data;
+    source.size = h.source_size;
+    source.modification_time = h.source_modification_time;
+    return true;
+}
+
+}  // namespace IO
+}  // namespace GeoLib
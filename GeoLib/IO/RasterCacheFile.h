@@ -0,0 +1,88 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+
+#include "GeoLib/Raster.h"
+
+namespace GeoLib
+{
+namespace IO
+{
+/**
+ * Binary cache of the values of a GeoLib::Raster.
+ *
+ * The file consists of a header of \c raster_cache_file_header_size bytes
+ * followed by the raster values as doubles in native byte order, row by row
+ * beginning with the lowest row, i.e., in the order of Raster::begin(). The
+ * file is mapped into memory by Raster::createFromCacheFile(), such that only
+ * the parts of the raster actually accessed are loaded.
+ *
+ * The values are deliberately not stored in tiles. Raster::begin() exposes
+ * them as one contiguous row-major array, which MeshLib, the GeoMapper and the
+ * Data Explorer rely on. The pages of the mapping take the role of the tiles:
+ * a page holds a part of a single row, so access to a small area of the
+ * raster loads about one page per row of that area.
+ *
+ * Besides the RasterHeader, the size and the modification time of the file
+ * the cache was created from are stored. They allow to detect outdated cache
+ * files.
+ */
+constexpr std::size_t raster_cache_file_header_size = 128;
+
+/// Identifies the state of the file a raster cache file was created from.
+struct RasterCacheSource
+{
+    std::uint64_t size = 0;
+    std::int64_t modification_time = 0;  ///< In seconds since the epoch.
+
+    bool operator==(RasterCacheSource const& other) const
+    {
+        return size == other.size &&
+               modification_time == other.modification_time;
+    }
+    bool operator!=(RasterCacheSource const& other) const
+    {
+        return !(*this == other);
+    }
+};
+
+/// Writes a raster cache file. The values can be written in arbitrary order.
+class RasterCacheFileWriter final
+{
+public:
+    /// Creates the file and reserves the space for all raster values.
+    RasterCacheFileWriter(std::string const& file_name,
+                          RasterHeader const& header,
+                          RasterCacheSource const& source);
+
+    /// Returns false if the file could not be created or written.
+    bool good() const { return _out.good(); }
+
+    /// Writes \c n values to the positions beginning at \c index, where the
+    /// position is given in the order of Raster::begin().
+    void write(std::size_t index, double const* values, std::size_t n);
+
+private:
+    std::ofstream _out;
+};
+
+/// Reads the header of a raster cache file and checks the file size. Returns
+/// false if the file is not a valid raster cache file.
+bool readRasterCacheFileHeader(std::string const& file_name,
+                               RasterHeader& header,
+                               RasterCacheSource& source);
+
+}  // namespace IO
+}  // namespace GeoLib
@@ -13,6 +13,8 @@
 
 #include <fstream>
 
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
 #include <logog/include/logog.hpp>
 
 #include "Raster.h"
@@ -21,6 +23,7 @@
 #include "BaseLib/FileTools.h"
 #include "BaseLib/StringTools.h"
 
+#include "IO/RasterCacheFile.h"
 #include "Triangle.h"
 
 namespace GeoLib {
@@ -42,17 +45,68 @@ void Raster::refineRaster(std::size_t scaling)
         }
     }
 
-    std::swap(_raster_data, new_raster_data);
+    releaseData();
+    _raster_data = new_raster_data;
     _header.cell_size /= scaling;
     _header.n_cols *= scaling;
     _header.n_rows *= scaling;
+}
 
-    delete [] new_raster_data;
+Raster::Raster(RasterHeader header,
+               boost::interprocess::mapped_region* const mapped_region)
+    : _header(std::move(header)),
+      _raster_data(reinterpret_cast<double*>(
+          static_cast<char*>(mapped_region->get_address()) +
+          IO::raster_cache_file_header_size)),
+      _mapped_region(mapped_region)
+{
+}
+
+void Raster::releaseData()
+{
+    if (_mapped_region)
+    {
+        delete _mapped_region;
+        _mapped_region = nullptr;
+    }
+    else
+        delete [] _raster_data;
+    _raster_data = nullptr;
 }
 
 Raster::~Raster()
 {
-    delete [] _raster_data;
+    releaseData();
+}
+
+Raster* Raster::createFromCacheFile(std::string const& file_name)
+{
+    RasterHeader header;
+    IO::RasterCacheSource source;
+    if (!IO::readRasterCacheFileHeader(file_name, header, source))
+    {
+        WARN("Raster::createFromCacheFile(): %s is not a valid raster cache file.",
+             file_name.c_str());
+        return nullptr;
+    }
+
+    namespace bip = boost::interprocess;
+    try
+    {
+        // The mapping is private, such that the raster data can be changed
+        // without affecting the file.
+        bip::file_mapping const file(file_name.c_str(), bip::read_only);
+        auto* const mapped_region =
+            new bip::mapped_region(file, bip::copy_on_write);
+        mapped_region->advise(bip::mapped_region::advice_random);
+        return new Raster(std::move(header), mapped_region);
+    }
+    catch (bip::interprocess_exception const& e)
+    {
+        WARN("Raster::createFromCacheFile(): Could not map file %s: %s",
+             file_name.c_str(), e.what());
+    }
+    return nullptr;
 }
 
 Raster* Raster::getRasterFromSurface(Surface const& sfc, double cell_size, double no_data_val)
@@ -13,10 +13,19 @@
 
 #pragma once
 
+#include <string>
 #include <utility>
 
 #include "Surface.h"
 
+namespace boost
+{
+namespace interprocess
+{
+class mapped_region;
+}
+}
+
 namespace GeoLib {
 
 /// Contains the relevant information when handling with geoscientific raster data
@@ -36,6 +45,10 @@ struct RasterHeader
  * left point, the size of a raster pixel and a value for invalid data pixels.
  * Additional the object needs the raster data itself. The raster data will be
  * copied from the constructor. The destructor will release the memory.
+ *
+ * Alternatively, the raster data can be mapped from a binary cache file, see
+ * createFromCacheFile(). Then, the data are loaded on demand by the operating
+ * system, which allows the use of rasters exceeding the main memory.
  */
 class Raster {
 public:
@@ -98,12 +111,27 @@ public:
     /// Creates a Raster based on a GeoLib::Surface
     static Raster* getRasterFromSurface(Surface const& sfc, double cell_size, double no_data_val = -9999);
 
+    /// Creates a Raster whose data are mapped from the given raster cache
+    /// file, see GeoLib::IO::RasterCacheFileWriter. Changes of the data, e.g.
+    /// by refineRaster(), are not written back to the file. Returns nullptr
+    /// if the file is not a valid raster cache file.
+    static Raster* createFromCacheFile(std::string const& file_name);
+
 private:
+    Raster(RasterHeader header,
+           boost::interprocess::mapped_region* mapped_region);
+
+    /// Releases the raster data, either allocated or mapped.
+    void releaseData();
+
     void setCellSize(double cell_size);
     void setNoDataVal (double no_data_val);
 
     GeoLib::RasterHeader _header;
     double* _raster_data;
+    /// Memory mapping of a raster cache file providing the raster data;
+    /// nullptr if the data are allocated.
+    boost::interprocess::mapped_region* _mapped_region = nullptr;
 };
 
 }
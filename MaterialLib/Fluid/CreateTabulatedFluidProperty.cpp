@@ -0,0 +1,61 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "CreateTabulatedFluidProperty.h"
+
+#include <vector>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+
+#include "TabulatedFluidProperty.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+std::unique_ptr<FluidProperty> createTabulatedFluidProperty(
+    BaseLib::ConfigTree const& config,
+    std::unique_ptr<FluidProperty>&& property)
+{
+    if (property->dependsOnConcentration())
+        OGS_FATAL(
+            "The fluid property '%s' depends on the concentration and cannot "
+            "be tabulated over temperature and pressure.",
+            property->getName().c_str());
+
+    auto const T_range =
+        //! \ogs_file_param{material__fluid__tabulation__temperature_range}
+        config.getConfigParameter<std::vector<double>>("temperature_range");
+    auto const p_range =
+        //! \ogs_file_param{material__fluid__tabulation__pressure_range}
+        config.getConfigParameter<std::vector<double>>("pressure_range");
+    auto const number_of_nodes =
+        //! \ogs_file_param{material__fluid__tabulation__number_of_nodes}
+        config.getConfigParameter<std::vector<std::size_t>>(
+            "number_of_nodes");
+    auto const tolerance =
+        //! \ogs_file_param{material__fluid__tabulation__tolerance}
+        config.getConfigParameter<double>("tolerance", 1e-8);
+
+    if (T_range.size() != 2 || p_range.size() != 2 ||
+        number_of_nodes.size() != 2)
+        OGS_FATAL(
+            "The tabulation of the fluid property '%s' requires two values "
+            "for each of temperature_range, pressure_range and "
+            "number_of_nodes.",
+            property->getName().c_str());
+
+    return std::make_unique<TabulatedFluidProperty>(
+        std::move(property), T_range[0], T_range[1], number_of_nodes[0],
+        p_range[0], p_range[1], number_of_nodes[1], tolerance);
+}
+
+}  // end namespace
+}  // end namespace
@@ -0,0 +1,33 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+
+#include "FluidProperty.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/// Creates a TabulatedFluidProperty wrapping the given property model.
+/// \param config   ConfigTree object which has a tag of `<tabulation>`.
+/// \param property The property model to be tabulated.
+std::unique_ptr<FluidProperty> createTabulatedFluidProperty(
+    BaseLib::ConfigTree const& config,
+    std::unique_ptr<FluidProperty>&& property);
+
+}  // end namespace
+}  // end namespace
@@ -22,6 +22,7 @@
 #include "WaterDensityIAPWSIF97Region1.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/CreateTabulatedFluidProperty.h"
 
 namespace MaterialLib
 {
@@ -92,7 +93,7 @@ static std::unique_ptr<FluidProperty> createLinearConcentrationDependentDensity(
         fluid_density_difference_ratio);
 }
 
-std::unique_ptr<FluidProperty> createFluidDensityModel(
+static std::unique_ptr<FluidProperty> createUntabulatedFluidDensityModel(
     BaseLib::ConfigTree const& config)
 {
     //! \ogs_file_param{material__fluid__density__type}
@@ -133,5 +134,19 @@ std::unique_ptr<FluidProperty> createFluidDensityModel(
         type.data());
 }
 
+std::unique_ptr<FluidProperty> createFluidDensityModel(
+    BaseLib::ConfigTree const& config)
+{
+    auto const tabulation_config =
+        //! \ogs_file_param{material__fluid__density__tabulation}
+        config.getConfigSubtreeOptional("tabulation");
+
+    auto density = createUntabulatedFluidDensityModel(config);
+    if (tabulation_config)
+        return createTabulatedFluidProperty(*tabulation_config,
+                                            std::move(density));
+    return density;
+}
+
 }  // end namespace
 }  // end namespace
@@ -51,6 +51,8 @@ public:
         return "Linear concentration dependent density";
     }
 
+    bool dependsOnConcentration() const override { return true; }
+
     /// Get density value.
     /// \param var_vals Variable values in an array. The order of its elements
     ///                 is given in enum class PropertyVariableType.
@@ -41,12 +41,23 @@ public:
     /// \param var_vals Variable values in an array of temperature and pressure.
     double getValue(const ArrayType& var_vals) const override
     {
-        const double T = var_vals[static_cast<int>(PropertyVariableType::T)];
-        const double p = var_vals[static_cast<int>(PropertyVariableType::p)];
-        const double tau = _ref_T / T;
-        const double pi = p / _ref_p;
+        return computeDensity(
+            var_vals[static_cast<int>(PropertyVariableType::T)],
+            var_vals[static_cast<int>(PropertyVariableType::p)]);
+    }
 
-        return _ref_p / (_sR * T * _gibbs_free_energy.get_dgamma_dpi(tau, pi));
+    /// Get density values for a batch of temperature and pressure pairs
+    /// without virtual calls per entry.
+    void getValues(std::vector<ArrayType> const& var_vals,
+                   std::vector<double>& values) const override
+    {
+        values.resize(var_vals.size());
+        for (std::size_t i = 0; i < var_vals.size(); ++i)
+        {
+            values[i] = computeDensity(
+                var_vals[i][static_cast<int>(PropertyVariableType::T)],
+                var_vals[i][static_cast<int>(PropertyVariableType::p)]);
+        }
     }
 
     /**
@@ -82,6 +93,14 @@ public:
     }
 
 private:
+    double computeDensity(const double T, const double p) const
+    {
+        const double tau = _ref_T / T;
+        const double pi = p / _ref_p;
+
+        return _ref_p / (_sR * T * _gibbs_free_energy.get_dgamma_dpi(tau, pi));
+    }
+
     const DimensionLessGibbsFreeEnergyRegion1 _gibbs_free_energy;
 
     const double _ref_T = 1386;     ///< reference temperature in K.
@@ -14,6 +14,7 @@
 
 #include <array>
 #include <memory>
+#include <vector>
 
 #include "MaterialLib/Fluid/FluidProperty.h"
 #include "MaterialLib/Fluid/PropertyVariableType.h"
@@ -81,6 +82,25 @@ public:
         const ArrayType& variable_values,
         const PropertyVariableType variable_type) const = 0;
 
+    /**
+     *  Get the values of a property for a batch of primary variable arrays,
+     *  e.g. for all integration points of an element.
+     *  \param property_type   Property type.
+     *  \param variable_values Arrays of the primary variables, one per
+     *                         evaluation point. The order of the array
+     *                         elements is defined in enum class
+     *                         PropertyVariableType.
+     *  \param values          Computed property values. The vector is resized
+     *                         to the size of \c variable_values.
+     */
+    virtual void getValues(const FluidPropertyType property_type,
+                           std::vector<ArrayType> const& variable_values,
+                           std::vector<double>& values) const
+    {
+        _property_models[static_cast<unsigned>(property_type)]->getValues(
+            variable_values, values);
+    }
+
 protected:
     /** Fluid property models.
      *  0: density;
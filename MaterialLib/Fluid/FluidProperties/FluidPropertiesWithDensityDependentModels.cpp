@@ -55,6 +55,33 @@ double FluidPropertiesWithDensityDependentModels::getValue(
         var_vals);
 }
 
+void FluidPropertiesWithDensityDependentModels::getValues(
+    const FluidPropertyType property_type,
+    std::vector<ArrayType> const& variable_values,
+    std::vector<double>& values) const
+{
+    auto const& property_model =
+        _property_models[static_cast<unsigned>(property_type)];
+    if (!_is_density_dependent[static_cast<unsigned>(property_type)])
+    {
+        property_model->getValues(variable_values, values);
+        return;
+    }
+
+    // The density values are stored in values first and then replaced by the
+    // values of the requested property.
+    _property_models[static_cast<unsigned>(FluidPropertyType::Density)]
+        ->getValues(variable_values, values);
+
+    std::vector<ArrayType> var_vals = variable_values;
+    for (std::size_t i = 0; i < var_vals.size(); ++i)
+    {
+        var_vals[i][static_cast<unsigned>(PropertyVariableType::rho)] =
+            values[i];
+    }
+    property_model->getValues(var_vals, values);
+}
+
 double FluidPropertiesWithDensityDependentModels::getdValue(
     const FluidPropertyType property_type,
     const ArrayType& variable_values,
@@ -66,6 +66,16 @@ public:
                      const ArrayType& variable_values,
                      const PropertyVariableType variable_type) const override;
 
+    /**
+     *  Get the values of a property for a batch of primary variable arrays.
+     *  For density dependent models the densities are evaluated for the whole
+     *  batch first.
+     *  \copydetails FluidProperties::getValues()
+     */
+    void getValues(const FluidPropertyType property_type,
+                   std::vector<ArrayType> const& variable_values,
+                   std::vector<double>& values) const override;
+
 private:
     /// Compute df/dT for f(T, rho) with rho(T, p)
     double compute_df_drho_drho_dT(const FluidPropertyType property_type,
@@ -14,6 +14,7 @@
 
 #include <array>
 #include <string>
+#include <vector>
 
 #include "PropertyVariableType.h"
 
@@ -43,6 +44,37 @@ public:
     /// derivative to be calculated.
     virtual double getdValue(const ArrayType& /* var_vals*/,
                              const PropertyVariableType /* var */) const = 0;
+
+    /// Checks whether the property depends on the concentration. Such
+    /// properties cannot be tabulated, see TabulatedFluidProperty.
+    virtual bool dependsOnConcentration() const { return false; }
+
+    /// Get property values for a batch of variable arrays, e.g. for all
+    /// integration points of an element, with a single virtual call.
+    /// \param var_vals Variable values, one array per evaluation point.
+    /// \param values   Computed property values. The vector is resized to
+    ///                 the size of \c var_vals.
+    ///
+    /// The default implementation calls getValue() for each entry. Models
+    /// with expensive evaluations override it.
+    virtual void getValues(std::vector<ArrayType> const& var_vals,
+                           std::vector<double>& values) const
+    {
+        values.resize(var_vals.size());
+        for (std::size_t i = 0; i < var_vals.size(); ++i)
+            values[i] = getValue(var_vals[i]);
+    }
+
+    /// Get the partial differentials of the property for a batch of variable
+    /// arrays. See getValues() and getdValue().
+    virtual void getdValues(std::vector<ArrayType> const& var_vals,
+                            const PropertyVariableType var,
+                            std::vector<double>& values) const
+    {
+        values.resize(var_vals.size());
+        for (std::size_t i = 0; i < var_vals.size(); ++i)
+            values[i] = getdValue(var_vals[i], var);
+    }
 };
 
 }  // end namespace
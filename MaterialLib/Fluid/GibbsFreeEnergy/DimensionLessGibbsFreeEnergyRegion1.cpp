@@ -14,8 +14,6 @@
 
 #include "DimensionLessGibbsFreeEnergyRegion1.h"
 
-#include <cmath>
-
 namespace MaterialLib
 {
 namespace Fluid
@@ -34,21 +32,59 @@ static const double ni[34] = {
     2.6335781662795E-23,  -1.1947622640071E-23, 1.8228094581404E-24,
     -9.35370872924580E-26};
 
-static const double li[34] = {0, 0, 0, 0, 0,  0,  0,  0,  1,  1, 1, 1,
-                              1, 1, 2, 2, 2,  2,  2,  3,  3,  3, 4, 4,
-                              4, 5, 8, 8, 21, 23, 29, 30, 31, 32};
+static const int li[34] = {0, 0, 0, 0, 0,  0,  0,  0,  1,  1, 1, 1,
+                           1, 1, 2, 2, 2,  2,  2,  3,  3,  3, 4, 4,
+                           4, 5, 8, 8, 21, 23, 29, 30, 31, 32};
 
-static const double ji[34] = {
+static const int ji[34] = {
     -2, -1, 0,  1, 2, 3,  4,  5,  -9, -7,  -1, 0,   1,   3,   -3,  0,   1,
     3,  17, -4, 0, 6, -5, -2, 10, -8, -11, -6, -29, -31, -38, -39, -40, -41};
 
+namespace
+{
+/// Integer powers \f$x^k\f$ for \f$k \in [k_{min}, k_{max}]\f$ computed by
+/// successive multiplications, which is much cheaper than calling std::pow
+/// for each of the 34 terms of the series.
+template <int k_min, int k_max>
+class IntegerPowers
+{
+public:
+    explicit IntegerPowers(const double x)
+    {
+        _powers[-k_min] = 1.0;
+        for (int k = 1; k <= k_max; k++)
+        {
+            _powers[k - k_min] = _powers[k - 1 - k_min] * x;
+        }
+        const double inv_x = 1.0 / x;
+        for (int k = -1; k >= k_min; k--)
+        {
+            _powers[k - k_min] = _powers[k + 1 - k_min] * inv_x;
+        }
+    }
+
+    double operator[](const int k) const { return _powers[k - k_min]; }
+
+private:
+    double _powers[k_max - k_min + 1];
+};
+
+/// Powers of \f$(7.1-\pi)\f$ for the exponents \f$l_i-2 \ldots l_i\f$.
+using PiPowers = IntegerPowers<-2, 32>;
+/// Powers of \f$(\tau-1.222)\f$ for the exponents \f$j_i-2 \ldots j_i\f$.
+using TauPowers = IntegerPowers<-43, 17>;
+}  // namespace
+
 double DimensionLessGibbsFreeEnergyRegion1::get_gamma(const double tau,
                                                       const double pi) const
 {
+    const PiPowers pi_powers(7.1 - pi);
+    const TauPowers tau_powers(tau - 1.222);
+
     double val = 0.;
     for (int i = 0; i < 34; i++)
     {
-        val += ni[i] * std::pow(7.1 - pi, li[i]) * std::pow(tau - 1.222, ji[i]);
+        val += ni[i] * pi_powers[li[i]] * tau_powers[ji[i]];
     }
 
     return val;
@@ -57,11 +93,13 @@ double DimensionLessGibbsFreeEnergyRegion1::get_gamma(const double tau,
 double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dtau(
     const double tau, const double pi) const
 {
+    const PiPowers pi_powers(7.1 - pi);
+    const TauPowers tau_powers(tau - 1.222);
+
     double val = 0.;
     for (int i = 0; i < 34; i++)
     {
-        val += ni[i] * ji[i] * std::pow(7.1 - pi, li[i]) *
-               std::pow(tau - 1.222, ji[i] - 1.0);
+        val += ni[i] * ji[i] * pi_powers[li[i]] * tau_powers[ji[i] - 1];
     }
 
     return val;
@@ -70,11 +108,14 @@ double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dtau(
 double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dtau_dtau(
     const double tau, const double pi) const
 {
+    const PiPowers pi_powers(7.1 - pi);
+    const TauPowers tau_powers(tau - 1.222);
+
     double val = 0.;
     for (int i = 0; i < 34; i++)
     {
-        val += ni[i] * ji[i] * (ji[i] - 1.0) * std::pow(7.1 - pi, li[i]) *
-               std::pow(tau - 1.222, ji[i] - 2.0);
+        val += ni[i] * ji[i] * (ji[i] - 1.0) * pi_powers[li[i]] *
+               tau_powers[ji[i] - 2];
     }
 
     return val;
@@ -83,11 +124,13 @@ double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dtau_dtau(
 double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dpi(
     const double tau, const double pi) const
 {
+    const PiPowers pi_powers(7.1 - pi);
+    const TauPowers tau_powers(tau - 1.222);
+
     double val = 0.;
     for (int i = 0; i < 34; i++)
     {
-        val -= ni[i] * li[i] * std::pow(7.1 - pi, li[i] - 1.0) *
-               std::pow(tau - 1.222, ji[i]);
+        val -= ni[i] * li[i] * pi_powers[li[i] - 1] * tau_powers[ji[i]];
     }
 
     return val;
@@ -96,11 +139,14 @@ double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dpi(
 double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dpi_dpi(
     const double tau, const double pi) const
 {
+    const PiPowers pi_powers(7.1 - pi);
+    const TauPowers tau_powers(tau - 1.222);
+
     double val = 0.;
     for (int i = 0; i < 34; i++)
     {
-        val += ni[i] * li[i] * (li[i] - 1.0) * std::pow(7.1 - pi, li[i] - 2.0) *
-               std::pow(tau - 1.222, ji[i]);
+        val += ni[i] * li[i] * (li[i] - 1.0) * pi_powers[li[i] - 2] *
+               tau_powers[ji[i]];
     }
 
     return val;
@@ -109,11 +155,14 @@ double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dpi_dpi(
 double DimensionLessGibbsFreeEnergyRegion1::get_dgamma_dtau_dpi(
     const double tau, const double pi) const
 {
+    const PiPowers pi_powers(7.1 - pi);
+    const TauPowers tau_powers(tau - 1.222);
+
     double val = 0.;
     for (int i = 0; i < 34; i++)
     {
-        val -= ni[i] * ji[i] * li[i] * std::pow(7.1 - pi, li[i] - 1.0) *
-               std::pow(tau - 1.222, ji[i] - 1.0);
+        val -= ni[i] * ji[i] * li[i] * pi_powers[li[i] - 1] *
+               tau_powers[ji[i] - 1];
     }
 
     return val;
@@ -0,0 +1,116 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "TabulatedFluidProperty.h"
+
+#include <cmath>
+#include <limits>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/Error.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+TabulatedFluidProperty::TabulatedFluidProperty(
+    std::unique_ptr<FluidProperty>&& property, double const T_min,
+    double const T_max, std::size_t n_T, double const p_min,
+    double const p_max, std::size_t n_p, double const tolerance,
+    std::size_t const max_number_of_nodes)
+    : _property(std::move(property))
+{
+    // Guards the relative error against division by vanishing values.
+    double const value_scale = std::numeric_limits<double>::min();
+
+    auto const value = [this](double const T, double const p) {
+        ArrayType vars = {{T, p, 0.0}};
+        return _property->getValue(vars);
+    };
+
+    while (true)
+    {
+        _table = createTable(T_min, T_max, n_T, p_min, p_max, n_p);
+        _max_relative_error =
+            _table->getMaximumRelativeError(value, value_scale);
+        if (_max_relative_error <= tolerance)
+            break;
+
+        n_T = 2 * n_T - 1;
+        n_p = 2 * n_p - 1;
+        if (n_T * n_p > max_number_of_nodes)
+            OGS_FATAL(
+                "The tabulation of the fluid property '%s' does not reach the "
+                "relative tolerance %g with at most %d nodes; the maximum "
+                "relative error is %g.",
+                _property->getName().c_str(), tolerance, max_number_of_nodes,
+                _max_relative_error);
+    }
+
+    INFO(
+        "Tabulated fluid property '%s' on %d x %d nodes, maximum relative "
+        "error %g.",
+        _property->getName().c_str(), n_T, n_p, _max_relative_error);
+}
+
+std::unique_ptr<MathLib::BicubicHermiteInterpolation>
+TabulatedFluidProperty::createTable(double const T_min, double const T_max,
+                                    std::size_t const n_T, double const p_min,
+                                    double const p_max,
+                                    std::size_t const n_p) const
+{
+    return std::make_unique<MathLib::BicubicHermiteInterpolation>(
+        T_min, T_max, n_T, p_min, p_max, n_p,
+        [this](double const T, double const p) -> std::array<double, 3> {
+            ArrayType vars = {{T, p, 0.0}};
+            return {{_property->getValue(vars),
+                     _property->getdValue(vars, PropertyVariableType::T),
+                     _property->getdValue(vars, PropertyVariableType::p)}};
+        });
+}
+
+double TabulatedFluidProperty::getValue(const ArrayType& var_vals) const
+{
+    double const T = var_vals[static_cast<int>(PropertyVariableType::T)];
+    double const p = var_vals[static_cast<int>(PropertyVariableType::p)];
+    if (!_table->contains(T, p))
+        return _property->getValue(var_vals);
+    return _table->getValue(T, p);
+}
+
+double TabulatedFluidProperty::getdValue(const ArrayType& var_vals,
+                                         const PropertyVariableType var) const
+{
+    double const T = var_vals[static_cast<int>(PropertyVariableType::T)];
+    double const p = var_vals[static_cast<int>(PropertyVariableType::p)];
+    if (!_table->contains(T, p))
+        return _property->getdValue(var_vals, var);
+
+    switch (var)
+    {
+        case PropertyVariableType::T:
+            return _table->getDerivativeX(T, p);
+        case PropertyVariableType::p:
+            return _table->getDerivativeY(T, p);
+        default:
+            return 0.0;
+    }
+}
+
+void TabulatedFluidProperty::getValues(std::vector<ArrayType> const& var_vals,
+                                       std::vector<double>& values) const
+{
+    values.resize(var_vals.size());
+    for (std::size_t i = 0; i < var_vals.size(); ++i)
+        values[i] = TabulatedFluidProperty::getValue(var_vals[i]);
+}
+
+}  // end namespace
+}  // end namespace
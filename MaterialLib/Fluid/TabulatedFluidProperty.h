@@ -0,0 +1,81 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "MathLib/InterpolationAlgorithms/BicubicHermiteInterpolation.h"
+
+#include "FluidProperty.h"
+
+namespace MaterialLib
+{
+namespace Fluid
+{
+/**
+ * Replaces an expensive fluid property model, e.g. one of the IAPWS
+ * formulations, by a table of its values and first derivatives over
+ * temperature and pressure.
+ *
+ * Within the tabulated range, values and derivatives are obtained by bicubic
+ * Hermite interpolation. Outside of that range the wrapped model is
+ * evaluated. Models depending on the concentration, see
+ * FluidProperty::dependsOnConcentration(), are rejected by
+ * createTabulatedFluidProperty().
+ *
+ * For density dependent models, the pressure axis of the table is the
+ * density, see PropertyVariableType::rho.
+ */
+class TabulatedFluidProperty final : public FluidProperty
+{
+public:
+    /**
+     * Tabulates \c property on a grid of \c n_T times \c n_p nodes. If the
+     * relative interpolation error, sampled at the cell centres, exceeds
+     * \c tolerance, the grid is refined until the tolerance is met or the
+     * table would exceed \c max_number_of_nodes nodes, in which case the
+     * construction fails.
+     */
+    TabulatedFluidProperty(std::unique_ptr<FluidProperty>&& property,
+                           double T_min, double T_max, std::size_t n_T,
+                           double p_min, double p_max, std::size_t n_p,
+                           double tolerance,
+                           std::size_t max_number_of_nodes = 1000000);
+
+    std::string getName() const override
+    {
+        return _property->getName() + " (tabulated)";
+    }
+
+    double getValue(const ArrayType& var_vals) const override;
+
+    double getdValue(const ArrayType& var_vals,
+                     const PropertyVariableType var) const override;
+
+    void getValues(std::vector<ArrayType> const& var_vals,
+                   std::vector<double>& values) const override;
+
+    /// Maximum relative interpolation error at the cell centres of the table.
+    double getMaximumRelativeError() const { return _max_relative_error; }
+
+private:
+    std::unique_ptr<MathLib::BicubicHermiteInterpolation> createTable(
+        double T_min, double T_max, std::size_t n_T, double p_min,
+        double p_max, std::size_t n_p) const;
+
+    std::unique_ptr<FluidProperty> const _property;
+    std::unique_ptr<MathLib::BicubicHermiteInterpolation> _table;
+    double _max_relative_error = 0;
+};
+
+}  // end namespace
+}  // end namespace
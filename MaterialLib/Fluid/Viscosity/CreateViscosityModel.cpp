@@ -16,6 +16,7 @@
 #include "BaseLib/Error.h"
 
 #include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/CreateTabulatedFluidProperty.h"
 #include "LinearPressureDependentViscosity.h"
 #include "TemperatureDependentViscosity.h"
 #include "VogelsLiquidDynamicViscosity.h"
@@ -71,7 +72,7 @@ static std::unique_ptr<FluidProperty> createTemperatureDependentViscosity(
     return std::make_unique<TemperatureDependentViscosity>(mu0, Tc, Tv);
 }
 
-std::unique_ptr<FluidProperty> createViscosityModel(
+static std::unique_ptr<FluidProperty> createUntabulatedViscosityModel(
     BaseLib::ConfigTree const& config)
 {
     //! \ogs_file_param{material__fluid__viscosity__type}
@@ -146,5 +147,19 @@ std::unique_ptr<FluidProperty> createViscosityModel(
         type.data());
 }
 
+std::unique_ptr<FluidProperty> createViscosityModel(
+    BaseLib::ConfigTree const& config)
+{
+    auto const tabulation_config =
+        //! \ogs_file_param{material__fluid__viscosity__tabulation}
+        config.getConfigSubtreeOptional("tabulation");
+
+    auto viscosity = createUntabulatedViscosityModel(config);
+    if (tabulation_config)
+        return createTabulatedFluidProperty(*tabulation_config,
+                                            std::move(viscosity));
+    return viscosity;
+}
+
 }  // end namespace
 }  // end namespace
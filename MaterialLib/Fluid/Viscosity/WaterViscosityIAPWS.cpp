@@ -56,6 +56,16 @@ double WaterViscosityIAPWS::getValue(const ArrayType& var_vals) const
     return mu0 * mu1 * _ref_mu;
 }
 
+void WaterViscosityIAPWS::getValues(std::vector<ArrayType> const& var_vals,
+                                    std::vector<double>& values) const
+{
+    values.resize(var_vals.size());
+    for (std::size_t i = 0; i < var_vals.size(); ++i)
+    {
+        values[i] = WaterViscosityIAPWS::getValue(var_vals[i]);
+    }
+}
+
 double WaterViscosityIAPWS::getdValue(const ArrayType& var_vals,
                                       const PropertyVariableType var_type) const
 {
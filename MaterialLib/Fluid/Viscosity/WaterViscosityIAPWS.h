@@ -74,6 +74,11 @@ public:
     double getdValue(const ArrayType& var_vals,
                      const PropertyVariableType var_type) const override;
 
+    /// Get viscosity values for a batch of temperature and density pairs
+    /// without virtual calls per entry.
+    void getValues(std::vector<ArrayType> const& var_vals,
+                   std::vector<double>& values) const override;
+
 private:
     const double _ref_T = 647.096;  ///< reference temperature in K
     const double _ref_rho = 322.0;  ///< reference density in `kg/m^3`
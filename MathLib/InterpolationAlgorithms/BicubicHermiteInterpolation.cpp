@@ -0,0 +1,185 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BicubicHermiteInterpolation.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "BaseLib/Error.h"
+
+namespace
+{
+/// Cubic Hermite basis functions on \f$[0, 1]\f$ ordered as value at the left
+/// node, value at the right node, slope at the left node, slope at the right
+/// node. The slope functions are scaled by the cell width \c h.
+std::array<double, 4> hermiteBasis(double const t, double const h)
+{
+    double const t2 = t * t;
+    double const t3 = t2 * t;
+    return {{2 * t3 - 3 * t2 + 1, -2 * t3 + 3 * t2, h * (t3 - 2 * t2 + t),
+             h * (t3 - t2)}};
+}
+
+/// Derivatives of hermiteBasis() with respect to the global coordinate.
+std::array<double, 4> hermiteBasisDerivative(double const t, double const h)
+{
+    double const t2 = t * t;
+    return {{(6 * t2 - 6 * t) / h, (-6 * t2 + 6 * t) / h, 3 * t2 - 4 * t + 1,
+             3 * t2 - 2 * t}};
+}
+
+/// Checks the grid range and the number of grid nodes \c n in one direction
+/// before the grid spacing is computed from them, and returns \c n.
+std::size_t checkGrid(double const min, double const max, std::size_t const n,
+                      char const direction)
+{
+    if (n < 2)
+        OGS_FATAL(
+            "Bicubic Hermite interpolation needs at least two grid nodes in "
+            "each direction, but %zu nodes were given in %c-direction.",
+            n, direction);
+    if (!(min < max))
+        OGS_FATAL(
+            "Bicubic Hermite interpolation: invalid grid range [%g, %g] in "
+            "%c-direction.",
+            min, max, direction);
+    return n;
+}
+}  // namespace
+
+namespace MathLib
+{
+BicubicHermiteInterpolation::BicubicHermiteInterpolation(
+    double const x_min, double const x_max, std::size_t const n_x,
+    double const y_min, double const y_max, std::size_t const n_y,
+    FunctionWithDerivatives const& f)
+    : _x_min(x_min),
+      _x_max(x_max),
+      _y_min(y_min),
+      _y_max(y_max),
+      _n_x(checkGrid(x_min, x_max, n_x, 'x')),
+      _n_y(checkGrid(y_min, y_max, n_y, 'y')),
+      _dx((x_max - x_min) / (n_x - 1.0)),
+      _dy((y_max - y_min) / (n_y - 1.0))
+{
+    std::size_t const n = _n_x * _n_y;
+    _f.resize(n);
+    _fx.resize(n);
+    _fy.resize(n);
+    _fxy.resize(n);
+
+    for (std::size_t i = 0; i < _n_x; ++i)
+    {
+        double const x = i + 1 == _n_x ? _x_max : _x_min + i * _dx;
+        for (std::size_t j = 0; j < _n_y; ++j)
+        {
+            double const y = j + 1 == _n_y ? _y_max : _y_min + j * _dy;
+            auto const values = f(x, y);
+            auto const k = index(i, j);
+            _f[k] = values[0];
+            _fx[k] = values[1];
+            _fy[k] = values[2];
+        }
+    }
+
+    // The mixed derivative is the mean of the finite difference quotients of
+    // the tabulated first derivatives; one-sided at the boundary of the grid.
+    for (std::size_t i = 0; i < _n_x; ++i)
+    {
+        std::size_t const i0 = i == 0 ? 0 : i - 1;
+        std::size_t const i1 = std::min(i + 1, _n_x - 1);
+        for (std::size_t j = 0; j < _n_y; ++j)
+        {
+            std::size_t const j0 = j == 0 ? 0 : j - 1;
+            std::size_t const j1 = std::min(j + 1, _n_y - 1);
+            double const dfy_dx =
+                (_fy[index(i1, j)] - _fy[index(i0, j)]) / ((i1 - i0) * _dx);
+            double const dfx_dy =
+                (_fx[index(i, j1)] - _fx[index(i, j0)]) / ((j1 - j0) * _dy);
+            _fxy[index(i, j)] = 0.5 * (dfy_dx + dfx_dy);
+        }
+    }
+}
+
+BicubicHermiteInterpolation::Cell BicubicHermiteInterpolation::locate(
+    double const x, double const y) const
+{
+    double const sx = (x - _x_min) / _dx;
+    double const sy = (y - _y_min) / _dy;
+    // Points on the upper boundary belong to the last cell.
+    auto const i = std::min(static_cast<std::size_t>(std::max(sx, 0.0)),
+                            _n_x - 2);
+    auto const j = std::min(static_cast<std::size_t>(std::max(sy, 0.0)),
+                            _n_y - 2);
+    return {i, j, sx - i, sy - j};
+}
+
+double BicubicHermiteInterpolation::evaluate(
+    Cell const& cell, std::array<double, 4> const& hx,
+    std::array<double, 4> const& hy) const
+{
+    double result = 0;
+    for (std::size_t a = 0; a < 2; ++a)
+    {
+        for (std::size_t b = 0; b < 2; ++b)
+        {
+            auto const k = index(cell.i + a, cell.j + b);
+            result += _f[k] * hx[a] * hy[b] + _fx[k] * hx[2 + a] * hy[b] +
+                      _fy[k] * hx[a] * hy[2 + b] +
+                      _fxy[k] * hx[2 + a] * hy[2 + b];
+        }
+    }
+    return result;
+}
+
+double BicubicHermiteInterpolation::getValue(double const x,
+                                             double const y) const
+{
+    auto const cell = locate(x, y);
+    return evaluate(cell, hermiteBasis(cell.tx, _dx),
+                    hermiteBasis(cell.ty, _dy));
+}
+
+double BicubicHermiteInterpolation::getDerivativeX(double const x,
+                                                   double const y) const
+{
+    auto const cell = locate(x, y);
+    return evaluate(cell, hermiteBasisDerivative(cell.tx, _dx),
+                    hermiteBasis(cell.ty, _dy));
+}
+
+double BicubicHermiteInterpolation::getDerivativeY(double const x,
+                                                   double const y) const
+{
+    auto const cell = locate(x, y);
+    return evaluate(cell, hermiteBasis(cell.tx, _dx),
+                    hermiteBasisDerivative(cell.ty, _dy));
+}
+
+double BicubicHermiteInterpolation::getMaximumRelativeError(
+    std::function<double(double, double)> const& f, double const f_scale) const
+{
+    double max_error = 0;
+    for (std::size_t i = 0; i + 1 < _n_x; ++i)
+    {
+        double const x = _x_min + (i + 0.5) * _dx;
+        for (std::size_t j = 0; j + 1 < _n_y; ++j)
+        {
+            double const y = _y_min + (j + 0.5) * _dy;
+            double const f_exact = f(x, y);
+            double const error = std::abs(getValue(x, y) - f_exact) /
+                                 std::max(std::abs(f_exact), f_scale);
+            max_error = std::max(max_error, error);
+        }
+    }
+    return max_error;
+}
+
+}  // end namespace MathLib
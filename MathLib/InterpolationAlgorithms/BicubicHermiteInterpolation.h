@@ -0,0 +1,107 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+namespace MathLib
+{
+/**
+ * Piecewise bicubic Hermite interpolation of a function \f$f(x, y)\f$
+ * tabulated on a uniform rectangular grid.
+ *
+ * The values \f$f\f$ and the partial derivatives \f$f_x\f$ and \f$f_y\f$ are
+ * tabulated at the grid nodes; the mixed derivative \f$f_{xy}\f$ is obtained
+ * by finite differences of the tabulated \f$f_y\f$. The interpolant is
+ * \f$C^1\f$ continuous, and its partial derivatives, which are returned by
+ * getDerivativeX() and getDerivativeY(), are consistent with getValue().
+ *
+ * Since the grid is uniform, the cell containing a point is found in constant
+ * time. The class has no mutable state and can be used concurrently.
+ */
+class BicubicHermiteInterpolation final
+{
+public:
+    /// Function returning \f$(f, f_x, f_y)\f$ at a given point \f$(x, y)\f$.
+    using FunctionWithDerivatives =
+        std::function<std::array<double, 3>(double x, double y)>;
+
+    /**
+     * Tabulates the given function on the grid
+     * \f$[x_{\min}, x_{\max}] \times [y_{\min}, y_{\max}]\f$ with \c n_x times
+     * \c n_y nodes. At least two nodes are required in each direction.
+     */
+    BicubicHermiteInterpolation(double x_min, double x_max, std::size_t n_x,
+                                double y_min, double y_max, std::size_t n_y,
+                                FunctionWithDerivatives const& f);
+
+    /// Returns whether the point is covered by the table.
+    bool contains(double const x, double const y) const
+    {
+        return _x_min <= x && x <= _x_max && _y_min <= y && y <= _y_max;
+    }
+
+    /// Interpolated value at the given point, which has to be covered by the
+    /// table, see contains().
+    double getValue(double x, double y) const;
+
+    /// Partial derivative \f$\partial f / \partial x\f$ of the interpolant.
+    double getDerivativeX(double x, double y) const;
+
+    /// Partial derivative \f$\partial f / \partial y\f$ of the interpolant.
+    double getDerivativeY(double x, double y) const;
+
+    /// Returns the maximum relative deviation of the interpolant from the
+    /// given function, sampled at the centres of all grid cells. The relative
+    /// error is taken with respect to \f$\max(|f|, f_{\mathrm{scale}})\f$.
+    double getMaximumRelativeError(
+        std::function<double(double, double)> const& f, double f_scale) const;
+
+private:
+    /// Grid cell containing a point and the local coordinates of the point.
+    struct Cell
+    {
+        std::size_t i;
+        std::size_t j;
+        double tx;  ///< Local coordinate in x direction, \f$\in [0, 1]\f$.
+        double ty;  ///< Local coordinate in y direction, \f$\in [0, 1]\f$.
+    };
+
+    Cell locate(double x, double y) const;
+
+    /// Evaluates the interpolant in the given cell with the given Hermite
+    /// basis functions in x and y direction.
+    double evaluate(Cell const& cell, std::array<double, 4> const& hx,
+                    std::array<double, 4> const& hy) const;
+
+    std::size_t index(std::size_t const i, std::size_t const j) const
+    {
+        return i * _n_y + j;
+    }
+
+    double const _x_min;
+    double const _x_max;
+    double const _y_min;
+    double const _y_max;
+    std::size_t const _n_x;
+    std::size_t const _n_y;
+    double const _dx;
+    double const _dy;
+
+    std::vector<double> _f;
+    std::vector<double> _fx;
+    std::vector<double> _fy;
+    std::vector<double> _fxy;
+};
+
+}  // end namespace MathLib
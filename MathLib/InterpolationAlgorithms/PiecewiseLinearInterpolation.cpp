@@ -11,6 +11,7 @@
  *              http://www.opengeosys.org/project/license
  *
  */
+#include <algorithm>
 #include <cmath>
 #include <limits>
 #include <utility>
@@ -45,24 +46,64 @@ PiecewiseLinearInterpolation::PiecewiseLinearInterpolation(
             "Piecewise linear interpolation is not possible\n",
             i, i + 1);
     }
+
+    initializeLookupGrid();
 }
 
-double PiecewiseLinearInterpolation::getValue(double pnt_to_interpolate) const
+void PiecewiseLinearInterpolation::initializeLookupGrid()
 {
-    // search interval that has the point inside
-    if (pnt_to_interpolate <= _supp_pnts.front())
+    if (_supp_pnts.size() < 2)
+        return;
+
+    // One cell per interval; for uniformly spaced support points each cell
+    // then contains one support point and the lookup is a direct access.
+    std::size_t const n_cells = _supp_pnts.size() - 1;
+    double const x_min = _supp_pnts.front();
+    double const cell_size = (_supp_pnts.back() - x_min) / n_cells;
+    _inverse_lookup_cell_size = 1.0 / cell_size;
+
+    _lookup_grid.resize(n_cells);
+    std::size_t j = 0;
+    for (std::size_t cell = 0; cell < n_cells; ++cell)
     {
-        return _values_at_supp_pnts[0];
+        double const cell_min = x_min + cell * cell_size;
+        while (j + 1 < _supp_pnts.size() && _supp_pnts[j] < cell_min)
+            ++j;
+        _lookup_grid[cell] = j;
     }
+}
 
-    if (_supp_pnts.back() <= pnt_to_interpolate)
-    {
-        return _values_at_supp_pnts[_supp_pnts.size() - 1];
-    }
+std::size_t PiecewiseLinearInterpolation::findSupportPoint(
+    double const pnt) const
+{
+    auto const cell = std::min(
+        static_cast<std::size_t>((pnt - _supp_pnts.front()) *
+                                 _inverse_lookup_cell_size),
+        _lookup_grid.size() - 1);
+
+    // The result lies between the first support points of this and of the
+    // next cell. A binary search in this range keeps the lookup fast also for
+    // clustered support points.
+    std::size_t const first = _lookup_grid[cell];
+    std::size_t const last = cell + 1 < _lookup_grid.size()
+                                 ? _lookup_grid[cell + 1]
+                                 : _supp_pnts.size() - 1;
+
+    // Round-off in the cell computation might miss the range.
+    if ((first > 0 && _supp_pnts[first - 1] >= pnt) || _supp_pnts[last] < pnt)
+        return std::distance(
+            _supp_pnts.begin(),
+            std::lower_bound(_supp_pnts.begin(), _supp_pnts.end(), pnt));
+
+    return std::distance(_supp_pnts.begin(),
+                         std::lower_bound(_supp_pnts.begin() + first,
+                                          _supp_pnts.begin() + last + 1, pnt));
+}
 
-    auto const& it(std::lower_bound(_supp_pnts.begin(), _supp_pnts.end(),
-                                    pnt_to_interpolate));
-    std::size_t const interval_idx = std::distance(_supp_pnts.begin(), it) - 1;
+double PiecewiseLinearInterpolation::interpolate(
+    std::size_t const interval_end, double const pnt_to_interpolate) const
+{
+    std::size_t const interval_idx = interval_end - 1;
 
     // support points.
     double const x = _supp_pnts[interval_idx];
@@ -78,6 +119,52 @@ double PiecewiseLinearInterpolation::getValue(double pnt_to_interpolate) const
     return m * (pnt_to_interpolate - x) + f;
 }
 
+double PiecewiseLinearInterpolation::getValue(double pnt_to_interpolate) const
+{
+    // search interval that has the point inside
+    if (pnt_to_interpolate <= _supp_pnts.front())
+    {
+        return _values_at_supp_pnts[0];
+    }
+
+    if (_supp_pnts.back() <= pnt_to_interpolate)
+    {
+        return _values_at_supp_pnts[_supp_pnts.size() - 1];
+    }
+
+    return interpolate(findSupportPoint(pnt_to_interpolate),
+                       pnt_to_interpolate);
+}
+
+void PiecewiseLinearInterpolation::getValues(
+    std::vector<double> const& pnts_to_interpolate,
+    std::vector<double>& values) const
+{
+    values.resize(pnts_to_interpolate.size());
+
+    // End of the interval of the previous point; zero if there is none.
+    std::size_t interval_end = 0;
+    for (std::size_t i = 0; i < pnts_to_interpolate.size(); ++i)
+    {
+        double const pnt = pnts_to_interpolate[i];
+        if (pnt <= _supp_pnts.front())
+        {
+            values[i] = _values_at_supp_pnts.front();
+            continue;
+        }
+        if (_supp_pnts.back() <= pnt)
+        {
+            values[i] = _values_at_supp_pnts.back();
+            continue;
+        }
+
+        if (interval_end == 0 || !(_supp_pnts[interval_end - 1] < pnt &&
+                                   pnt <= _supp_pnts[interval_end]))
+            interval_end = findSupportPoint(pnt);
+        values[i] = interpolate(interval_end, pnt);
+    }
+}
+
 double PiecewiseLinearInterpolation::getDerivative(
     double const pnt_to_interpolate) const
 {
@@ -87,9 +174,7 @@ double PiecewiseLinearInterpolation::getDerivative(
         return 0;
     }
 
-    auto const& it(std::lower_bound(_supp_pnts.begin(), _supp_pnts.end(),
-                                    pnt_to_interpolate));
-    std::size_t interval_idx = std::distance(_supp_pnts.begin(), it);
+    std::size_t interval_idx = findSupportPoint(pnt_to_interpolate);
 
     if (pnt_to_interpolate == _supp_pnts.front())
     {
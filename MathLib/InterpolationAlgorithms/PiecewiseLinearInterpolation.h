@@ -72,11 +72,44 @@ public:
      * using linear interpolation.
      */
     double getDerivative(double const pnt_to_interpolate) const;
+
+    /**
+     * \brief Calculates the interpolation values for a batch of points.
+     * The result is the same as calling getValue() for each point; points
+     * falling into the same interval as their predecessor, e.g. for sorted
+     * input, are located without a search.
+     * @param pnts_to_interpolate The points to interpolate at.
+     * @param values The interpolated values, resized to the number of points.
+     */
+    void getValues(std::vector<double> const& pnts_to_interpolate,
+                   std::vector<double>& values) const;
+
     double getSupportMax() const;
     double getSupportMin() const;
 
 protected:
     std::vector<double> _supp_pnts;
     std::vector<double> _values_at_supp_pnts;
+
+private:
+    /// Sets up the uniform lookup grid used by findSupportPoint().
+    void initializeLookupGrid();
+
+    /// Returns the index of the first support point not less than the given
+    /// point, i.e., the same result as std::lower_bound. The search is
+    /// restricted to the support points of the uniform lookup grid cell
+    /// containing the point, which makes it constant time for evenly spaced
+    /// support points. The point must lie within the support range.
+    std::size_t findSupportPoint(double const pnt) const;
+
+    /// Linear interpolation in the interval ending at the support point with
+    /// the given index.
+    double interpolate(std::size_t const interval_end,
+                       double const pnt_to_interpolate) const;
+
+    /// For each cell of the uniform lookup grid, the index of the first
+    /// support point not less than the lower bound of the cell.
+    std::vector<std::size_t> _lookup_grid;
+    double _inverse_lookup_cell_size = 0;
 };
 }  // end namespace MathLib
@@ -0,0 +1,314 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <cassert>
+
+#include "BaseLib/Error.h"
+
+namespace MathLib
+{
+template <int BlockSize>
+BlockCSRMatrix<BlockSize>::BlockCSRMatrix(
+    std::vector<std::vector<IndexType>> const& block_columns)
+{
+    _row_offsets.reserve(block_columns.size() + 1);
+    _row_offsets.push_back(0);
+    for (auto columns : block_columns)
+    {
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()),
+                      columns.end());
+        _block_columns.insert(_block_columns.end(), columns.begin(),
+                              columns.end());
+        _row_offsets.push_back(static_cast<IndexType>(_block_columns.size()));
+    }
+    _blocks.resize(_block_columns.size(), Block::Zero());
+}
+
+template <int BlockSize>
+BlockCSRMatrix<BlockSize>::BlockCSRMatrix(
+    EigenMatrix::RawMatrixType const& scalar_matrix)
+{
+    using RawMatrixType = EigenMatrix::RawMatrixType;
+    static_assert(RawMatrixType::IsRowMajor,
+                  "The conversion iterates over the rows of the matrix.");
+
+    if (scalar_matrix.rows() % BlockSize != 0 ||
+        scalar_matrix.rows() != scalar_matrix.cols())
+    {
+        OGS_FATAL(
+            "Cannot convert a %ld x %ld matrix to a block matrix with block "
+            "size %d.",
+            static_cast<long>(scalar_matrix.rows()),
+            static_cast<long>(scalar_matrix.cols()), BlockSize);
+    }
+
+    IndexType const n_block_rows = scalar_matrix.rows() / BlockSize;
+    _row_offsets.reserve(n_block_rows + 1);
+    _row_offsets.push_back(0);
+    std::vector<IndexType> columns;
+    for (IndexType block_row = 0; block_row < n_block_rows; ++block_row)
+    {
+        columns.clear();
+        for (int r = 0; r < BlockSize; ++r)
+        {
+            for (RawMatrixType::InnerIterator it(scalar_matrix,
+                                                 block_row * BlockSize + r);
+                 it;
+                 ++it)
+            {
+                columns.push_back(it.col() / BlockSize);
+            }
+        }
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()),
+                      columns.end());
+        _block_columns.insert(_block_columns.end(), columns.begin(),
+                              columns.end());
+        _row_offsets.push_back(static_cast<IndexType>(_block_columns.size()));
+    }
+    _blocks.resize(_block_columns.size(), Block::Zero());
+
+    copyValues(scalar_matrix);
+}
+
+template <int BlockSize>
+bool BlockCSRMatrix<BlockSize>::copyValues(
+    EigenMatrix::RawMatrixType const& scalar_matrix)
+{
+    using RawMatrixType = EigenMatrix::RawMatrixType;
+    static_assert(RawMatrixType::IsRowMajor,
+                  "The copy iterates over the rows of the matrix.");
+
+    if (static_cast<std::size_t>(scalar_matrix.rows()) != getNumberOfRows() ||
+        scalar_matrix.rows() != scalar_matrix.cols())
+        return false;
+
+    _blocks.resize(_block_columns.size());
+    setZero();
+    for (IndexType row = 0; row < scalar_matrix.rows(); ++row)
+    {
+        IndexType const block_row = row / BlockSize;
+        IndexType const r = row % BlockSize;
+        IndexType const last = _row_offsets[block_row + 1];
+        // The columns of a row and the block columns of a block row are both
+        // sorted, hence the blocks are found in a single pass.
+        IndexType k = _row_offsets[block_row];
+        for (RawMatrixType::InnerIterator it(scalar_matrix, row); it; ++it)
+        {
+            IndexType const block_col = it.col() / BlockSize;
+            while (k < last && _block_columns[k] < block_col)
+                ++k;
+            if (k == last || _block_columns[k] != block_col)
+                return false;
+            _blocks[k](r, it.col() % BlockSize) = it.value();
+        }
+    }
+    return true;
+}
+
+template <int BlockSize>
+void BlockCSRMatrix<BlockSize>::releaseValues()
+{
+    std::vector<Block, Eigen::aligned_allocator<Block>>().swap(_blocks);
+}
+
+template <int BlockSize>
+void BlockCSRMatrix<BlockSize>::setZero()
+{
+    for (auto& block : _blocks)
+        block.setZero();
+}
+
+template <int BlockSize>
+typename BlockCSRMatrix<BlockSize>::IndexType
+BlockCSRMatrix<BlockSize>::findBlock(IndexType const block_row,
+                                     IndexType const block_col) const
+{
+    auto const first = _block_columns.begin() + _row_offsets[block_row];
+    auto const last = _block_columns.begin() + _row_offsets[block_row + 1];
+    auto const it = std::lower_bound(first, last, block_col);
+    if (it == last || *it != block_col)
+        return -1;
+    return static_cast<IndexType>(it - _block_columns.begin());
+}
+
+template <int BlockSize>
+typename BlockCSRMatrix<BlockSize>::Block&
+BlockCSRMatrix<BlockSize>::getBlockChecked(IndexType const block_row,
+                                           IndexType const block_col)
+{
+    auto const k = findBlock(block_row, block_col);
+    if (k < 0)
+    {
+        OGS_FATAL("The block (%ld, %ld) is not in the sparsity pattern.",
+                  static_cast<long>(block_row), static_cast<long>(block_col));
+    }
+    return _blocks[k];
+}
+
+template <int BlockSize>
+double BlockCSRMatrix<BlockSize>::get(IndexType const row,
+                                      IndexType const col) const
+{
+    auto const k = findBlock(row / BlockSize, col / BlockSize);
+    if (k < 0)
+        return 0;
+    return _blocks[k](row % BlockSize, col % BlockSize);
+}
+
+template <int BlockSize>
+int BlockCSRMatrix<BlockSize>::add(IndexType const row, IndexType const col,
+                                   double const val)
+{
+    getBlockChecked(row / BlockSize, col / BlockSize)(
+        row % BlockSize, col % BlockSize) += val;
+    return 0;
+}
+
+template <int BlockSize>
+void BlockCSRMatrix<BlockSize>::groupByBlocks(
+    std::vector<IndexType> const& indices,
+    std::vector<IndexType>& unique_blocks,
+    std::vector<std::size_t>& positions)
+{
+    unique_blocks.clear();
+    for (auto const i : indices)
+        unique_blocks.push_back(i / BlockSize);
+    std::sort(unique_blocks.begin(), unique_blocks.end());
+    unique_blocks.erase(
+        std::unique(unique_blocks.begin(), unique_blocks.end()),
+        unique_blocks.end());
+
+    positions.resize(indices.size());
+    for (std::size_t i = 0; i < indices.size(); ++i)
+    {
+        positions[i] =
+            std::lower_bound(unique_blocks.begin(), unique_blocks.end(),
+                             indices[i] / BlockSize) -
+            unique_blocks.begin();
+    }
+}
+
+template <int BlockSize>
+template <class T_DENSE_MATRIX>
+void BlockCSRMatrix<BlockSize>::add(
+    RowColumnIndices<IndexType> const& indices,
+    T_DENSE_MATRIX const& sub_matrix,
+    double const fkt)
+{
+    auto const& rows = indices.rows;
+    auto const& cols = indices.columns;
+    groupByBlocks(rows, _local_block_rows, _local_row_positions);
+    groupByBlocks(cols, _local_block_cols, _local_col_positions);
+
+    // Both the block columns of a block row and the local block columns are
+    // sorted, so the positions of all blocks of a block row are found in a
+    // single pass.
+    auto const n_local_block_cols = _local_block_cols.size();
+    _local_blocks.resize(_local_block_rows.size() * n_local_block_cols);
+    for (std::size_t r = 0; r < _local_block_rows.size(); ++r)
+    {
+        IndexType const block_row = _local_block_rows[r];
+        IndexType k = _row_offsets[block_row];
+        IndexType const end = _row_offsets[block_row + 1];
+        for (std::size_t c = 0; c < n_local_block_cols; ++c)
+        {
+            IndexType const block_col = _local_block_cols[c];
+            while (k < end && _block_columns[k] < block_col)
+                ++k;
+            if (k == end || _block_columns[k] != block_col)
+            {
+                OGS_FATAL(
+                    "The block (%ld, %ld) is not in the sparsity pattern.",
+                    static_cast<long>(block_row), static_cast<long>(block_col));
+            }
+            _local_blocks[r * n_local_block_cols + c] = k;
+        }
+    }
+
+    for (std::size_t i = 0; i < rows.size(); ++i)
+    {
+        auto const* const local_blocks =
+            &_local_blocks[_local_row_positions[i] * n_local_block_cols];
+        auto const r = rows[i] % BlockSize;
+        for (std::size_t j = 0; j < cols.size(); ++j)
+        {
+            _blocks[local_blocks[_local_col_positions[j]]](
+                r, cols[j] % BlockSize) += fkt * sub_matrix(i, j);
+        }
+    }
+}
+
+template <int BlockSize>
+void BlockCSRMatrix<BlockSize>::multiply(Vector const& x, Vector& y) const
+{
+    assert(static_cast<std::size_t>(x.size()) == getNumberOfColumns());
+    y.resize(getNumberOfRows());
+
+    auto const n_block_rows = static_cast<long>(getNumberOfBlockRows());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (long block_row = 0; block_row < n_block_rows; ++block_row)
+    {
+        BlockVector sum = BlockVector::Zero();
+        for (IndexType k = _row_offsets[block_row];
+             k < _row_offsets[block_row + 1];
+             ++k)
+        {
+            sum.noalias() +=
+                _blocks[k] *
+                x.template segment<BlockSize>(_block_columns[k] * BlockSize);
+        }
+        y.template segment<BlockSize>(block_row * BlockSize) = sum;
+    }
+}
+
+template <int BlockSize>
+EigenMatrix::RawMatrixType BlockCSRMatrix<BlockSize>::toScalarMatrix() const
+{
+    EigenMatrix::RawMatrixType scalar_matrix(getNumberOfRows(),
+                                             getNumberOfColumns());
+    Eigen::VectorXi row_sizes(getNumberOfRows());
+    for (std::size_t block_row = 0; block_row < getNumberOfBlockRows();
+         ++block_row)
+    {
+        row_sizes.template segment<BlockSize>(block_row * BlockSize)
+            .setConstant((_row_offsets[block_row + 1] -
+                          _row_offsets[block_row]) *
+                         BlockSize);
+    }
+    scalar_matrix.reserve(row_sizes);
+
+    for (std::size_t block_row = 0; block_row < getNumberOfBlockRows();
+         ++block_row)
+    {
+        for (int r = 0; r < BlockSize; ++r)
+        {
+            IndexType const row = block_row * BlockSize + r;
+            for (IndexType k = _row_offsets[block_row];
+                 k < _row_offsets[block_row + 1];
+                 ++k)
+            {
+                for (int c = 0; c < BlockSize; ++c)
+                {
+                    scalar_matrix.insert(row,
+                                         _block_columns[k] * BlockSize + c) =
+                        _blocks[k](r, c);
+                }
+            }
+        }
+    }
+    scalar_matrix.makeCompressed();
+    return scalar_matrix;
+}
+
+}  // namespace MathLib
@@ -0,0 +1,140 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <Eigen/Core>
+#include <Eigen/StdVector>
+
+#include "MathLib/LinAlg/RowColumnIndices.h"
+#include "EigenMatrix.h"
+
+namespace MathLib
+{
+/**
+ * Square sparse matrix stored in block compressed sparse row format.
+ *
+ * The matrix consists of dense blocks of the fixed size \c BlockSize, e.g. the
+ * displacement components of a node. Only one column index is stored per
+ * block instead of one per scalar entry, and products are computed with fixed
+ * size block kernels.
+ *
+ * The scalar index \c i belongs to the block row (block column)
+ * i / BlockSize, which is the case for global indices of a
+ * NumLib::ComponentOrder::BY_LOCATION ordered DOF table where each node
+ * carries all \c BlockSize components.
+ *
+ * The sparsity pattern is fixed at construction. Adding to an entry outside of
+ * the pattern is an error.
+ */
+template <int BlockSize>
+class BlockCSRMatrix final
+{
+public:
+    using IndexType = EigenMatrix::IndexType;
+    using Block = Eigen::Matrix<double, BlockSize, BlockSize, Eigen::RowMajor>;
+    using BlockVector = Eigen::Matrix<double, BlockSize, 1>;
+    using Vector = Eigen::VectorXd;
+
+    /// Creates a zero matrix with the given block sparsity pattern.
+    /// @param block_columns the block column indices of each block row.
+    explicit BlockCSRMatrix(
+        std::vector<std::vector<IndexType>> const& block_columns);
+
+    /// Copies a scalar matrix. The block pattern contains each block with at
+    /// least one stored entry. The number of rows must be a multiple of the
+    /// block size.
+    explicit BlockCSRMatrix(EigenMatrix::RawMatrixType const& scalar_matrix);
+
+    /// return the number of rows
+    std::size_t getNumberOfRows() const
+    {
+        return getNumberOfBlockRows() * BlockSize;
+    }
+
+    /// return the number of columns
+    std::size_t getNumberOfColumns() const { return getNumberOfRows(); }
+
+    std::size_t getNumberOfBlockRows() const { return _row_offsets.size() - 1; }
+
+    /// return the number of stored blocks
+    std::size_t getNumberOfBlocks() const { return _block_columns.size(); }
+
+    /// reset data entries to zero, the sparsity pattern is kept.
+    void setZero();
+
+    /// Overwrites the values by those of a scalar matrix, keeping the block
+    /// pattern. Returns false if the sizes differ or if an entry of the scalar
+    /// matrix is outside of the block pattern; the values are undefined then.
+    bool copyValues(EigenMatrix::RawMatrixType const& scalar_matrix);
+
+    /// Frees the memory of the values keeping only the block pattern. The
+    /// matrix must not be used until the values are set again by
+    /// copyValues().
+    void releaseValues();
+
+    /// get value. This function returns zero if the entry is not stored.
+    double get(IndexType row, IndexType col) const;
+
+    /// add a value to the given entry.
+    int add(IndexType row, IndexType col, double val);
+
+    /// Adds a local matrix at positions given by \c indices.
+    ///
+    /// The local indices are grouped by their blocks first, such that each
+    /// pair of blocks is looked up only once irrespective of the order of the
+    /// local indices.
+    template <class T_DENSE_MATRIX>
+    void add(RowColumnIndices<IndexType> const& indices,
+             T_DENSE_MATRIX const& sub_matrix,
+             double fkt = 1.0);
+
+    /// Computes y = A x.
+    void multiply(Vector const& x, Vector& y) const;
+
+    /// Copies the matrix to a scalar compressed row storage.
+    EigenMatrix::RawMatrixType toScalarMatrix() const;
+
+    /// Returns the position of the block (block_row, block_col) in the block
+    /// storage or -1 if the block is not stored.
+    IndexType findBlock(IndexType block_row, IndexType block_col) const;
+
+    std::vector<IndexType> const& getRowOffsets() const { return _row_offsets; }
+    std::vector<IndexType> const& getBlockColumns() const
+    {
+        return _block_columns;
+    }
+    Block const& getBlock(IndexType k) const { return _blocks[k]; }
+
+private:
+    Block& getBlockChecked(IndexType block_row, IndexType block_col);
+
+    /// Sorts and removes duplicates of the block indices of the given local
+    /// indices and stores the position of each local index in the unique list.
+    static void groupByBlocks(std::vector<IndexType> const& indices,
+                              std::vector<IndexType>& unique_blocks,
+                              std::vector<std::size_t>& positions);
+
+    std::vector<IndexType> _row_offsets;
+    std::vector<IndexType> _block_columns;
+    std::vector<Block, Eigen::aligned_allocator<Block>> _blocks;
+
+    // Scratch space of add(), kept to avoid allocations per local matrix.
+    std::vector<IndexType> _local_block_rows;
+    std::vector<IndexType> _local_block_cols;
+    std::vector<std::size_t> _local_row_positions;
+    std::vector<std::size_t> _local_col_positions;
+    std::vector<IndexType> _local_blocks;
+};
+
+}  // namespace MathLib
+
+#include "BlockCSRMatrix-impl.h"
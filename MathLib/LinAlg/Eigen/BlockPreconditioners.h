@@ -0,0 +1,181 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include <Eigen/LU>
+#include <Eigen/StdVector>
+
+#include "BaseLib/Error.h"
+#include "BlockCSRMatrix.h"
+
+namespace MathLib
+{
+namespace detail
+{
+template <typename Block>
+Block invertBlock(Block const& block, long const block_row)
+{
+    // The rank is determined relative to the magnitude of the entries.
+    Eigen::FullPivLU<Block> const lu(block);
+    if (!lu.isInvertible())
+    {
+        OGS_FATAL("The diagonal block of block row %ld is singular.",
+                  block_row);
+    }
+    return lu.inverse();
+}
+}  // namespace detail
+
+/// Block Jacobi preconditioner, i.e. multiplication with the inverses of the
+/// diagonal blocks of a BlockCSRMatrix.
+template <int BlockSize>
+class BlockJacobiPreconditioner final
+{
+public:
+    using Matrix = BlockCSRMatrix<BlockSize>;
+    using Vector = typename Matrix::Vector;
+
+    void compute(Matrix const& A)
+    {
+        auto const n_block_rows = A.getNumberOfBlockRows();
+        _inverse_diagonal.resize(n_block_rows);
+        for (std::size_t i = 0; i < n_block_rows; ++i)
+        {
+            auto const k = A.findBlock(i, i);
+            if (k < 0)
+                OGS_FATAL("The diagonal block of block row %ld is missing.",
+                          static_cast<long>(i));
+            _inverse_diagonal[i] =
+                detail::invertBlock(A.getBlock(k), static_cast<long>(i));
+        }
+    }
+
+    /// Computes z = M^{-1} r.
+    void apply(Vector const& r, Vector& z) const
+    {
+        z.resize(r.size());
+        auto const n_block_rows = static_cast<long>(_inverse_diagonal.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+        for (long i = 0; i < n_block_rows; ++i)
+        {
+            z.template segment<BlockSize>(i * BlockSize).noalias() =
+                _inverse_diagonal[i] *
+                r.template segment<BlockSize>(i * BlockSize);
+        }
+    }
+
+private:
+    using Block = typename Matrix::Block;
+    std::vector<Block, Eigen::aligned_allocator<Block>> _inverse_diagonal;
+};
+
+/// Incomplete block LU factorization without fill-in on the block sparsity
+/// pattern of a BlockCSRMatrix.
+template <int BlockSize>
+class BlockILU0Preconditioner final
+{
+public:
+    using Matrix = BlockCSRMatrix<BlockSize>;
+    using Vector = typename Matrix::Vector;
+    using IndexType = typename Matrix::IndexType;
+
+    void compute(Matrix const& A)
+    {
+        _row_offsets = &A.getRowOffsets();
+        _block_columns = &A.getBlockColumns();
+        auto const& offsets = *_row_offsets;
+        auto const& columns = *_block_columns;
+
+        auto const n_block_rows = A.getNumberOfBlockRows();
+        _lu.resize(A.getNumberOfBlocks());
+        for (std::size_t k = 0; k < _lu.size(); ++k)
+            _lu[k] = A.getBlock(k);
+        _diagonal.resize(n_block_rows);
+        _inverse_diagonal.resize(n_block_rows);
+
+        // Row-wise (IKJ) elimination; the rows above the current one are
+        // already factorized.
+        for (std::size_t i = 0; i < n_block_rows; ++i)
+        {
+            IndexType const row_end = offsets[i + 1];
+            IndexType k = offsets[i];
+            for (; k < row_end && columns[k] < static_cast<IndexType>(i); ++k)
+            {
+                auto const c = columns[k];
+                _lu[k] = _lu[k] * _inverse_diagonal[c];
+
+                // Update the remaining blocks of row i by row c, skipping
+                // blocks outside of the pattern.
+                IndexType m = _diagonal[c] + 1;
+                IndexType j = k + 1;
+                while (m < offsets[c + 1] && j < row_end)
+                {
+                    if (columns[m] < columns[j])
+                        ++m;
+                    else if (columns[j] < columns[m])
+                        ++j;
+                    else
+                        _lu[j++] -= _lu[k] * _lu[m++];
+                }
+            }
+            if (k == row_end || columns[k] != static_cast<IndexType>(i))
+                OGS_FATAL("The diagonal block of block row %ld is missing.",
+                          static_cast<long>(i));
+            _diagonal[i] = k;
+            _inverse_diagonal[i] =
+                detail::invertBlock(_lu[k], static_cast<long>(i));
+        }
+    }
+
+    /// Computes z = (LU)^{-1} r by forward and backward substitution.
+    void apply(Vector const& r, Vector& z) const
+    {
+        auto const& offsets = *_row_offsets;
+        auto const& columns = *_block_columns;
+        auto const n_block_rows = static_cast<IndexType>(_diagonal.size());
+
+        z = r;
+        for (IndexType i = 0; i < n_block_rows; ++i)
+        {
+            BlockVector sum = z.template segment<BlockSize>(i * BlockSize);
+            for (IndexType k = offsets[i]; k < _diagonal[i]; ++k)
+                sum.noalias() -= _lu[k] * z.template segment<BlockSize>(
+                                              columns[k] * BlockSize);
+            z.template segment<BlockSize>(i * BlockSize) = sum;
+        }
+        for (IndexType i = n_block_rows - 1; i >= 0; --i)
+        {
+            BlockVector sum = z.template segment<BlockSize>(i * BlockSize);
+            for (IndexType k = _diagonal[i] + 1; k < offsets[i + 1]; ++k)
+                sum.noalias() -= _lu[k] * z.template segment<BlockSize>(
+                                              columns[k] * BlockSize);
+            z.template segment<BlockSize>(i * BlockSize).noalias() =
+                _inverse_diagonal[i] * sum;
+        }
+    }
+
+private:
+    using Block = typename Matrix::Block;
+    using BlockVector = typename Matrix::BlockVector;
+
+    // The pattern is shared with the factorized matrix.
+    std::vector<IndexType> const* _row_offsets = nullptr;
+    std::vector<IndexType> const* _block_columns = nullptr;
+
+    std::vector<Block, Eigen::aligned_allocator<Block>> _lu;
+    std::vector<IndexType> _diagonal;
+    std::vector<Block, Eigen::aligned_allocator<Block>> _inverse_diagonal;
+};
+
+}  // namespace MathLib
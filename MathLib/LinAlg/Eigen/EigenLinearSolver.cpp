@@ -9,6 +9,11 @@
 
 #include "EigenLinearSolver.h"
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_MKL
@@ -22,9 +27,12 @@
 #endif
 
 #include "BaseLib/ConfigTree.h"
+#include "BlockCSRMatrix.h"
+#include "BlockPreconditioners.h"
 #include "EigenVector.h"
 #include "EigenMatrix.h"
 #include "EigenTools.h"
+#include "KrylovSolvers.h"
 
 #include "MathLib/LinAlg/LinearSolverOptions.h"
 
@@ -42,6 +50,15 @@ public:
 
     //! Solves the linear equation system \f$ A x = b \f$ for \f$ x \f$.
     virtual bool solve(Matrix &A, Vector const& b, Vector &x, EigenOption &opt) = 0;
+
+    //! Solves \f$ A x = b \f$ reusing the factorization or preconditioner
+    //! computed in the previous call of solve() for the same matrix \c A. By
+    //! default everything is recomputed.
+    virtual bool solveWithPreviousSetup(Matrix& A, Vector const& b, Vector& x,
+                                        EigenOption& opt)
+    {
+        return solve(A, b, x, opt);
+    }
 };
 
 namespace details
@@ -73,10 +90,191 @@ public:
         return true;
     }
 
+    bool solveWithPreviousSetup(Matrix& /*A*/, Vector const& b, Vector& x,
+                                EigenOption& opt) override
+    {
+        INFO("-> solve with %s (reusing the factorization)",
+             EigenOption::getSolverName(opt.solver_type).c_str());
+
+        x = _solver.solve(b);
+        if(_solver.info()!=Eigen::Success) {
+            ERR("Failed during Eigen linear solve");
+            return false;
+        }
+
+        return true;
+    }
+
 private:
     T_SOLVER _solver;
 };
 
+/// Direct solver factorizing a single precision copy of the matrix.
+///
+/// Double precision accuracy is recovered by iterative refinement with
+/// residuals computed in double precision. The stopping criterion and the
+/// maximum of 30 refinement steps follow LAPACK's dsgesv. If the single
+/// precision factorization fails, e.g. because entries of the matrix are out
+/// of the single precision range, or if the refinement does not converge,
+/// e.g. for a condition number beyond the single precision range, the system
+/// is factorized in double precision.
+///
+/// The symbolic analysis is reused as long as the sparsity pattern of the
+/// matrix does not change.
+class EigenMixedPrecisionSparseLUSolver final : public EigenLinearSolverBase
+{
+public:
+    bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt) override
+    {
+        INFO("-> solve with %s (mixed precision)",
+             EigenOption::getSolverName(opt.solver_type).c_str());
+        if (!A.isCompressed())
+            A.makeCompressed();
+
+        _use_double_precision = false;
+        if (!factorizeSinglePrecision(A))
+        {
+            WARN(
+                "The single precision factorization failed, factorizing in "
+                "double precision.");
+            if (!factorizeDoublePrecision(A))
+                return false;
+            return refine(A, b, x);
+        }
+
+        // Infinity norm of A, i.e. the maximum absolute row sum.
+        double a_norm = 0;
+        for (Matrix::Index row = 0; row < A.outerSize(); ++row)
+        {
+            double row_sum = 0;
+            for (Matrix::InnerIterator it(A, row); it; ++it)
+                row_sum += std::abs(it.value());
+            a_norm = std::max(a_norm, row_sum);
+        }
+        _threshold = std::sqrt(static_cast<double>(A.rows())) *
+                     std::numeric_limits<double>::epsilon() * a_norm;
+
+        return refine(A, b, x);
+    }
+
+    bool solveWithPreviousSetup(Matrix& A, Vector const& b, Vector& x,
+                                EigenOption& opt) override
+    {
+        INFO("-> solve with %s (mixed precision, reusing the factorization)",
+             EigenOption::getSolverName(opt.solver_type).c_str());
+        return refine(A, b, x);
+    }
+
+private:
+    /// Solves with the single precision factors and refines the solution. If
+    /// the refinement fails, the double precision factorization is computed
+    /// and used for this and all following solves with the same matrix.
+    bool refine(Matrix& A, Vector const& b, Vector& x)
+    {
+        if (!_use_double_precision)
+        {
+            x = solveSinglePrecision(b);
+            for (int iteration = 0; iteration < max_refinements; ++iteration)
+            {
+                Vector const r = b - A * x;
+                if (r.lpNorm<Eigen::Infinity>() <=
+                    _threshold * x.lpNorm<Eigen::Infinity>())
+                {
+                    INFO("\t refinement steps: %d", iteration);
+                    return true;
+                }
+                x += solveSinglePrecision(r);
+            }
+
+            WARN(
+                "Iterative refinement did not converge after %d steps, "
+                "factorizing in double precision.",
+                max_refinements);
+            if (!factorizeDoublePrecision(A))
+                return false;
+        }
+
+        x = _double_solver.solve(b);
+        if (_double_solver.info() != Eigen::Success)
+        {
+            ERR("Failed during Eigen linear solve");
+            return false;
+        }
+        return true;
+    }
+
+    /// Factorizes a single precision copy of A. Fails if an entry of A is
+    /// not representable in single precision or if the factorization fails.
+    bool factorizeSinglePrecision(Matrix const& A)
+    {
+        FloatMatrix const A_float = A.cast<float>();
+        if (!Eigen::Map<Eigen::VectorXf const>(A_float.valuePtr(),
+                                               A_float.nonZeros())
+                 .allFinite())
+            return false;
+
+        if (!hasSamePattern(A))
+        {
+            _solver.analyzePattern(A_float);
+            _outer_index.assign(A.outerIndexPtr(),
+                                A.outerIndexPtr() + A.outerSize() + 1);
+            _inner_index.assign(A.innerIndexPtr(),
+                                A.innerIndexPtr() + A.nonZeros());
+        }
+        _solver.factorize(A_float);
+        return _solver.info() == Eigen::Success;
+    }
+
+    /// Factorizes A in double precision, which is used for all following
+    /// solves until the next call of solve().
+    bool factorizeDoublePrecision(Matrix const& A)
+    {
+        _double_solver.compute(A);
+        if (_double_solver.info() != Eigen::Success)
+        {
+            ERR("Failed during Eigen linear solver initialization");
+            return false;
+        }
+        _use_double_precision = true;
+        return true;
+    }
+
+    using FloatMatrix = Eigen::SparseMatrix<float, Eigen::RowMajor>;
+
+    static const int max_refinements = 30;
+
+    /// Solves with the single precision factors. The right-hand side is
+    /// scaled to avoid underflow of small residuals.
+    Vector solveSinglePrecision(Vector const& r)
+    {
+        double const scale = r.lpNorm<Eigen::Infinity>();
+        if (scale == 0)
+            return Vector::Zero(r.size());
+        Eigen::VectorXf const r_float = (r / scale).cast<float>();
+        Eigen::VectorXf const d = _solver.solve(r_float);
+        return scale * d.cast<double>();
+    }
+
+    bool hasSamePattern(Matrix const& A) const
+    {
+        return static_cast<std::size_t>(A.outerSize()) + 1 ==
+                   _outer_index.size() &&
+               static_cast<std::size_t>(A.nonZeros()) == _inner_index.size() &&
+               std::equal(_outer_index.begin(), _outer_index.end(),
+                          A.outerIndexPtr()) &&
+               std::equal(_inner_index.begin(), _inner_index.end(),
+                          A.innerIndexPtr());
+    }
+
+    Eigen::SparseLU<FloatMatrix, Eigen::COLAMDOrdering<int>> _solver;
+    Eigen::SparseLU<Matrix, Eigen::COLAMDOrdering<int>> _double_solver;
+    std::vector<Matrix::Index> _outer_index;
+    std::vector<Matrix::Index> _inner_index;
+    /// Refinement stops if the residual is below this times the norm of x.
+    double _threshold = 0;
+    bool _use_double_precision = false;
+};
+
 /// Template class for Eigen iterative linear solvers
 template <class T_SOLVER>
 class EigenIterativeLinearSolver final : public EigenLinearSolverBase
@@ -99,6 +297,12 @@ public:
             return false;
         }
 
+        return solveWithPreviousSetup(A, b, x, opt);
+    }
+
+    bool solveWithPreviousSetup(Matrix& /*A*/, Vector const& b, Vector& x,
+                                EigenOption& opt) override
+    {
         x = _solver.solveWithGuess(b, x);
         INFO("\t iteration: %d/%ld", _solver.iterations(), opt.max_iterations);
         INFO("\t residual: %e\n", _solver.error());
@@ -115,6 +319,88 @@ private:
     T_SOLVER _solver;
 };
 
+/// Iterative linear solver working on a BlockCSRMatrix copy of the matrix.
+///
+/// Only the block pattern of the copy is kept across solves. The values are
+/// filled from the assembled matrix for each solve and are released
+/// afterwards, such that between the solves the copy costs one column index
+/// per block. The pattern is recreated if the pattern of the assembled matrix
+/// does not fit into it.
+template <int BlockSize, typename Precon>
+class EigenBlockIterativeLinearSolver final : public EigenLinearSolverBase
+{
+public:
+    bool solve(Matrix& A, Vector const& b, Vector& x, EigenOption& opt) override
+    {
+        INFO("-> solve with %s (precon %s, block size %d)",
+             EigenOption::getSolverName(opt.solver_type).c_str(),
+             EigenOption::getPreconName(opt.precon_type).c_str(), BlockSize);
+        if (!A.isCompressed())
+            A.makeCompressed();
+
+        if (!_block_matrix || !_block_matrix->copyValues(A))
+        {
+            DBUG("Create the block pattern of the matrix.");
+            _block_matrix = std::make_unique<BlockCSRMatrix<BlockSize>>(A);
+        }
+        auto const& block_matrix = *_block_matrix;
+        _precon.compute(block_matrix);
+
+        // Other solver types are rejected by EigenLinearSolver::setOption().
+        bool const success =
+            opt.solver_type == EigenOption::SolverType::CG
+                ? solveCG(block_matrix, _precon, b, x, opt)
+                : solveBiCGSTAB(block_matrix, _precon, b, x, opt);
+        _block_matrix->releaseValues();
+
+        if (!success)
+        {
+            ERR("Failed during Eigen linear solve");
+            return false;
+        }
+        return true;
+    }
+
+private:
+    std::unique_ptr<BlockCSRMatrix<BlockSize>> _block_matrix;
+    Precon _precon;
+};
+
+template <int BlockSize>
+std::unique_ptr<EigenLinearSolverBase> createBlockIterativeSolver(
+    EigenOption::PreconType precon_type)
+{
+    switch (precon_type)
+    {
+        case EigenOption::PreconType::NONE:
+            return std::make_unique<EigenBlockIterativeLinearSolver<
+                BlockSize, IdentityPreconditioner>>();
+        case EigenOption::PreconType::DIAGONAL:
+            return std::make_unique<EigenBlockIterativeLinearSolver<
+                BlockSize, BlockJacobiPreconditioner<BlockSize>>>();
+        case EigenOption::PreconType::ILUT:
+            return std::make_unique<EigenBlockIterativeLinearSolver<
+                BlockSize, BlockILU0Preconditioner<BlockSize>>>();
+        default:
+            OGS_FATAL("Invalid Eigen preconditioner type.");
+    }
+}
+
+std::unique_ptr<EigenLinearSolverBase> createBlockIterativeSolver(
+    EigenOption const& option)
+{
+    // The block size is checked by EigenLinearSolver::setOption().
+    switch (option.block_size)
+    {
+        case 2:
+            return createBlockIterativeSolver<2>(option.precon_type);
+        case 3:
+            return createBlockIterativeSolver<3>(option.precon_type);
+        default:
+            return createBlockIterativeSolver<4>(option.precon_type);
+    }
+}
+
 template <template <typename, typename> class Solver, typename Precon>
 std::unique_ptr<EigenLinearSolverBase> createIterativeSolver()
 {
@@ -186,6 +472,12 @@ EigenLinearSolver::EigenLinearSolver(
     //      currently is SparseLU.
     switch (_option.solver_type) {
         case EigenOption::SolverType::SparseLU: {
+            if (_option.mixed_precision)
+            {
+                _solver = std::make_unique<
+                    details::EigenMixedPrecisionSparseLUSolver>();
+                return;
+            }
             using SolverType =
                 Eigen::SparseLU<Matrix, Eigen::COLAMDOrdering<int>>;
             _solver = std::make_unique<
@@ -195,10 +487,21 @@ EigenLinearSolver::EigenLinearSolver(
         case EigenOption::SolverType::BiCGSTAB:
         case EigenOption::SolverType::CG:
         case EigenOption::SolverType::GMRES:
+            if (_option.block_size > 1)
+            {
+                _solver = details::createBlockIterativeSolver(_option);
+                return;
+            }
             _solver = details::createIterativeSolver(_option.solver_type,
                                                      _option.precon_type);
             return;
         case EigenOption::SolverType::PardisoLU: {
+            if (_option.mixed_precision)
+            {
+                OGS_FATAL(
+                    "Mixed precision is only available for the SparseLU "
+                    "linear solver.");
+            }
 #ifdef USE_MKL
             using SolverType = Eigen::PardisoLU<EigenMatrix::RawMatrixType>;
             _solver.reset(new details::EigenDirectLinearSolver<SolverType>);
@@ -244,6 +547,33 @@ void EigenLinearSolver::setOption(BaseLib::ConfigTree const& option)
             ptSolver->getConfigParameterOptional<int>("max_iteration_step")) {
         _option.max_iterations = *max_iteration_step;
     }
+    if (auto block_size =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__block_size}
+            ptSolver->getConfigParameterOptional<int>("block_size")) {
+        if (*block_size < 1 || *block_size > 4)
+        {
+            OGS_FATAL(
+                "Block size %d is not supported by the Eigen linear solver. "
+                "Valid block sizes are 1, 2, 3 and 4.",
+                *block_size);
+        }
+        if (*block_size > 1 &&
+            _option.solver_type != EigenOption::SolverType::CG &&
+            _option.solver_type != EigenOption::SolverType::BiCGSTAB)
+        {
+            OGS_FATAL(
+                "The linear solver type %s is not available for block "
+                "matrices. Use CG or BiCGSTAB with a block size greater than "
+                "one.",
+                EigenOption::getSolverName(_option.solver_type).c_str());
+        }
+        _option.block_size = *block_size;
+    }
+    if (auto mixed_precision =
+            //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__mixed_precision}
+            ptSolver->getConfigParameterOptional<bool>("mixed_precision")) {
+        _option.mixed_precision = *mixed_precision;
+    }
     if (auto scaling =
             //! \ogs_file_param{prj__linear_solvers__linear_solver__eigen__scaling}
             ptSolver->getConfigParameterOptional<bool>("scaling")) {
@@ -279,6 +609,30 @@ bool EigenLinearSolver::solve(EigenMatrix &A, EigenVector& b, EigenVector &x)
     if (scal)
         x.getRawVector() = scal->RightScaling().cwiseProduct(x.getRawVector());
 #endif
+    _setup_matrix = success ? &A : nullptr;
+    ++_number_of_setups;
+
+    INFO("------------------------------------------------------------------");
+
+    return success;
+}
+
+bool EigenLinearSolver::solveWithPreviousSetup(EigenMatrix& A, EigenVector& b,
+                                               EigenVector& x)
+{
+    bool reuse = &A == _setup_matrix;
+#ifdef USE_EIGEN_UNSUPPORTED
+    // The scaling modifies A in place.
+    reuse = reuse && !_option.scaling;
+#endif
+    if (!reuse)
+        return solve(A, b, x);
+
+    INFO("------------------------------------------------------------------");
+    INFO("*** Eigen solver computation");
+
+    auto const success = _solver->solveWithPreviousSetup(
+        A.getRawMatrix(), b.getRawVector(), x.getRawVector(), _option);
 
     INFO("------------------------------------------------------------------");
 
@@ -55,9 +55,25 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /**
+     * Solves A x = b reusing the factorization or preconditioner computed in
+     * the last call of solve(). The matrix A has to be the same object with
+     * the same values as in that call. Falls back to solve() for a different
+     * matrix object or if scaling is enabled.
+     */
+    bool solveWithPreviousSetup(EigenMatrix& A, EigenVector& b, EigenVector& x);
+
+    /// Number of setups, e.g. factorizations, computed by solve() so far.
+    /// Users sharing this solver can compare it to check whether the setup
+    /// of their last solve() is still in place for solveWithPreviousSetup().
+    std::size_t getNumberOfSetups() const { return _number_of_setups; }
+
 protected:
     EigenOption _option;
     std::unique_ptr<EigenLinearSolverBase> _solver;
+    /// Matrix of the last call of solve().
+    EigenMatrix const* _setup_matrix = nullptr;
+    std::size_t _number_of_setups = 0;
 };
 
 } // MathLib
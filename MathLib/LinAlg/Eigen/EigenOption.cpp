@@ -19,6 +19,8 @@ EigenOption::EigenOption()
     precon_type = PreconType::NONE;
     max_iterations = static_cast<int>(1e6);
     error_tolerance = 1.e-16;
+    block_size = 1;
+    mixed_precision = false;
 #ifdef USE_EIGEN_UNSUPPORTED
     scaling = false;
 #endif
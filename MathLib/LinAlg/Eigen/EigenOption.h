@@ -43,6 +43,13 @@ struct EigenOption final
     int max_iterations;
     /// Error tolerance
     double error_tolerance;
+    /// Size of the dense blocks of the matrix used by the iterative solvers.
+    /// For a block size greater than one the matrix is converted to a
+    /// BlockCSRMatrix.
+    int block_size;
+    /// Factorize a single precision copy of the matrix with the direct solver
+    /// and recover double precision accuracy by iterative refinement.
+    bool mixed_precision;
 #ifdef USE_EIGEN_UNSUPPORTED
     /// Scaling the coefficient matrix and the RHS bector
     bool scaling;
@@ -0,0 +1,154 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cmath>
+#include <limits>
+
+#include <Eigen/Core>
+#include <logog/include/logog.hpp>
+
+#include "EigenOption.h"
+
+namespace MathLib
+{
+/// Preconditioned Krylov solvers for operators which are not available as an
+/// Eigen sparse matrix.
+///
+/// The operator has to provide multiply(x, y) computing y = A x, and the
+/// preconditioner apply(r, z) computing z = M^{-1} r. The iteration stops if
+/// the residual norm relative to the norm of the right-hand side is below
+/// EigenOption::error_tolerance or after EigenOption::max_iterations steps.
+
+/// The identity as preconditioner.
+struct IdentityPreconditioner final
+{
+    template <typename Matrix>
+    void compute(Matrix const& /*A*/)
+    {
+    }
+
+    void apply(Eigen::VectorXd const& r, Eigen::VectorXd& z) const { z = r; }
+};
+
+/// Preconditioned conjugate gradient method for symmetric positive definite
+/// operators.
+template <typename Operator, typename Preconditioner>
+bool solveCG(Operator const& A, Preconditioner const& M,
+             Eigen::VectorXd const& b, Eigen::VectorXd& x,
+             EigenOption const& opt)
+{
+    double const norm_b = b.norm();
+    if (norm_b == 0)
+    {
+        x.setZero(b.size());
+        return true;
+    }
+    double const tolerance = opt.error_tolerance * norm_b;
+
+    Eigen::VectorXd q;
+    A.multiply(x, q);
+    Eigen::VectorXd r = b - q;
+    Eigen::VectorXd z;
+    M.apply(r, z);
+    Eigen::VectorXd p = z;
+    double rz = r.dot(z);
+
+    int iteration = 0;
+    double norm_r = r.norm();
+    for (; iteration < opt.max_iterations && norm_r > tolerance; ++iteration)
+    {
+        A.multiply(p, q);
+        double const alpha = rz / p.dot(q);
+        x += alpha * p;
+        r -= alpha * q;
+        norm_r = r.norm();
+
+        M.apply(r, z);
+        double const rz_new = r.dot(z);
+        p = z + (rz_new / rz) * p;
+        rz = rz_new;
+    }
+
+    INFO("\t iteration: %d/%d", iteration, opt.max_iterations);
+    INFO("\t residual: %e\n", norm_r / norm_b);
+    return norm_r <= tolerance;
+}
+
+/// Right preconditioned stabilized bi-conjugate gradient method.
+template <typename Operator, typename Preconditioner>
+bool solveBiCGSTAB(Operator const& A, Preconditioner const& M,
+                   Eigen::VectorXd const& b, Eigen::VectorXd& x,
+                   EigenOption const& opt)
+{
+    double const norm_b = b.norm();
+    if (norm_b == 0)
+    {
+        x.setZero(b.size());
+        return true;
+    }
+    double const tolerance = opt.error_tolerance * norm_b;
+    double const eps2 = std::numeric_limits<double>::epsilon() *
+                        std::numeric_limits<double>::epsilon();
+
+    Eigen::VectorXd v;
+    A.multiply(x, v);
+    Eigen::VectorXd r = b - v;
+    Eigen::VectorXd r0 = r;
+    double r0_sqnorm = r0.squaredNorm();
+    v.setZero(b.size());
+    Eigen::VectorXd p = Eigen::VectorXd::Zero(b.size());
+    Eigen::VectorXd y, s, z, t;
+
+    double rho = 1;
+    double alpha = 1;
+    double omega = 1;
+
+    int iteration = 0;
+    double norm_r = r.norm();
+    for (; iteration < opt.max_iterations && norm_r > tolerance; ++iteration)
+    {
+        double rho_new = r0.dot(r);
+        if (std::abs(rho_new) < eps2 * r0_sqnorm)
+        {
+            // The residual became orthogonal to the shadow residual, restart.
+            r0 = r;
+            rho_new = r0_sqnorm = r.squaredNorm();
+        }
+        double const beta = (rho_new / rho) * (alpha / omega);
+        rho = rho_new;
+        p = r + beta * (p - omega * v);
+
+        M.apply(p, y);
+        A.multiply(y, v);
+        alpha = rho / r0.dot(v);
+        s = r - alpha * v;
+
+        M.apply(s, z);
+        A.multiply(z, t);
+        double const t_sqnorm = t.squaredNorm();
+        omega = t_sqnorm > 0 ? t.dot(s) / t_sqnorm : 0;
+
+        x += alpha * y + omega * z;
+        r = s - omega * t;
+        norm_r = r.norm();
+        if (omega == 0)
+        {
+            ++iteration;
+            break;
+        }
+    }
+
+    INFO("\t iteration: %d/%d", iteration, opt.max_iterations);
+    INFO("\t residual: %e\n", norm_r / norm_b);
+    return norm_r <= tolerance;
+}
+
+}  // namespace MathLib
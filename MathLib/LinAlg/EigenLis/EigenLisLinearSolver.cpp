@@ -35,6 +35,7 @@ bool EigenLisLinearSolver::solve(EigenMatrix &A_, EigenVector& b_,
 {
     static_assert(EigenMatrix::RawMatrixType::IsRowMajor,
                   "Sparse matrix is required to be in row major storage.");
+    ++_number_of_setups;
     auto &A = A_.getRawMatrix();
     auto &b = b_.getRawVector();
     auto &x = x_.getRawVector();
@@ -46,8 +46,21 @@ public:
 
     bool solve(EigenMatrix &A, EigenVector& b, EigenVector &x);
 
+    /// Lis keeps no setup between solves, hence the system is solved from
+    /// scratch.
+    bool solveWithPreviousSetup(EigenMatrix& A, EigenVector& b, EigenVector& x)
+    {
+        return solve(A, b, x);
+    }
+
+    /// Number of setups, e.g. factorizations, computed by solve() so far.
+    /// Users sharing this solver can compare it to check whether the setup
+    /// of their last solve() is still in place for solveWithPreviousSetup().
+    std::size_t getNumberOfSetups() const { return _number_of_setups; }
+
 private:
     LisOption _lis_option;
+    std::size_t _number_of_setups = 0;
 };
 
 } // MathLib
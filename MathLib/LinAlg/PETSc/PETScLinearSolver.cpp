@@ -76,6 +76,7 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
 {
     BaseLib::RunTime wtimer;
     wtimer.start();
+    ++_number_of_setups;
 
 // define TEST_MEM_PETSC
 #ifdef TEST_MEM_PETSC
@@ -187,4 +188,20 @@ bool PETScLinearSolver::solve(PETScMatrix& A, PETScVector& b, PETScVector& x)
     return converged;
 }
 
+bool PETScLinearSolver::solveWithPreviousSetup(PETScMatrix& A, PETScVector& b,
+                                               PETScVector& x)
+{
+#if (PETSC_VERSION_NUMBER > 3040)
+    auto const number_of_setups = _number_of_setups;
+    KSPSetReusePreconditioner(_solver, PETSC_TRUE);
+    bool const converged = solve(A, b, x);
+    KSPSetReusePreconditioner(_solver, PETSC_FALSE);
+    // The preconditioner was kept, i.e. no new setup was computed.
+    _number_of_setups = number_of_setups;
+    return converged;
+#else
+    return solve(A, b, x);
+#endif
+}
+
 }  // end of namespace
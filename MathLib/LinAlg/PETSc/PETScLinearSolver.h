@@ -54,6 +54,17 @@ public:
     // TODO check if some args in LinearSolver interface can be made const&.
     bool solve(PETScMatrix& A, PETScVector& b, PETScVector& x);
 
+    /// Solves A x = b keeping the preconditioner, e.g. a factorization,
+    /// computed in the last call of solve(). The matrix A has to be unchanged
+    /// since then.
+    bool solveWithPreviousSetup(PETScMatrix& A, PETScVector& b,
+                                PETScVector& x);
+
+    /// Number of setups, e.g. factorizations, computed by solve() so far.
+    /// Users sharing this solver can compare it to check whether the setup
+    /// of their last solve() is still in place for solveWithPreviousSetup().
+    std::size_t getNumberOfSetups() const { return _number_of_setups; }
+
     /// Get number of iterations.
     PetscInt getNumberOfIterations() const
     {
@@ -69,6 +80,7 @@ private:
     PC _pc;       ///< Preconditioner type.
 
     double _elapsed_ctime = 0.0;  ///< Clock time
+    std::size_t _number_of_setups = 0;
 };
 
 }  // end namespace
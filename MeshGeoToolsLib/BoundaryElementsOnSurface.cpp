@@ -37,20 +37,19 @@ BoundaryElementsOnSurface::BoundaryElementsOnSurface(
             continue;
         // find faces on surface
         for (unsigned i=0; i<e->getNumberOfFaces(); i++) {
-            auto* face = e->getFace(i);
+            auto const face = e->getFaceView(i);
             // check
             std::size_t cnt_match = 0;
-            for (std::size_t j=0; j<face->getNumberOfBaseNodes(); j++) {
-                if (std::find(node_ids_on_sfc.begin(), node_ids_on_sfc.end(), face->getNodeIndex(j)) != node_ids_on_sfc.end())
+            for (std::size_t j=0; j<face.getNumberOfBaseNodes(); j++) {
+                if (std::find(node_ids_on_sfc.begin(), node_ids_on_sfc.end(), face.getNodeIndex(j)) != node_ids_on_sfc.end())
                     cnt_match++;
                 else
                     break;
             }
-            // update the list
-            if (cnt_match==face->getNumberOfBaseNodes())
-                _boundary_elements.push_back(const_cast<MeshLib::Element*>(face));
-            else
-                delete face;
+            // update the list; only matching faces are created as elements
+            if (cnt_match==face.getNumberOfBaseNodes())
+                _boundary_elements.push_back(
+                    const_cast<MeshLib::Element*>(e->getFace(i)));
         }
     }
 }
@@ -258,13 +258,12 @@ static std::vector<MathLib::Point3d> computeElementSegmentIntersections(
     std::vector<MathLib::Point3d> element_intersections;
     for (std::size_t k(0); k < elem.getNumberOfEdges(); ++k)
     {
-        auto const edge =
-            std::unique_ptr<MeshLib::Element const>(elem.getEdge(k));
+        auto const edge = elem.getEdgeView(k);
         GeoLib::LineSegment elem_segment{
             new GeoLib::Point(*dynamic_cast<MathLib::Point3d*>(
-                const_cast<MeshLib::Node*>(edge->getNode(0))), 0),
+                const_cast<MeshLib::Node*>(edge.getNode(0))), 0),
             new GeoLib::Point(*dynamic_cast<MathLib::Point3d*>(
-                const_cast<MeshLib::Node*>(edge->getNode(1))), 0),
+                const_cast<MeshLib::Node*>(edge.getNode(1))), 0),
             true};
         std::vector<MathLib::Point3d> const intersections(
             GeoLib::lineSegmentIntersect2d(segment, elem_segment));
@@ -32,10 +32,7 @@ HeuristicSearchLength::HeuristicSearchLength(MeshLib::Mesh const& mesh, LengthTy
         {
             std::size_t const n_edges(element->getNumberOfEdges());
             for (std::size_t k(0); k<n_edges; k++) {
-                auto edge =
-                    element->getEdge(k);  // allocation inside getEdge().
-                double const len = edge->getContent();
-                delete edge;
+                double const len = element->getEdgeView(k).getLength();
                 sum += len;
                 sum_of_sqr += len*len;
             }
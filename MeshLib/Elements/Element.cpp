@@ -21,6 +21,7 @@
 #include "MeshLib/Node.h"
 
 #include "Line.h"
+#include "LocalTopology.h"
 
 namespace MeshLib {
 
@@ -132,6 +133,22 @@ const Element* Element::getNeighbor(unsigned i) const
 #endif
 }
 
+SubElementView Element::getEdgeView(unsigned i) const
+{
+    auto const& edges = getLocalTopology(*this).edges;
+    assert(i < edges.size());
+    return {*this, _nodes, edges[i]};
+}
+
+SubElementView Element::getFaceView(unsigned i) const
+{
+    auto const& topology = getLocalTopology(*this);
+    auto const& faces =
+        getDimension() == 2 ? topology.edges : topology.faces;
+    assert(i < faces.size());
+    return {*this, _nodes, faces[i]};
+}
+
 unsigned Element::getNodeIDinElement(const MeshLib::Node* node) const
 {
     const unsigned nNodes (this->getNumberOfNodes());
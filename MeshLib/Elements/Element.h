@@ -22,6 +22,7 @@
 #include "MeshLib/MeshEnums.h"
 #include "MeshLib/Mesh.h"
 #include "MeshLib/Elements/ElementErrorCode.h"
+#include "MeshLib/Elements/SubElementView.h"
 
 
 namespace MeshLib {
@@ -86,6 +87,15 @@ public:
     /// Returns the i-th face of the element.
     virtual const Element* getFace(unsigned i) const = 0;
 
+    /// Returns a view of the i-th edge of the element. Unlike getEdge() no
+    /// memory is allocated.
+    SubElementView getEdgeView(unsigned i) const;
+
+    /// Returns a view of the i-th face of the element, which is the i-th edge
+    /// for 2d elements like in getFace(). Unlike getFace() no memory is
+    /// allocated.
+    SubElementView getFaceView(unsigned i) const;
+
     /// Returns the ID of the element.
     virtual std::size_t getID() const final { return _id; }
 
@@ -0,0 +1,106 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "LocalTopology.h"
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <mutex>
+
+#include "Element.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/MeshEnums.h"
+
+namespace
+{
+MeshLib::SubElementTopology getSubElementTopology(
+    MeshLib::Element const& element, MeshLib::Element const& sub_element)
+{
+    MeshLib::SubElementTopology topology{sub_element.getCellType(),
+                                         sub_element.getNumberOfBaseNodes(),
+                                         {}};
+    for (unsigned k = 0; k < sub_element.getNumberOfNodes(); ++k)
+        topology.nodes.push_back(
+            element.getNodeIDinElement(sub_element.getNode(k)));
+    return topology;
+}
+}  // namespace
+
+namespace MeshLib
+{
+LocalTopology computeLocalTopology(Element const& mesh_element)
+{
+    // The tables are computed from a copy of the element with distinct
+    // nodes, because the given element might be degenerate with some of its
+    // nodes being identical.
+    unsigned const n_nodes = mesh_element.getNumberOfNodes();
+    std::vector<Node> nodes;
+    nodes.reserve(n_nodes);
+    for (unsigned k = 0; k < n_nodes; ++k)
+        nodes.emplace_back(static_cast<double>(k), 0.0, 0.0, k);
+    auto** const element_nodes = new Node*[n_nodes];
+    for (unsigned k = 0; k < n_nodes; ++k)
+        element_nodes[k] = &nodes[k];
+    std::unique_ptr<Element const> const reference_element(
+        mesh_element.clone(element_nodes, 0));
+    Element const& element = *reference_element;
+
+    LocalTopology topology;
+
+    for (unsigned i = 0; i < element.getNumberOfEdges(); ++i)
+    {
+        std::unique_ptr<Element const> const edge(element.getEdge(i));
+        topology.edges.push_back(getSubElementTopology(element, *edge));
+    }
+
+    for (unsigned i = 0; i < element.getNumberOfFaces(); ++i)
+    {
+        std::unique_ptr<Element const> const face(element.getFace(i));
+        topology.faces.push_back(getSubElementTopology(element, *face));
+    }
+
+    unsigned const dim = element.getDimension();
+    if (dim <= 1)
+    {
+        for (unsigned i = 0; i < std::min(element.getNumberOfNeighbors(),
+                                          element.getNumberOfBaseNodes());
+             ++i)
+            topology.neighbor_faces.push_back({i});
+    }
+    else
+    {
+        // The neighbors are connected through the edges of 2d and the faces
+        // of 3d elements.
+        for (unsigned i = 0; i < element.getNumberOfNeighbors(); ++i)
+        {
+            auto const& face =
+                dim == 2 ? topology.edges[i] : topology.faces[i];
+            topology.neighbor_faces.emplace_back(
+                face.nodes.begin(), face.nodes.begin() + face.n_base_nodes);
+        }
+    }
+    return topology;
+}
+
+LocalTopology const& getLocalTopology(Element const& element)
+{
+    std::size_t const n_cell_types =
+        static_cast<std::size_t>(CellType::PYRAMID13) + 1;
+    static std::array<std::once_flag, n_cell_types> computed;
+    static std::array<LocalTopology, n_cell_types> topologies;
+
+    auto const type = static_cast<std::size_t>(element.getCellType());
+    std::call_once(computed[type], [&]() {
+        topologies[type] = computeLocalTopology(element);
+    });
+    return topologies[type];
+}
+
+}  // namespace MeshLib
@@ -0,0 +1,55 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <vector>
+
+#include "MeshLib/MeshEnums.h"
+
+namespace MeshLib
+{
+class Element;
+
+/// Local node numbers and type of an edge or a face of an element.
+struct SubElementTopology
+{
+    CellType cell_type;
+    unsigned n_base_nodes;
+    /// Local node numbers within the element, the base nodes first.
+    std::vector<unsigned> nodes;
+};
+
+/// Local node numbers of the edges and faces of an element type. The tables
+/// are the same for all elements of a cell type and allow to iterate over
+/// edges and faces without creating temporary edge or face elements.
+struct LocalTopology
+{
+    /// The edges in the order of Element::getEdge().
+    std::vector<SubElementTopology> edges;
+
+    /// The faces of 3d elements in the order of Element::getFace().
+    std::vector<SubElementTopology> faces;
+
+    /// Local base node numbers of the faces connecting an element to its
+    /// neighbors, in the order of the neighbors. These are the nodes of 0d
+    /// and 1d elements, the edges of 2d elements and the faces of 3d
+    /// elements.
+    std::vector<std::vector<unsigned>> neighbor_faces;
+};
+
+/// Computes the local topology of the cell type of the given element. The
+/// element may be degenerate, i.e. some of its nodes may be identical.
+LocalTopology computeLocalTopology(Element const& element);
+
+/// Returns the local topology of the cell type of the given element. The
+/// tables are computed once per cell type; the function is thread-safe.
+LocalTopology const& getLocalTopology(Element const& element);
+
+}  // namespace MeshLib
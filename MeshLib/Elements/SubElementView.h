@@ -0,0 +1,90 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cassert>
+
+#include "MathLib/Vector3.h"
+#include "MeshLib/Node.h"
+
+#include "LocalTopology.h"
+
+namespace MeshLib
+{
+class Element;
+
+/// Non-owning view of an edge or a face of an element.
+///
+/// In contrast to Element::getEdge() and Element::getFace() no element is
+/// created; the view refers to the nodes of the parent element through the
+/// local node numbers of the cell type's LocalTopology. A view is valid as
+/// long as its parent element exists. Use Element::getEdgeView() and
+/// Element::getFaceView() to obtain views.
+class SubElementView final
+{
+public:
+    SubElementView(Element const& element, Node* const* const element_nodes,
+                   SubElementTopology const& topology)
+        : _element(element), _element_nodes(element_nodes), _topology(topology)
+    {
+    }
+
+    CellType getCellType() const { return _topology.cell_type; }
+
+    unsigned getNumberOfNodes() const
+    {
+        return static_cast<unsigned>(_topology.nodes.size());
+    }
+
+    unsigned getNumberOfBaseNodes() const { return _topology.n_base_nodes; }
+
+    Node const* getNode(unsigned const i) const
+    {
+        assert(i < getNumberOfNodes());
+        return _element_nodes[_topology.nodes[i]];
+    }
+
+    /// Returns the id of the i-th node in the mesh.
+    std::size_t getNodeIndex(unsigned const i) const
+    {
+        return getNode(i)->getID();
+    }
+
+    /// Local node numbers of the edge's or face's nodes within the parent
+    /// element.
+    std::vector<unsigned> const& getLocalNodeIDs() const
+    {
+        return _topology.nodes;
+    }
+
+    Element const& getParentElement() const { return _element; }
+
+    /// Returns the normal of a face computed from its first three nodes like
+    /// FaceRule::getSurfaceNormal().
+    MathLib::Vector3 getSurfaceNormal() const
+    {
+        MathLib::Vector3 const u(*getNode(1), *getNode(0));
+        MathLib::Vector3 const v(*getNode(1), *getNode(2));
+        return MathLib::crossProduct(u, v);
+    }
+
+    /// Returns the length of an edge between its two base nodes.
+    double getLength() const
+    {
+        return MathLib::Vector3(*getNode(0), *getNode(1)).getLength();
+    }
+
+private:
+    Element const& _element;
+    Node* const* const _element_nodes;
+    SubElementTopology const& _topology;
+};
+
+}  // namespace MeshLib
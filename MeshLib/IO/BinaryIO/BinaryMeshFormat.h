@@ -0,0 +1,146 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <cstdint>
+
+namespace MeshLib
+{
+namespace IO
+{
+/**
+ * Layout of the binary OGS mesh format (file extension .ogsmesh).
+ *
+ * The file starts with a BinaryMeshHeader, followed by the sections, a
+ * string table and the section table. Each entry of the section table
+ * stores the offset and size of its section, so every array can be located
+ * without reading the preceding ones. Section data are the raw little endian
+ * arrays aligned to 8 bytes or, if compressed, a zlib stream of them. The
+ * mesh name and the property names are stored in the string table.
+ *
+ * Sections:
+ *  - Nodes: 3 doubles per node,
+ *  - CellTypes: one MeshLib::CellType per element as uint8,
+ *  - ElementOffsets: n_elements + 1 uint64 offsets into the connectivity,
+ *  - Connectivity: the node ids of all elements as uint64,
+ *  - Property: the values of one PropertyVector.
+ */
+namespace BinaryMeshFormat
+{
+char const magic[8] = {'O', 'G', 'S', 'M', 'E', 'S', 'H', '\0'};
+std::uint32_t const version = 1;
+
+enum class SectionKind : std::uint32_t
+{
+    Nodes = 1,
+    CellTypes = 2,
+    ElementOffsets = 3,
+    Connectivity = 4,
+    Property = 5
+};
+
+enum class Compression : std::uint32_t
+{
+    None = 0,
+    ZLib = 1
+};
+
+/// Value types of property sections.
+enum class ValueType : std::uint8_t
+{
+    Char = 1,
+    UnsignedChar = 2,
+    Int32 = 3,
+    UInt32 = 4,
+    Int64 = 5,
+    UInt64 = 6,
+    Float32 = 7,
+    Float64 = 8
+};
+
+template <typename T>
+struct ValueTypeOf;
+template <>
+struct ValueTypeOf<char>
+{
+    static const ValueType value = ValueType::Char;
+};
+template <>
+struct ValueTypeOf<unsigned char>
+{
+    static const ValueType value = ValueType::UnsignedChar;
+};
+template <>
+struct ValueTypeOf<int>
+{
+    static const ValueType value = ValueType::Int32;
+};
+template <>
+struct ValueTypeOf<unsigned>
+{
+    static const ValueType value = ValueType::UInt32;
+};
+template <>
+struct ValueTypeOf<std::int64_t>
+{
+    static const ValueType value = ValueType::Int64;
+};
+template <>
+struct ValueTypeOf<std::uint64_t>
+{
+    static const ValueType value = ValueType::UInt64;
+};
+template <>
+struct ValueTypeOf<float>
+{
+    static const ValueType value = ValueType::Float32;
+};
+template <>
+struct ValueTypeOf<double>
+{
+    static const ValueType value = ValueType::Float64;
+};
+
+struct Header
+{
+    char magic[8];
+    std::uint32_t version;
+    std::uint32_t header_size;
+    std::uint64_t n_nodes;
+    std::uint64_t n_base_nodes;
+    std::uint64_t n_elements;
+    std::uint64_t n_sections;
+    std::uint64_t section_table_offset;
+    std::uint64_t strings_offset;
+    std::uint64_t strings_size;
+    std::uint64_t mesh_name_length;  ///< The name begins the string table.
+};
+static_assert(sizeof(Header) == 80, "Unexpected padding in the header.");
+
+struct Section
+{
+    SectionKind kind;
+    Compression compression;
+    std::uint64_t offset;       ///< From the beginning of the file.
+    std::uint64_t stored_size;  ///< Size in the file.
+    std::uint64_t raw_size;     ///< Size after decompression.
+    ValueType value_type;       ///< Only used by properties.
+    std::uint8_t item_type;     ///< MeshLib::MeshItemType of properties.
+    std::uint16_t reserved;
+    std::uint32_t n_components;
+    std::uint32_t name_offset;  ///< Into the string table.
+    std::uint32_t name_length;
+};
+static_assert(sizeof(Section) == 48,
+              "Unexpected padding in the section table entry.");
+
+}  // namespace BinaryMeshFormat
+}  // namespace IO
+}  // namespace MeshLib
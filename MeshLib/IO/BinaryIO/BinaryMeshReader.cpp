@@ -0,0 +1,486 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BinaryMeshReader.h"
+
+#include <cstring>
+#include <utility>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <logog/include/logog.hpp>
+#include <vtk_zlib.h>
+
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+namespace Format = MeshLib::IO::BinaryMeshFormat;
+
+template <typename ElementType>
+MeshLib::Element* createElement(MeshLib::Node** const nodes)
+{
+    return new ElementType(nodes);
+}
+
+struct ElementCreator
+{
+    MeshLib::Element* (*create)(MeshLib::Node**);
+    unsigned n_nodes;
+};
+
+template <typename ElementType>
+ElementCreator makeCreator()
+{
+    return {&createElement<ElementType>, ElementType::n_all_nodes};
+}
+
+/// Returns the creator for the cell type or one with n_nodes == 0 for cell
+/// types without element implementation.
+ElementCreator getElementCreator(MeshLib::CellType const cell_type)
+{
+    switch (cell_type)
+    {
+        case MeshLib::CellType::POINT1:
+            return makeCreator<MeshLib::Point>();
+        case MeshLib::CellType::LINE2:
+            return makeCreator<MeshLib::Line>();
+        case MeshLib::CellType::LINE3:
+            return makeCreator<MeshLib::Line3>();
+        case MeshLib::CellType::TRI3:
+            return makeCreator<MeshLib::Tri>();
+        case MeshLib::CellType::TRI6:
+            return makeCreator<MeshLib::Tri6>();
+        case MeshLib::CellType::QUAD4:
+            return makeCreator<MeshLib::Quad>();
+        case MeshLib::CellType::QUAD8:
+            return makeCreator<MeshLib::Quad8>();
+        case MeshLib::CellType::QUAD9:
+            return makeCreator<MeshLib::Quad9>();
+        case MeshLib::CellType::TET4:
+            return makeCreator<MeshLib::Tet>();
+        case MeshLib::CellType::TET10:
+            return makeCreator<MeshLib::Tet10>();
+        case MeshLib::CellType::HEX8:
+            return makeCreator<MeshLib::Hex>();
+        case MeshLib::CellType::HEX20:
+            return makeCreator<MeshLib::Hex20>();
+        case MeshLib::CellType::PRISM6:
+            return makeCreator<MeshLib::Prism>();
+        case MeshLib::CellType::PRISM15:
+            return makeCreator<MeshLib::Prism15>();
+        case MeshLib::CellType::PYRAMID5:
+            return makeCreator<MeshLib::Pyramid>();
+        case MeshLib::CellType::PYRAMID13:
+            return makeCreator<MeshLib::Pyramid13>();
+        default:
+            return {nullptr, 0};
+    }
+}
+
+/// Checks that the size of a property section is a whole number of tuples
+/// and, for node and cell properties, matches the number of mesh items.
+template <typename T>
+bool hasValidPropertySize(Format::Section const& section,
+                          Format::Header const& header)
+{
+    if (section.n_components == 0 || section.raw_size % sizeof(T) != 0)
+        return false;
+    auto const n_values = section.raw_size / sizeof(T);
+    if (n_values % section.n_components != 0)
+        return false;
+    auto const n_items = n_values / section.n_components;
+    switch (static_cast<MeshLib::MeshItemType>(section.item_type))
+    {
+        case MeshLib::MeshItemType::Node:
+            return n_items == header.n_nodes;
+        case MeshLib::MeshItemType::Cell:
+            return n_items == header.n_elements;
+        default:
+            return true;
+    }
+}
+
+template <typename T>
+MeshLib::PropertyVector<T>* createPropertyVector(
+    std::string const& name, Format::Section const& section,
+    Format::Header const& header, MeshLib::Properties& properties)
+{
+    if (!hasValidPropertySize<T>(section, header))
+        return nullptr;
+    auto* const p = properties.createNewPropertyVector<T>(
+        name, static_cast<MeshLib::MeshItemType>(section.item_type),
+        section.n_components);
+    if (!p)
+        return nullptr;
+    p->resize(section.raw_size / sizeof(T));
+    return p;
+}
+
+/// Creates a PropertyVector of the section's value type and sets data to its
+/// memory. Returns false if the section size is invalid or the vector could
+/// not be created.
+bool createPropertyVector(std::string const& name,
+                          Format::Section const& section,
+                          Format::Header const& header,
+                          MeshLib::Properties& properties, void*& data)
+{
+    auto create = [&](auto* const p) {
+        if (p)
+            data = p->data();
+        return p != nullptr;
+    };
+
+    switch (section.value_type)
+    {
+        case Format::ValueType::Char:
+            return create(createPropertyVector<char>(name, section, header,
+                                                     properties));
+        case Format::ValueType::UnsignedChar:
+            return create(createPropertyVector<unsigned char>(
+                name, section, header, properties));
+        case Format::ValueType::Int32:
+            return create(createPropertyVector<int>(name, section, header,
+                                                    properties));
+        case Format::ValueType::UInt32:
+            return create(createPropertyVector<unsigned>(name, section, header,
+                                                         properties));
+        case Format::ValueType::Int64:
+            return create(createPropertyVector<std::int64_t>(
+                name, section, header, properties));
+        case Format::ValueType::UInt64:
+            return create(createPropertyVector<std::uint64_t>(
+                name, section, header, properties));
+        case Format::ValueType::Float32:
+            return create(createPropertyVector<float>(name, section, header,
+                                                      properties));
+        case Format::ValueType::Float64:
+            return create(createPropertyVector<double>(name, section, header,
+                                                       properties));
+    }
+    return false;
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+BinaryMeshReader::BinaryMeshReader(std::string const& file_name)
+    : _file_name(file_name)
+{
+    namespace bip = boost::interprocess;
+    try
+    {
+        bip::file_mapping const mapping(file_name.c_str(), bip::read_only);
+        _region.reset(new bip::mapped_region(mapping, bip::read_only));
+    }
+    catch (bip::interprocess_exception const& e)
+    {
+        ERR("BinaryMeshReader: Could not map file %s: %s", file_name.c_str(),
+            e.what());
+        return;
+    }
+    _data = static_cast<char const*>(_region->get_address());
+    _size = _region->get_size();
+
+    auto fail = [this](char const* const message) {
+        ERR("BinaryMeshReader: %s: %s", _file_name.c_str(), message);
+        _region.reset();
+    };
+
+    if (_size < sizeof(Format::Header))
+    {
+        fail("The file is too small.");
+        return;
+    }
+    std::memcpy(&_header, _data, sizeof(Format::Header));
+    if (std::memcmp(_header.magic, Format::magic, sizeof(Format::magic)) != 0)
+    {
+        fail("The file is not a binary OGS mesh.");
+        return;
+    }
+    if (_header.version != Format::version ||
+        _header.header_size != sizeof(Format::Header))
+    {
+        fail("Unsupported version of the binary mesh format.");
+        return;
+    }
+    if (_header.strings_offset > _size ||
+        _header.strings_size > _size - _header.strings_offset ||
+        _header.mesh_name_length > _header.strings_size)
+    {
+        fail("Invalid string table.");
+        return;
+    }
+    if (_header.section_table_offset % 8 != 0 ||
+        _header.section_table_offset > _size ||
+        _header.n_sections > (_size - _header.section_table_offset) /
+                                 sizeof(Format::Section))
+    {
+        fail("Invalid section table.");
+        return;
+    }
+
+    _sections = reinterpret_cast<Format::Section const*>(
+        _data + _header.section_table_offset);
+    for (std::size_t i = 0; i < _header.n_sections; ++i)
+    {
+        auto const& s = _sections[i];
+        if (s.offset > _size || s.stored_size > _size - s.offset ||
+            std::uint64_t(s.name_offset) + s.name_length >
+                _header.strings_size ||
+            (s.compression == Format::Compression::None &&
+             s.stored_size != s.raw_size))
+        {
+            fail("Invalid section.");
+            return;
+        }
+    }
+}
+
+BinaryMeshReader::~BinaryMeshReader() = default;
+
+std::string BinaryMeshReader::getMeshName() const
+{
+    if (!good())
+        return "";
+    return std::string(_data + _header.strings_offset,
+                       _header.mesh_name_length);
+}
+
+std::string BinaryMeshReader::getSectionName(
+    Format::Section const& section) const
+{
+    return std::string(_data + _header.strings_offset + section.name_offset,
+                       section.name_length);
+}
+
+std::vector<std::string> BinaryMeshReader::getPropertyNames() const
+{
+    std::vector<std::string> names;
+    if (!good())
+        return names;
+    for (std::size_t i = 0; i < _header.n_sections; ++i)
+        if (_sections[i].kind == Format::SectionKind::Property)
+            names.push_back(getSectionName(_sections[i]));
+    return names;
+}
+
+Format::Section const* BinaryMeshReader::findSection(
+    Format::SectionKind const kind) const
+{
+    for (std::size_t i = 0; i < _header.n_sections; ++i)
+        if (_sections[i].kind == kind)
+            return &_sections[i];
+    return nullptr;
+}
+
+bool BinaryMeshReader::readSection(Format::Section const& section,
+                                   void* const data) const
+{
+    if (section.raw_size == 0)
+        return true;
+    char const* const source = _data + section.offset;
+    switch (section.compression)
+    {
+        case Format::Compression::None:
+            std::memcpy(data, source, section.raw_size);
+            return true;
+        case Format::Compression::ZLib:
+        {
+            uLongf size = section.raw_size;
+            return uncompress(static_cast<Bytef*>(data), &size,
+                              reinterpret_cast<Bytef const*>(source),
+                              section.stored_size) == Z_OK &&
+                   size == section.raw_size;
+        }
+    }
+    return false;
+}
+
+MeshLib::Mesh* BinaryMeshReader::readMesh(
+    std::vector<std::string> const& property_names) const
+{
+    if (!good())
+        return nullptr;
+
+    auto const* const nodes_section = findSection(Format::SectionKind::Nodes);
+    auto const* const types_section =
+        findSection(Format::SectionKind::CellTypes);
+    auto const* const offsets_section =
+        findSection(Format::SectionKind::ElementOffsets);
+    auto const* const connectivity_section =
+        findSection(Format::SectionKind::Connectivity);
+    std::size_t const n_nodes = _header.n_nodes;
+    std::size_t const n_elements = _header.n_elements;
+    if (!nodes_section || !types_section || !offsets_section ||
+        !connectivity_section ||
+        nodes_section->raw_size != 3 * n_nodes * sizeof(double) ||
+        types_section->raw_size != n_elements ||
+        offsets_section->raw_size !=
+            (n_elements + 1) * sizeof(std::uint64_t) ||
+        connectivity_section->raw_size % sizeof(std::uint64_t) != 0 ||
+        _header.n_base_nodes > n_nodes)
+    {
+        ERR("BinaryMeshReader: %s: Missing or invalid mesh sections.",
+            _file_name.c_str());
+        return nullptr;
+    }
+
+    std::vector<double> coordinates(3 * n_nodes);
+    std::vector<std::uint8_t> cell_types(n_elements);
+    std::vector<std::uint64_t> offsets(n_elements + 1);
+    std::vector<std::uint64_t> connectivity(connectivity_section->raw_size /
+                                            sizeof(std::uint64_t));
+    if (!readSection(*nodes_section, coordinates.data()) ||
+        !readSection(*types_section, cell_types.data()) ||
+        !readSection(*offsets_section, offsets.data()) ||
+        !readSection(*connectivity_section, connectivity.data()))
+    {
+        ERR("BinaryMeshReader: %s: Reading the mesh sections failed.",
+            _file_name.c_str());
+        return nullptr;
+    }
+
+    std::vector<MeshLib::Node*> nodes(n_nodes);
+    auto const n_nodes_signed = static_cast<long>(n_nodes);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (long i = 0; i < n_nodes_signed; ++i)
+        nodes[i] = new MeshLib::Node(coordinates[3 * i], coordinates[3 * i + 1],
+                                     coordinates[3 * i + 2], i);
+
+    std::vector<MeshLib::Element*> elements(n_elements, nullptr);
+    bool valid = true;
+    auto const n_elements_signed = static_cast<long>(n_elements);
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : valid)
+#endif
+    for (long i = 0; i < n_elements_signed; ++i)
+    {
+        auto const creator =
+            getElementCreator(static_cast<MeshLib::CellType>(cell_types[i]));
+        if (creator.n_nodes == 0 ||
+            offsets[i + 1] != offsets[i] + creator.n_nodes ||
+            offsets[i + 1] > connectivity.size())
+        {
+            valid = false;
+            continue;
+        }
+        auto** const element_nodes = new MeshLib::Node*[creator.n_nodes];
+        bool valid_nodes = true;
+        for (unsigned k = 0; k < creator.n_nodes; ++k)
+        {
+            auto const id = connectivity[offsets[i] + k];
+            valid_nodes = valid_nodes && id < n_nodes;
+            element_nodes[k] = valid_nodes ? nodes[id] : nullptr;
+        }
+        if (!valid_nodes)
+        {
+            delete[] element_nodes;
+            valid = false;
+            continue;
+        }
+        elements[i] = creator.create(element_nodes);
+    }
+    if (!valid)
+    {
+        ERR("BinaryMeshReader: %s: Invalid elements.", _file_name.c_str());
+        for (auto* e : elements)
+            delete e;
+        for (auto* n : nodes)
+            delete n;
+        return nullptr;
+    }
+
+    auto* const mesh =
+        new MeshLib::Mesh(getMeshName(), nodes, elements, MeshLib::Properties(),
+                          _header.n_base_nodes);
+
+    // Create the property vectors first and fill them in parallel.
+    std::vector<std::pair<Format::Section const*, void*>> property_data;
+    for (auto const& name : property_names)
+    {
+        Format::Section const* section = nullptr;
+        for (std::size_t i = 0; i < _header.n_sections && !section; ++i)
+            if (_sections[i].kind == Format::SectionKind::Property &&
+                getSectionName(_sections[i]) == name)
+                section = &_sections[i];
+        void* data = nullptr;
+        if (!section ||
+            !createPropertyVector(name, *section, _header,
+                                  mesh->getProperties(), data))
+        {
+            ERR("BinaryMeshReader: %s: Could not read property %s.",
+                _file_name.c_str(), name.c_str());
+            delete mesh;
+            return nullptr;
+        }
+        property_data.emplace_back(section, data);
+    }
+
+    auto const n_properties = static_cast<long>(property_data.size());
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : valid)
+#endif
+    for (long i = 0; i < n_properties; ++i)
+        valid = readSection(*property_data[i].first, property_data[i].second) &&
+                valid;
+    if (!valid)
+    {
+        ERR("BinaryMeshReader: %s: Reading properties failed.",
+            _file_name.c_str());
+        delete mesh;
+        return nullptr;
+    }
+    return mesh;
+}
+
+bool BinaryMeshReader::readProperty(std::string const& name,
+                                    MeshLib::Properties& properties) const
+{
+    if (!good())
+        return false;
+    for (std::size_t i = 0; i < _header.n_sections; ++i)
+    {
+        auto const& section = _sections[i];
+        if (section.kind != Format::SectionKind::Property ||
+            getSectionName(section) != name)
+            continue;
+        void* data = nullptr;
+        if (!createPropertyVector(name, section, _header, properties, data))
+        {
+            ERR("BinaryMeshReader: %s: Could not create property %s.",
+                _file_name.c_str(), name.c_str());
+            return false;
+        }
+        if (!readSection(section, data))
+        {
+            ERR("BinaryMeshReader: %s: Could not read property %s.",
+                _file_name.c_str(), name.c_str());
+            properties.removePropertyVector(name);
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+MeshLib::Mesh* readBinaryMesh(std::string const& file_name)
+{
+    BinaryMeshReader const reader(file_name);
+    return reader.readMesh();
+}
+
+}  // namespace IO
+}  // namespace MeshLib
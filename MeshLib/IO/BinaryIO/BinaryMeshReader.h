@@ -0,0 +1,93 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "BinaryMeshFormat.h"
+
+namespace boost
+{
+namespace interprocess
+{
+class mapped_region;
+}
+}
+
+namespace MeshLib
+{
+class Mesh;
+class Properties;
+
+namespace IO
+{
+/**
+ * Reader for the binary OGS mesh format described in BinaryMeshFormat.h.
+ *
+ * The file is memory-mapped and only the header and the section table are
+ * read on construction. The mesh and each property are read on request, so
+ * parts of a file that are not needed are never loaded from disk.
+ */
+class BinaryMeshReader final
+{
+public:
+    /// Maps the file and checks header and section table. Use good() to
+    /// check whether this succeeded.
+    explicit BinaryMeshReader(std::string const& file_name);
+    ~BinaryMeshReader();
+
+    bool good() const { return _region != nullptr; }
+
+    std::string getMeshName() const;
+    std::size_t getNumberOfNodes() const { return _header.n_nodes; }
+    std::size_t getNumberOfElements() const { return _header.n_elements; }
+
+    /// Names of all properties stored in the file.
+    std::vector<std::string> getPropertyNames() const;
+
+    /// Creates the mesh including the properties with the given names.
+    /// \return The mesh or a nullptr on failure.
+    MeshLib::Mesh* readMesh(
+        std::vector<std::string> const& property_names) const;
+
+    /// Creates the mesh including all properties.
+    MeshLib::Mesh* readMesh() const { return readMesh(getPropertyNames()); }
+
+    /// Reads the property with the given name into the given Properties.
+    /// \return False if the property does not exist or could not be read.
+    bool readProperty(std::string const& name,
+                      MeshLib::Properties& properties) const;
+
+private:
+    BinaryMeshFormat::Section const* findSection(
+        BinaryMeshFormat::SectionKind kind) const;
+    std::string getSectionName(BinaryMeshFormat::Section const& section) const;
+
+    /// Copies or decompresses the data of the section to the given memory of
+    /// the section's raw size.
+    bool readSection(BinaryMeshFormat::Section const& section,
+                     void* data) const;
+
+    std::string const _file_name;
+    std::unique_ptr<boost::interprocess::mapped_region> _region;
+    char const* _data = nullptr;
+    std::size_t _size = 0;
+    BinaryMeshFormat::Header _header{};
+    BinaryMeshFormat::Section const* _sections = nullptr;
+};
+
+/// Reads a mesh in the binary OGS mesh format including all properties.
+/// \return The mesh or a nullptr on failure.
+MeshLib::Mesh* readBinaryMesh(std::string const& file_name);
+
+}  // namespace IO
+}  // namespace MeshLib
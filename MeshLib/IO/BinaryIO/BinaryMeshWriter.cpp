@@ -0,0 +1,228 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "BinaryMeshWriter.h"
+
+#include <cstring>
+#include <fstream>
+#include <vector>
+
+#include <logog/include/logog.hpp>
+#include <vtk_zlib.h>
+
+#include "BinaryMeshFormat.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+namespace Format = MeshLib::IO::BinaryMeshFormat;
+
+/// Writes the sections to the stream and collects the section table and the
+/// string table.
+class SectionWriter
+{
+public:
+    SectionWriter(std::ofstream& out, bool const compress)
+        : _out(out), _compress(compress)
+    {
+    }
+
+    void addSection(Format::Section section, void const* const data,
+                    std::size_t const size, std::string const& name = "")
+    {
+        alignTo8();
+        section.offset = static_cast<std::uint64_t>(_out.tellp());
+        section.raw_size = size;
+        section.name_offset = static_cast<std::uint32_t>(_strings.size());
+        section.name_length = static_cast<std::uint32_t>(name.size());
+        _strings += name;
+
+        if (_compress && size > 0)
+        {
+            uLongf compressed_size = compressBound(static_cast<uLong>(size));
+            std::vector<Bytef> compressed(compressed_size);
+            if (compress2(compressed.data(), &compressed_size,
+                          static_cast<Bytef const*>(data),
+                          static_cast<uLong>(size), Z_BEST_SPEED) != Z_OK)
+            {
+                ERR("Compression of a mesh section failed.");
+                _failed = true;
+                return;
+            }
+            section.compression = Format::Compression::ZLib;
+            section.stored_size = compressed_size;
+            _out.write(reinterpret_cast<char const*>(compressed.data()),
+                       compressed_size);
+        }
+        else
+        {
+            section.compression = Format::Compression::None;
+            section.stored_size = size;
+            _out.write(static_cast<char const*>(data), size);
+        }
+        _sections.push_back(section);
+    }
+
+    template <typename T>
+    bool addProperty(MeshLib::Properties const& properties,
+                     std::string const& name)
+    {
+        if (!properties.existsPropertyVector<T>(name))
+            return false;
+        auto const& p = *properties.getPropertyVector<T>(name);
+        Format::Section section{};
+        section.kind = Format::SectionKind::Property;
+        section.value_type = Format::ValueTypeOf<T>::value;
+        section.item_type = static_cast<std::uint8_t>(p.getMeshItemType());
+        section.n_components =
+            static_cast<std::uint32_t>(p.getNumberOfComponents());
+        addSection(section, p.data(), p.size() * sizeof(T), name);
+        return true;
+    }
+
+    /// Writes the string table, the section table and the final header.
+    bool finish(Format::Header header)
+    {
+        alignTo8();
+        header.strings_offset = static_cast<std::uint64_t>(_out.tellp());
+        header.strings_size = _strings.size();
+        _out.write(_strings.data(), _strings.size());
+
+        alignTo8();
+        header.section_table_offset = static_cast<std::uint64_t>(_out.tellp());
+        header.n_sections = _sections.size();
+        _out.write(reinterpret_cast<char const*>(_sections.data()),
+                   _sections.size() * sizeof(Format::Section));
+
+        _out.seekp(0);
+        _out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+        return !_failed && static_cast<bool>(_out);
+    }
+
+    void addString(std::string const& s) { _strings += s; }
+
+private:
+    void alignTo8()
+    {
+        char const zeros[8] = {};
+        auto const position = static_cast<std::size_t>(_out.tellp());
+        if (position % 8 != 0)
+            _out.write(zeros, 8 - position % 8);
+    }
+
+    std::ofstream& _out;
+    bool const _compress;
+    std::vector<Format::Section> _sections;
+    std::string _strings;
+    bool _failed = false;
+};
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+bool writeBinaryMesh(MeshLib::Mesh const& mesh, std::string const& file_name,
+                     bool const compress)
+{
+    std::ofstream out(file_name, std::ios::binary);
+    if (!out)
+    {
+        ERR("writeBinaryMesh(): Could not open file %s.", file_name.c_str());
+        return false;
+    }
+
+    Format::Header header{};
+    std::memcpy(header.magic, Format::magic, sizeof(header.magic));
+    header.version = Format::version;
+    header.header_size = sizeof(Format::Header);
+    header.n_nodes = mesh.getNumberOfNodes();
+    header.n_base_nodes = mesh.getNumberOfBaseNodes();
+    header.n_elements = mesh.getNumberOfElements();
+    header.mesh_name_length = mesh.getName().size();
+    out.write(reinterpret_cast<char const*>(&header), sizeof(header));
+
+    SectionWriter writer(out, compress);
+    writer.addString(mesh.getName());
+
+    {
+        std::vector<double> coordinates;
+        coordinates.reserve(3 * mesh.getNumberOfNodes());
+        for (auto const* node : mesh.getNodes())
+            coordinates.insert(coordinates.end(), node->getCoords(),
+                               node->getCoords() + 3);
+        Format::Section section{};
+        section.kind = Format::SectionKind::Nodes;
+        writer.addSection(section, coordinates.data(),
+                          coordinates.size() * sizeof(double));
+    }
+
+    {
+        std::vector<std::uint8_t> cell_types;
+        std::vector<std::uint64_t> offsets;
+        std::vector<std::uint64_t> connectivity;
+        cell_types.reserve(mesh.getNumberOfElements());
+        offsets.reserve(mesh.getNumberOfElements() + 1);
+        offsets.push_back(0);
+        for (auto const* element : mesh.getElements())
+        {
+            cell_types.push_back(
+                static_cast<std::uint8_t>(element->getCellType()));
+            for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+                connectivity.push_back(element->getNodeIndex(i));
+            offsets.push_back(connectivity.size());
+        }
+
+        Format::Section section{};
+        section.kind = Format::SectionKind::CellTypes;
+        writer.addSection(section, cell_types.data(), cell_types.size());
+        section.kind = Format::SectionKind::ElementOffsets;
+        writer.addSection(section, offsets.data(),
+                          offsets.size() * sizeof(std::uint64_t));
+        section.kind = Format::SectionKind::Connectivity;
+        writer.addSection(section, connectivity.data(),
+                          connectivity.size() * sizeof(std::uint64_t));
+    }
+
+    auto const& properties = mesh.getProperties();
+    for (auto const& name : properties.getPropertyVectorNames())
+    {
+        if (writer.addProperty<double>(properties, name))
+            continue;
+        if (writer.addProperty<int>(properties, name))
+            continue;
+        if (writer.addProperty<unsigned>(properties, name))
+            continue;
+        if (writer.addProperty<std::uint64_t>(properties, name))
+            continue;
+        if (writer.addProperty<std::int64_t>(properties, name))
+            continue;
+        if (writer.addProperty<char>(properties, name))
+            continue;
+        if (writer.addProperty<unsigned char>(properties, name))
+            continue;
+        if (writer.addProperty<float>(properties, name))
+            continue;
+        WARN("writeBinaryMesh(): Property \"%s\" has an unsupported data "
+             "type and is not written.",
+             name.c_str());
+    }
+
+    if (!writer.finish(header))
+    {
+        ERR("writeBinaryMesh(): Writing file %s failed.", file_name.c_str());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -0,0 +1,36 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/**
+ * Writes the mesh in the binary OGS mesh format described in
+ * BinaryMeshFormat.h.
+ *
+ * Properties of the types char, unsigned char, int, unsigned, 64 bit
+ * integers, float and double are written; others are skipped with a warning.
+ *
+ * \param mesh The mesh to be written.
+ * \param file_name The name of the output file.
+ * \param compress If true, every section is compressed with zlib.
+ * \return True on success.
+ */
+bool writeBinaryMesh(MeshLib::Mesh const& mesh, std::string const& file_name,
+                     bool compress = false);
+
+}  // namespace IO
+}  // namespace MeshLib
@@ -14,12 +14,18 @@
 
 #include "NodePartitionedMeshReader.h"
 
+#include <array>
+#include <fstream>
+#include <set>
+#include <unordered_map>
+
 #include <logog/include/logog.hpp>
 
 #ifdef USE_PETSC
 #include <mpi.h>
 #endif
 
+#include "BaseLib/Error.h"
 #include "BaseLib/FileTools.h"
 #include "BaseLib/RunTime.h"
 
@@ -40,6 +46,27 @@ is_safely_convertable(VALUE const& value)
     return result;
 }
 
+namespace
+{
+// Prepends the positions of the elements to element data stored one after
+// another, which is the layout of the element data in the partition files.
+std::vector<unsigned long> addElementDataOffsets(
+    std::vector<unsigned long> const& element_data,
+    unsigned long const n_elements)
+{
+    std::vector<unsigned long> data(n_elements);
+    unsigned long position = 0;
+    for (unsigned long e = 0; e < n_elements; ++e)
+    {
+        data[e] = n_elements + position;
+        // Material ID, element type, number of nodes, and node IDs.
+        position += 3 + element_data[position + 2];
+    }
+    data.insert(data.end(), element_data.begin(), element_data.end());
+    return data;
+}
+}  // namespace
+
 namespace MeshLib
 {
 namespace IO
@@ -81,18 +108,36 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::read(
     std::string const fname_new = file_name_base + "_partitioned_msh_cfg" +
         std::to_string(_mpi_comm_size) + ".bin";
 
-    if(!BaseLib::IsFileExisting(fname_new)) // doesn't exist binary file.
-    {
-        INFO("Reading ASCII mesh file ...");
+    // Binary files of a partitioning independent of the number of processes.
+    std::string const fname_parts =
+        file_name_base + "_partitioned_msh_parts.txt";
 
-        mesh = readASCII(file_name_base);
-    }
-    else
+    if (BaseLib::IsFileExisting(fname_new))
     {
         INFO("Reading binary mesh file ...");
 
         mesh = readBinary(file_name_base);
     }
+    else if (BaseLib::IsFileExisting(fname_parts))
+    {
+        int number_of_partitions = 0;
+        std::ifstream is_parts(fname_parts);
+        if (!(is_parts >> number_of_partitions))
+            OGS_FATAL("Could not read the number of partitions from '%s'.",
+                      fname_parts.c_str());
+
+        INFO("Reading binary mesh file of %d partitions ...",
+             number_of_partitions);
+
+        mesh = readBinaryMergingPartitions(file_name_base,
+                                           number_of_partitions);
+    }
+    else  // doesn't exist binary file.
+    {
+        INFO("Reading ASCII mesh file ...");
+
+        mesh = readASCII(file_name_base);
+    }
 
     INFO("[time] Reading the mesh took %f s.", timer.elapsed());
 
@@ -189,30 +234,251 @@ MeshLib::NodePartitionedMesh* NodePartitionedMeshReader::readBinary(
 
     //----------------------------------------------------------------------------------
     // read the properties
-    MeshLib::Properties p(readPropertiesBinary(file_name_base));
+    PartitionRange const partitions{_mpi_comm_size,
+                                    static_cast<unsigned long>(_mpi_rank), 1};
+    MeshLib::Properties p(
+        readPropertiesBinary(file_name_base, partitions, {}, {}));
+
+    return newMesh(BaseLib::extractBaseName(file_name_base), mesh_nodes,
+                   glb_node_ids, mesh_elems, p);
+}
+
+MeshLib::NodePartitionedMesh*
+NodePartitionedMeshReader::readBinaryMergingPartitions(
+    const std::string& file_name_base, int const number_of_partitions)
+{
+    if (number_of_partitions < _mpi_comm_size)
+        OGS_FATAL(
+            "The mesh is partitioned into %d partitions, which cannot be "
+            "distributed to %d processes.",
+            number_of_partitions, _mpi_comm_size);
+
+    // Contiguous ranges of partitions keep the global IDs of the non-ghost
+    // nodes of each rank contiguous.
+    PartitionRange partitions;
+    partitions.number_of_partitions = number_of_partitions;
+    partitions.first = static_cast<unsigned long>(_mpi_rank) *
+                       number_of_partitions / _mpi_comm_size;
+    partitions.size = (_mpi_rank + 1ul) * number_of_partitions /
+                          _mpi_comm_size -
+                      partitions.first;
+
+    const std::string fname_header = file_name_base + "_partitioned_msh_";
+    const std::string fname_num_p_ext =
+        std::to_string(number_of_partitions) + ".bin";
+
+    //----------------------------------------------------------------------------------
+    // Read headers. The data of the partitions of this rank are stored one
+    // after another in each of the files.
+    std::vector<unsigned long> info_data(partitions.size * _mesh_info.size());
+    if (!readBinaryDataFromFile(
+            fname_header + "cfg" + fname_num_p_ext,
+            static_cast<MPI_Offset>(partitions.first * sizeof(_mesh_info)),
+            MPI_LONG, info_data))
+        return nullptr;
+
+    std::vector<PartitionedMeshInfo> infos(partitions.size);
+    unsigned long n_nodes = 0;
+    unsigned long n_elem_data = 0;
+    unsigned long n_ghost_elem_data = 0;
+    for (std::size_t k = 0; k < infos.size(); ++k)
+    {
+        std::copy_n(info_data.begin() + k * _mesh_info.size(),
+                    _mesh_info.size(), infos[k].data());
+        n_nodes += infos[k].nodes;
+        n_elem_data += infos[k].regular_elements + infos[k].offset[0];
+        n_ghost_elem_data += infos[k].ghost_elements + infos[k].offset[1];
+    }
+
+    //----------------------------------------------------------------------------------
+    // Read nodes and elements of all partitions of this rank.
+    std::vector<NodeData> nodes(n_nodes);
+    if (!readBinaryDataFromFile(fname_header + "nod" + fname_num_p_ext,
+            static_cast<MPI_Offset>(infos[0].offset[2]), _mpi_node_type,
+            nodes))
+        return nullptr;
+
+    std::vector<unsigned long> elem_data(n_elem_data);
+    if (!readBinaryDataFromFile(fname_header + "ele" + fname_num_p_ext,
+            static_cast<MPI_Offset>(infos[0].offset[3]), MPI_LONG, elem_data))
+        return nullptr;
+
+    std::vector<unsigned long> ghost_elem_data(n_ghost_elem_data);
+    if (!readBinaryDataFromFile(fname_header + "ele_g" + fname_num_p_ext,
+            static_cast<MPI_Offset>(infos[0].offset[4]), MPI_LONG,
+            ghost_elem_data))
+        return nullptr;
+
+    //----------------------------------------------------------------------------------
+    // Merge the nodes. The nodes of each partition are stored as active base
+    // nodes, ghost base nodes, active extra nodes and ghost extra nodes, and
+    // the merged nodes are collected in the same order. Ghost nodes of a
+    // partition are skipped, if they are active in another partition of this
+    // rank, or if they are ghost nodes of a previous partition.
+    std::unordered_map<unsigned long, std::size_t> merged_node_ids;
+    std::vector<NodeData> merged_nodes;
+    // Position of each merged node in the read data, i.e. its node property
+    // tuple.
+    std::vector<std::size_t> node_tuples;
+    std::array<std::size_t, 4> section_sizes{};
+    for (std::size_t section = 0; section < 4; ++section)
+    {
+        std::size_t partition_offset = 0;
+        for (auto const& info : infos)
+        {
+            std::array<unsigned long, 5> const section_begin{
+                {0, info.active_base_nodes, info.base_nodes,
+                 info.base_nodes + info.active_nodes - info.active_base_nodes,
+                 info.nodes}};
+            for (auto i = section_begin[section];
+                 i < section_begin[section + 1]; ++i)
+            {
+                auto const& node = nodes[partition_offset + i];
+                if (!merged_node_ids
+                         .emplace(node.index, merged_nodes.size())
+                         .second)
+                    continue;
+                merged_nodes.push_back(node);
+                node_tuples.push_back(partition_offset + i);
+            }
+            partition_offset += info.nodes;
+        }
+        section_sizes[section] = merged_nodes.size();
+    }
+    _mesh_info.nodes = merged_nodes.size();
+    _mesh_info.active_base_nodes = section_sizes[0];
+    _mesh_info.base_nodes = section_sizes[1];
+    _mesh_info.active_nodes =
+        section_sizes[0] + section_sizes[2] - section_sizes[1];
+    _mesh_info.global_base_nodes = infos[0].global_base_nodes;
+    _mesh_info.global_nodes = infos[0].global_nodes;
+
+    auto const is_active = [this](std::size_t const node_id) {
+        return node_id < _mesh_info.active_base_nodes ||
+               (node_id >= _mesh_info.base_nodes &&
+                node_id < _mesh_info.base_nodes + _mesh_info.active_nodes -
+                              _mesh_info.active_base_nodes);
+    };
+
+    //----------------------------------------------------------------------------------
+    // Merge the elements. Regular elements of a partition are regular
+    // elements of the merged subdomain. Ghost elements become regular if all
+    // their nodes are active in the subdomain. Ghost elements shared by
+    // partitions of this rank are taken only once.
+    std::vector<unsigned long> merged_elem_data;
+    std::vector<unsigned long> merged_ghost_elem_data;
+    // Position of each merged element in the read data, i.e. its cell
+    // property tuple.
+    std::vector<std::size_t> regular_cell_tuples;
+    std::vector<std::size_t> ghost_cell_tuples;
+    std::set<std::vector<unsigned long>> merged_ghost_elements;
+
+    std::size_t node_offset = 0;
+    std::size_t cell_tuple_offset = 0;
+    unsigned long const* partition_elem_data = elem_data.data();
+    unsigned long const* partition_ghost_elem_data = ghost_elem_data.data();
+    std::vector<unsigned long> element;
+    for (auto const& info : infos)
+    {
+        // Element data as material ID, type, number of nodes, and node IDs
+        // of the merged subdomain.
+        auto const merge_element = [&](unsigned long const* const data) {
+            unsigned long const n_element_nodes = data[2];
+            element.assign(data, data + 3);
+            for (unsigned long k = 0; k < n_element_nodes; ++k)
+                element.push_back(merged_node_ids.at(
+                    nodes[node_offset + data[3 + k]].index));
+            return std::all_of(element.begin() + 3, element.end(),
+                               is_active);
+        };
+
+        for (unsigned long e = 0; e < info.regular_elements; ++e)
+        {
+            merge_element(partition_elem_data + partition_elem_data[e]);
+            merged_elem_data.insert(merged_elem_data.end(), element.begin(),
+                                    element.end());
+            regular_cell_tuples.push_back(cell_tuple_offset + e);
+        }
+        cell_tuple_offset += info.regular_elements;
+
+        for (unsigned long e = 0; e < info.ghost_elements; ++e)
+        {
+            bool const regular = merge_element(
+                partition_ghost_elem_data + partition_ghost_elem_data[e]);
+            if (!merged_ghost_elements.insert(element).second)
+                continue;
+            auto& data = regular ? merged_elem_data : merged_ghost_elem_data;
+            data.insert(data.end(), element.begin(), element.end());
+            (regular ? regular_cell_tuples : ghost_cell_tuples)
+                .push_back(cell_tuple_offset + e);
+        }
+        cell_tuple_offset += info.ghost_elements;
+
+        node_offset += info.nodes;
+        partition_elem_data += info.regular_elements + info.offset[0];
+        partition_ghost_elem_data += info.ghost_elements + info.offset[1];
+    }
+    std::vector<NodeData>().swap(nodes);
+    std::vector<unsigned long>().swap(elem_data);
+    std::vector<unsigned long>().swap(ghost_elem_data);
+
+    _mesh_info.regular_elements = regular_cell_tuples.size();
+    _mesh_info.ghost_elements = ghost_cell_tuples.size();
+
+    //----------------------------------------------------------------------------------
+    // Create the subdomain mesh from the merged data, which are brought into
+    // the layout of a single partition.
+    std::vector<MeshLib::Node*> mesh_nodes;
+    std::vector<unsigned long> glb_node_ids;
+    setNodes(merged_nodes, mesh_nodes, glb_node_ids);
+
+    std::vector<MeshLib::Element*> mesh_elems(_mesh_info.regular_elements +
+                                              _mesh_info.ghost_elements);
+    setElements(mesh_nodes,
+                addElementDataOffsets(merged_elem_data,
+                                      _mesh_info.regular_elements),
+                mesh_elems);
+    const bool process_ghost = true;
+    setElements(mesh_nodes,
+                addElementDataOffsets(merged_ghost_elem_data,
+                                      _mesh_info.ghost_elements),
+                mesh_elems, process_ghost);
+
+    //----------------------------------------------------------------------------------
+    // read the properties
+    std::vector<std::size_t> cell_tuples(std::move(regular_cell_tuples));
+    cell_tuples.insert(cell_tuples.end(), ghost_cell_tuples.begin(),
+                       ghost_cell_tuples.end());
+    MeshLib::Properties p(readPropertiesBinary(file_name_base, partitions,
+                                               node_tuples, cell_tuples));
 
     return newMesh(BaseLib::extractBaseName(file_name_base), mesh_nodes,
                    glb_node_ids, mesh_elems, p);
 }
 
 MeshLib::Properties NodePartitionedMeshReader::readPropertiesBinary(
-    const std::string& file_name_base) const
+    const std::string& file_name_base, PartitionRange const& partitions,
+    std::vector<std::size_t> const& node_tuples,
+    std::vector<std::size_t> const& cell_tuples) const
 {
     MeshLib::Properties p;
-    readPropertiesBinary(file_name_base, MeshLib::MeshItemType::Node, p);
-    readPropertiesBinary(file_name_base, MeshLib::MeshItemType::Cell, p);
+    readPropertiesBinary(file_name_base, MeshLib::MeshItemType::Node,
+                         partitions, node_tuples, p);
+    readPropertiesBinary(file_name_base, MeshLib::MeshItemType::Cell,
+                         partitions, cell_tuples, p);
     return p;
 }
 
 void NodePartitionedMeshReader::readPropertiesBinary(
     const std::string& file_name_base, MeshLib::MeshItemType t,
+    PartitionRange const& partitions, std::vector<std::size_t> const& tuples,
     MeshLib::Properties& p) const
 {
     std::string const item_type =
         t == MeshLib::MeshItemType::Node ? "node" : "cell";
-    const std::string fname_cfg = file_name_base + "_partitioned_" + item_type +
-                                  "_properties_cfg" +
-                                  std::to_string(_mpi_comm_size) + ".bin";
+    const std::string fname_cfg =
+        file_name_base + "_partitioned_" + item_type + "_properties_cfg" +
+        std::to_string(partitions.number_of_partitions) + ".bin";
     std::ifstream is(fname_cfg.c_str(), std::ios::binary | std::ios::in);
     if (!is)
     {
@@ -243,11 +509,20 @@ void NodePartitionedMeshReader::readPropertiesBinary(
     auto pos = is.tellg();
     auto offset =
         static_cast<long>(pos) +
-        static_cast<long>(_mpi_rank *
+        static_cast<long>(partitions.first *
                           sizeof(MeshLib::IO::PropertyVectorPartitionMetaData));
     is.seekg(offset);
+    // The tuples of consecutive partitions are stored consecutively.
     boost::optional<MeshLib::IO::PropertyVectorPartitionMetaData> pvpmd(
         MeshLib::IO::readPropertyVectorPartitionMetaData(is));
+    for (unsigned long k = 1; pvpmd && k < partitions.size; ++k)
+    {
+        auto const next = MeshLib::IO::readPropertyVectorPartitionMetaData(is);
+        if (next)
+            pvpmd->number_of_tuples += next->number_of_tuples;
+        else
+            pvpmd = boost::none;
+    }
     bool pvpmd_read_ok = static_cast<bool>(pvpmd);
     bool all_pvpmd_read_ok;
     MPI_Allreduce(&pvpmd_read_ok, &all_pvpmd_read_ok, 1, MPI_C_BOOL, MPI_LOR,
@@ -263,16 +538,17 @@ void NodePartitionedMeshReader::readPropertiesBinary(
     DBUG("[%d] %d tuples in partition.", _mpi_rank, pvpmd->number_of_tuples);
     is.close();
 
-    const std::string fname_val = file_name_base + "_partitioned_" + item_type +
-                                  "_properties_val" +
-                                  std::to_string(_mpi_comm_size) + ".bin";
+    const std::string fname_val =
+        file_name_base + "_partitioned_" + item_type + "_properties_val" +
+        std::to_string(partitions.number_of_partitions) + ".bin";
     is.open(fname_val.c_str(), std::ios::binary | std::ios::in);
     if (!is)
     {
         ERR("Could not open file '%s' in binary mode.", fname_val.c_str());
     }
 
-    readDomainSpecificPartOfPropertyVectors(vec_pvmd, *pvpmd, t, is, p);
+    readDomainSpecificPartOfPropertyVectors(vec_pvmd, *pvpmd, t, tuples, is,
+                                            p);
 }
 
 void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
@@ -280,6 +556,7 @@ void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
         vec_pvmd,
     MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
     MeshLib::MeshItemType t,
+    std::vector<std::size_t> const& tuples,
     std::istream& is,
     MeshLib::Properties& p) const
 {
@@ -297,31 +574,31 @@ void NodePartitionedMeshReader::readDomainSpecificPartOfPropertyVectors(
             {
                 if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(int))
                     createPropertyVectorPart<int>(is, *vec_pvmd[i], pvpmd, t,
-                                                  global_offset, p);
+                                                  global_offset, tuples, p);
                 if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(long))
                     createPropertyVectorPart<long>(is, *vec_pvmd[i], pvpmd, t,
-                                                   global_offset, p);
+                                                   global_offset, tuples, p);
             }
             else
             {
                 if (vec_pvmd[i]->data_type_size_in_bytes ==
                     sizeof(unsigned int))
                     createPropertyVectorPart<unsigned int>(
-                        is, *vec_pvmd[i], pvpmd, t, global_offset, p);
+                        is, *vec_pvmd[i], pvpmd, t, global_offset, tuples, p);
                 if (vec_pvmd[i]->data_type_size_in_bytes ==
                     sizeof(unsigned long))
                     createPropertyVectorPart<unsigned long>(
-                        is, *vec_pvmd[i], pvpmd, t, global_offset, p);
+                        is, *vec_pvmd[i], pvpmd, t, global_offset, tuples, p);
             }
         }
         else
         {
             if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(float))
                 createPropertyVectorPart<float>(is, *vec_pvmd[i], pvpmd, t,
-                                                global_offset, p);
+                                                global_offset, tuples, p);
             if (vec_pvmd[i]->data_type_size_in_bytes == sizeof(double))
                 createPropertyVectorPart<double>(is, *vec_pvmd[i], pvpmd, t,
-                                                 global_offset, p);
+                                                 global_offset, tuples, p);
         }
         global_offset += vec_pvmd[i]->data_type_size_in_bytes *
                          vec_pvmd[i]->number_of_tuples *
@@ -13,6 +13,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <iosfwd>
 #include <string>
 #include <vector>
@@ -45,6 +46,11 @@ public:
          \brief Create a NodePartitionedMesh object, read data to it,
                 and return a pointer to it. Data files are either in
                 ASCII format or binary format.
+
+                If there are no files partitioned for the number of
+                processes, the binary files of a finer partitioning listed in
+                file_name_base+_partitioned_msh_parts.txt are read, see
+                readBinaryMergingPartitions().
          \param file_name_base  Name of file to be read, and it must be base name without name extension.
          \return                Pointer to Mesh object. If the creation of mesh object
                                 fails, return a null pointer.
@@ -76,6 +82,14 @@ private:
     /// Define MPI data type for NodeData struct.
     void registerNodeDataMpiType();
 
+    /// The partitions of the partitioned mesh files read by this rank.
+    struct PartitionRange
+    {
+        int number_of_partitions;  ///< Number of partitions in the files.
+        unsigned long first;       ///< First partition read by this rank.
+        unsigned long size;        ///< Number of partitions read by this rank.
+    };
+
     /// A collection of integers that configure the partitioned mesh data.
     struct PartitionedMeshInfo
     {
@@ -165,11 +179,41 @@ private:
      */
     MeshLib::NodePartitionedMesh* readBinary(const std::string &file_name_base);
 
+    /*!
+         \brief Create a NodePartitionedMesh object from binary files of a
+                mesh partitioned into more partitions than there are
+                processes.
+
+                Each rank reads a contiguous range of the partitions and
+                merges them into one subdomain. Nodes owned by one of the
+                merged partitions become non-ghost nodes of the subdomain and
+                ghost elements of the partitions, whose nodes are all owned
+                by the subdomain, become regular elements. The ghost layer
+                of the subdomain is thereby the same as if the mesh had been
+                partitioned for the number of processes directly. Since the
+                global node IDs of consecutive partitions are consecutive,
+                the non-ghost nodes of each rank keep contiguous global IDs.
+         \param file_name_base  Name of file to be read, which must be a
+                name with the path to the file and without file extension.
+         \param number_of_partitions Number of partitions in the files, at
+                least the number of processes.
+         \return           Pointer to Mesh object.
+     */
+    MeshLib::NodePartitionedMesh* readBinaryMergingPartitions(
+        const std::string& file_name_base, int number_of_partitions);
+
+    /// Reads the node and cell properties of the given partitions. If not
+    /// empty, \c node_tuples and \c cell_tuples select and order the tuples
+    /// out of all tuples of these partitions.
     MeshLib::Properties readPropertiesBinary(
-        const std::string& file_name_base) const;
+        const std::string& file_name_base, PartitionRange const& partitions,
+        std::vector<std::size_t> const& node_tuples,
+        std::vector<std::size_t> const& cell_tuples) const;
 
     void readPropertiesBinary(const std::string& file_name_base,
                               MeshLib::MeshItemType t,
+                              PartitionRange const& partitions,
+                              std::vector<std::size_t> const& tuples,
                               MeshLib::Properties& p) const;
 
     void readDomainSpecificPartOfPropertyVectors(
@@ -177,6 +221,7 @@ private:
             vec_pvmd,
         MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
         MeshLib::MeshItemType t,
+        std::vector<std::size_t> const& tuples,
         std::istream& is,
         MeshLib::Properties& p) const;
 
@@ -185,6 +230,7 @@ private:
         std::istream& is, MeshLib::IO::PropertyVectorMetaData const& pvmd,
         MeshLib::IO::PropertyVectorPartitionMetaData const& pvpmd,
         MeshLib::MeshItemType t, unsigned long global_offset,
+        std::vector<std::size_t> const& tuples,
         MeshLib::Properties& p) const
     {
         MeshLib::PropertyVector<T>* pv = p.createNewPropertyVector<T>(
@@ -202,6 +248,16 @@ private:
                 "Error in NodePartitionedMeshReader::readPropertiesBinary: "
                 "Could not read part %d of the PropertyVector.",
                 _mpi_rank);
+
+        if (tuples.empty())
+            return;
+        // Select the tuples of the merged partitions.
+        std::vector<T> const values(pv->begin(), pv->end());
+        auto const n_components = pvmd.number_of_components;
+        pv->resize(tuples.size() * n_components);
+        for (std::size_t i = 0; i < tuples.size(); ++i)
+            std::copy_n(values.begin() + tuples[i] * n_components,
+                        n_components, pv->begin() + i * n_components);
     }
 
     /*!
@@ -34,6 +34,7 @@
 #include "MeshLib/Mesh.h"
 #include "MeshLib/MeshGenerators/VtkMeshConverter.h"
 #include "MeshLib/Vtk/VtkMappedMeshSource.h"
+#include "VtuReader.h"
 
 namespace MeshLib
 {
@@ -54,6 +55,11 @@ MeshLib::Mesh* VtuInterface::readVTUFile(std::string const &file_name)
         return nullptr;
     }
 
+    // Files using features not handled by the native reader are read via
+    // VTK.
+    if (auto* const mesh = readVTUFileNative(file_name))
+        return mesh;
+
     vtkSmartPointer<vtkXMLUnstructuredGridReader> reader =
         vtkSmartPointer<vtkXMLUnstructuredGridReader>::New();
     reader->SetFileName(file_name.c_str());
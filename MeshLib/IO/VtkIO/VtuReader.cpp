@@ -0,0 +1,904 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "VtuReader.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <logog/include/logog.hpp>
+#include <vtkCellType.h>
+#include <vtk_zlib.h>
+
+#include "BaseLib/FileTools.h"
+#include "MeshLib/Elements/Elements.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+/// Signals a file that cannot be read by this reader; the message is logged.
+struct VtuReadError : std::runtime_error
+{
+    using std::runtime_error::runtime_error;
+};
+
+bool isWhitespace(char const c)
+{
+    return std::isspace(static_cast<unsigned char>(c)) != 0;
+}
+
+struct XmlTag
+{
+    std::string name;
+    std::map<std::string, std::string> attributes;
+    bool is_closing = false;
+    bool is_self_closing = false;
+    char const* begin = nullptr;  ///< Position of the opening '<'.
+    char const* end = nullptr;    ///< Position after the closing '>'.
+
+    std::string attribute(std::string const& key,
+                          std::string const& default_value = "") const
+    {
+        auto const it = attributes.find(key);
+        return it == attributes.end() ? default_value : it->second;
+    }
+};
+
+/// Reads the next tag in [p, end) and advances p behind it. Comments and
+/// processing instructions are skipped. Returns false if there is no tag.
+bool readNextTag(char const*& p, char const* const end, XmlTag& tag)
+{
+    while (true)
+    {
+        p = std::find(p, end, '<');
+        if (end - p < 2)
+            return false;
+        if (p[1] == '!' && end - p >= 4 && std::strncmp(p, "<!--", 4) == 0)
+        {
+            char const* const comment_end = "-->";
+            p = std::search(p, end, comment_end, comment_end + 3);
+            continue;
+        }
+        if (p[1] == '?' || p[1] == '!')
+        {
+            p = std::find(p, end, '>');
+            continue;
+        }
+        break;
+    }
+
+    tag = XmlTag{};
+    tag.begin = p;
+    char const* q = p + 1;
+    if (q < end && *q == '/')
+    {
+        tag.is_closing = true;
+        ++q;
+    }
+    char const* const name_begin = q;
+    while (q < end && !isWhitespace(*q) && *q != '>' && *q != '/')
+        ++q;
+    tag.name.assign(name_begin, q);
+
+    while (q < end)
+    {
+        while (q < end && isWhitespace(*q))
+            ++q;
+        if (q == end)
+            break;
+        if (*q == '>')
+        {
+            tag.end = q + 1;
+            p = tag.end;
+            return true;
+        }
+        if (*q == '/')
+        {
+            tag.is_self_closing = true;
+            ++q;
+            continue;
+        }
+
+        char const* const key_begin = q;
+        while (q < end && *q != '=' && !isWhitespace(*q) && *q != '>')
+            ++q;
+        std::string const key(key_begin, q);
+        while (q < end && isWhitespace(*q))
+            ++q;
+        if (q == end || *q != '=')
+            break;
+        ++q;
+        while (q < end && isWhitespace(*q))
+            ++q;
+        if (q == end || (*q != '"' && *q != '\''))
+            break;
+        char const quote = *q++;
+        char const* const value_begin = q;
+        q = std::find(q, end, quote);
+        if (q == end)
+            break;
+        tag.attributes[key].assign(value_begin, q);
+        ++q;
+    }
+    throw VtuReadError("Malformed XML tag '" + tag.name + "'.");
+}
+
+std::size_t toSize(std::string const& value)
+{
+    return static_cast<std::size_t>(std::strtoull(value.c_str(), nullptr, 10));
+}
+
+/// Description of a DataArray element.
+struct DataArray
+{
+    std::string type;
+    std::string name;
+    std::size_t n_components = 1;
+    std::size_t n_tuples = 0;  ///< Only given for field data.
+    std::string format;
+    std::size_t offset = 0;  ///< Offset into the appended data.
+    char const* content_begin = nullptr;  ///< Inline data.
+    char const* content_end = nullptr;
+};
+
+/// The parsed XML structure of a vtu-file with references into the mapped
+/// file content.
+struct VtuFile
+{
+    std::size_t header_size = 4;
+    bool compressed = false;
+    std::size_t n_points = 0;
+    std::size_t n_cells = 0;
+
+    DataArray points;
+    DataArray connectivity;
+    DataArray offsets;
+    DataArray types;
+    std::vector<DataArray> point_data;
+    std::vector<DataArray> cell_data;
+    std::vector<DataArray> field_data;
+
+    char const* appended_begin = nullptr;
+    bool appended_base64 = false;
+    char const* end = nullptr;
+};
+
+bool isLittleEndianHost()
+{
+    std::uint16_t const one = 1;
+    unsigned char first_byte;
+    std::memcpy(&first_byte, &one, 1);
+    return first_byte == 1;
+}
+
+VtuFile parseVtuFile(char const* const begin, char const* const end)
+{
+    VtuFile file;
+    file.end = end;
+
+    enum class Section
+    {
+        None,
+        PointData,
+        CellData,
+        FieldData,
+        Points,
+        Cells
+    };
+    Section section = Section::None;
+    std::size_t n_pieces = 0;
+
+    char const* p = begin;
+    XmlTag tag;
+    while (readNextTag(p, end, tag))
+    {
+        if (tag.is_closing)
+        {
+            if (tag.name == "PointData" || tag.name == "CellData" ||
+                tag.name == "FieldData" || tag.name == "Points" ||
+                tag.name == "Cells")
+                section = Section::None;
+            continue;
+        }
+
+        if (tag.name == "VTKFile")
+        {
+            if (tag.attribute("type") != "UnstructuredGrid")
+                throw VtuReadError("The file is not an unstructured grid.");
+            if (tag.attribute("byte_order", "LittleEndian") !=
+                    "LittleEndian" ||
+                !isLittleEndianHost())
+                throw VtuReadError("Only little endian data are supported.");
+            auto const header_type = tag.attribute("header_type", "UInt32");
+            if (header_type != "UInt32" && header_type != "UInt64")
+                throw VtuReadError("Unsupported header type " + header_type +
+                                   ".");
+            file.header_size = header_type == "UInt64" ? 8 : 4;
+            auto const compressor = tag.attribute("compressor");
+            if (!compressor.empty() && compressor != "vtkZLibDataCompressor")
+                throw VtuReadError("Unsupported compressor " + compressor +
+                                   ".");
+            file.compressed = !compressor.empty();
+        }
+        else if (tag.name == "Piece")
+        {
+            if (++n_pieces > 1)
+                throw VtuReadError("Files with several pieces are not "
+                                   "supported.");
+            file.n_points = toSize(tag.attribute("NumberOfPoints"));
+            file.n_cells = toSize(tag.attribute("NumberOfCells"));
+        }
+        else if (tag.name == "PointData" && !tag.is_self_closing)
+            section = Section::PointData;
+        else if (tag.name == "CellData" && !tag.is_self_closing)
+            section = Section::CellData;
+        else if (tag.name == "FieldData" && !tag.is_self_closing)
+            section = Section::FieldData;
+        else if (tag.name == "Points" && !tag.is_self_closing)
+            section = Section::Points;
+        else if (tag.name == "Cells" && !tag.is_self_closing)
+            section = Section::Cells;
+        else if (tag.name == "DataArray")
+        {
+            DataArray array;
+            array.type = tag.attribute("type");
+            array.name = tag.attribute("Name");
+            array.n_components =
+                toSize(tag.attribute("NumberOfComponents", "1"));
+            array.n_tuples = toSize(tag.attribute("NumberOfTuples", "0"));
+            array.format = tag.attribute("format", "ascii");
+            array.offset = toSize(tag.attribute("offset", "0"));
+            if (array.format != "appended")
+            {
+                if (tag.is_self_closing)
+                    throw VtuReadError("DataArray '" + array.name +
+                                       "' has no data.");
+                array.content_begin = tag.end;
+                do
+                {
+                    if (!readNextTag(p, end, tag))
+                        throw VtuReadError("DataArray '" + array.name +
+                                           "' is not closed.");
+                } while (!(tag.is_closing && tag.name == "DataArray"));
+                array.content_end = tag.begin;
+            }
+
+            switch (section)
+            {
+                case Section::PointData:
+                    file.point_data.push_back(array);
+                    break;
+                case Section::CellData:
+                    file.cell_data.push_back(array);
+                    break;
+                case Section::FieldData:
+                    file.field_data.push_back(array);
+                    break;
+                case Section::Points:
+                    file.points = array;
+                    break;
+                case Section::Cells:
+                    if (array.name == "connectivity")
+                        file.connectivity = array;
+                    else if (array.name == "offsets")
+                        file.offsets = array;
+                    else if (array.name == "types")
+                        file.types = array;
+                    break;
+                case Section::None:
+                    break;
+            }
+        }
+        else if (tag.name == "AppendedData")
+        {
+            auto const encoding = tag.attribute("encoding", "raw");
+            if (encoding != "raw" && encoding != "base64")
+                throw VtuReadError("Unsupported encoding " + encoding + ".");
+            file.appended_base64 = encoding == "base64";
+            // The data begin after the '_' following the tag. Any further
+            // content is binary and must not be parsed as XML.
+            file.appended_begin = std::find(tag.end, end, '_');
+            if (file.appended_begin == end)
+                throw VtuReadError("AppendedData has no data.");
+            ++file.appended_begin;
+            break;
+        }
+    }
+
+    if (file.points.type.empty() || file.connectivity.type.empty() ||
+        file.offsets.type.empty() || file.types.type.empty())
+        throw VtuReadError("The Points or Cells section is incomplete.");
+    return file;
+}
+
+std::size_t getTypeSize(std::string const& type)
+{
+    if (type == "Int8" || type == "UInt8")
+        return 1;
+    if (type == "Int16" || type == "UInt16")
+        return 2;
+    if (type == "Int32" || type == "UInt32" || type == "Float32")
+        return 4;
+    if (type == "Int64" || type == "UInt64" || type == "Float64")
+        return 8;
+    throw VtuReadError("Unsupported data type " + type + ".");
+}
+
+template <typename T>
+std::string getVtkTypeName()
+{
+    if (std::is_floating_point<T>::value)
+        return "Float" + std::to_string(8 * sizeof(T));
+    return (std::is_signed<T>::value ? "Int" : "UInt") +
+           std::to_string(8 * sizeof(T));
+}
+
+std::uint64_t readHeaderValue(unsigned char const* const p,
+                              std::size_t const header_size)
+{
+    if (header_size == 4)
+    {
+        std::uint32_t value;
+        std::memcpy(&value, p, 4);
+        return value;
+    }
+    std::uint64_t value;
+    std::memcpy(&value, p, 8);
+    return value;
+}
+
+int base64Value(char const c)
+{
+    if (c >= 'A' && c <= 'Z')
+        return c - 'A';
+    if (c >= 'a' && c <= 'z')
+        return c - 'a' + 26;
+    if (c >= '0' && c <= '9')
+        return c - '0' + 52;
+    if (c == '+')
+        return 62;
+    if (c == '/')
+        return 63;
+    return -1;  // padding or invalid
+}
+
+std::size_t getBase64Length(std::size_t const n_bytes)
+{
+    return 4 * ((n_bytes + 2) / 3);
+}
+
+/// Decodes n_bytes from the base64 encoded data beginning at p. The encoded
+/// groups of four characters are decoded in parallel.
+std::vector<unsigned char> decodeBase64(char const* const p,
+                                        char const* const end,
+                                        std::size_t const n_bytes)
+{
+    std::size_t const n_chars = getBase64Length(n_bytes);
+    if (static_cast<std::size_t>(end - p) < n_chars)
+        throw VtuReadError("Base64 encoded data are truncated.");
+
+    std::vector<unsigned char> bytes(3 * (n_chars / 4));
+    auto const n_groups = static_cast<long>(n_chars / 4);
+    bool valid = true;
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : valid)
+#endif
+    for (long g = 0; g < n_groups; ++g)
+    {
+        int v[4];
+        for (int k = 0; k < 4; ++k)
+            v[k] = std::max(base64Value(p[4 * g + k]), 0);
+        valid = valid && base64Value(p[4 * g]) >= 0 &&
+                base64Value(p[4 * g + 1]) >= 0;
+        bytes[3 * g] = static_cast<unsigned char>((v[0] << 2) | (v[1] >> 4));
+        bytes[3 * g + 1] =
+            static_cast<unsigned char>(((v[1] & 15) << 4) | (v[2] >> 2));
+        bytes[3 * g + 2] = static_cast<unsigned char>(((v[2] & 3) << 6) | v[3]);
+    }
+    if (!valid)
+        throw VtuReadError("Invalid base64 encoded data.");
+    bytes.resize(n_bytes);
+    return bytes;
+}
+
+/// Decompresses the zlib compressed blocks in parallel.
+void decompressBlocks(unsigned char const* const header,
+                      std::size_t const header_size,
+                      unsigned char const* const compressed,
+                      std::size_t const n_compressed_bytes, char* const out,
+                      std::size_t const n_bytes)
+{
+    auto const n_blocks = readHeaderValue(header, header_size);
+    auto const block_size = readHeaderValue(header + header_size, header_size);
+    auto last_block_size =
+        readHeaderValue(header + 2 * header_size, header_size);
+    if (last_block_size == 0)
+        last_block_size = block_size;
+    if (n_blocks == 0 ? n_bytes != 0
+                      : (n_blocks - 1) * block_size + last_block_size !=
+                            n_bytes)
+        throw VtuReadError("Size of compressed data does not match.");
+
+    std::vector<std::size_t> block_offsets(n_blocks + 1, 0);
+    for (std::size_t k = 0; k < n_blocks; ++k)
+        block_offsets[k + 1] =
+            block_offsets[k] +
+            readHeaderValue(header + (3 + k) * header_size, header_size);
+    if (block_offsets.back() > n_compressed_bytes)
+        throw VtuReadError("Compressed data are truncated.");
+
+    bool valid = true;
+    auto const n = static_cast<long>(n_blocks);
+#ifdef _OPENMP
+#pragma omp parallel for reduction(&& : valid)
+#endif
+    for (long k = 0; k < n; ++k)
+    {
+        uLongf size = k + 1 == n ? last_block_size : block_size;
+        uLongf const expected_size = size;
+        int const result = uncompress(
+            reinterpret_cast<Bytef*>(out + k * block_size), &size,
+            compressed + block_offsets[k],
+            static_cast<uLong>(block_offsets[k + 1] - block_offsets[k]));
+        valid = valid && result == Z_OK && size == expected_size;
+    }
+    if (!valid)
+        throw VtuReadError("Decompression of data failed.");
+}
+
+/// Reads n_bytes of binary data of an array, either raw or base64 encoded,
+/// beginning with the header.
+void readBinaryData(VtuFile const& file, char const* const p,
+                    bool const base64, char* const out,
+                    std::size_t const n_bytes)
+{
+    auto const hs = file.header_size;
+    auto const available = static_cast<std::size_t>(file.end - p);
+
+    if (!file.compressed)
+    {
+        // The header and the data are encoded together.
+        std::vector<unsigned char> header;
+        unsigned char const* data = nullptr;
+        std::vector<unsigned char> decoded;
+        if (base64)
+        {
+            header = decodeBase64(p, file.end, hs);
+            decoded = decodeBase64(p, file.end, hs + n_bytes);
+            data = decoded.data() + hs;
+        }
+        else
+        {
+            if (available < hs + n_bytes)
+                throw VtuReadError("Binary data are truncated.");
+            header.assign(p, p + hs);
+            data = reinterpret_cast<unsigned char const*>(p) + hs;
+        }
+        if (readHeaderValue(header.data(), hs) != n_bytes)
+            throw VtuReadError("Size of binary data does not match.");
+        std::memcpy(out, data, n_bytes);
+        return;
+    }
+
+    // The header of compressed data is followed by the compressed blocks. If
+    // base64 encoded, both are encoded separately.
+    std::vector<unsigned char> header;
+    if (base64)
+        header = decodeBase64(p, file.end, 3 * hs);
+    else
+    {
+        if (available < 3 * hs)
+            throw VtuReadError("Binary data are truncated.");
+        header.assign(p, p + 3 * hs);
+    }
+    auto const n_blocks = readHeaderValue(header.data(), hs);
+    std::size_t const header_bytes = (3 + n_blocks) * hs;
+
+    if (base64)
+    {
+        header = decodeBase64(p, file.end, header_bytes);
+        std::size_t n_compressed = 0;
+        for (std::size_t k = 0; k < n_blocks; ++k)
+            n_compressed += readHeaderValue(header.data() + (3 + k) * hs, hs);
+        char const* const blocks = p + getBase64Length(header_bytes);
+        auto const compressed = decodeBase64(blocks, file.end, n_compressed);
+        decompressBlocks(header.data(), hs, compressed.data(),
+                         compressed.size(), out, n_bytes);
+    }
+    else
+    {
+        if (available < header_bytes)
+            throw VtuReadError("Binary data are truncated.");
+        auto const* const data = reinterpret_cast<unsigned char const*>(p);
+        decompressBlocks(data, hs, data + header_bytes,
+                         available - header_bytes, out, n_bytes);
+    }
+}
+
+template <typename T, typename S>
+void convertValues(char const* const bytes, std::size_t const n, T* const out)
+{
+    for (std::size_t k = 0; k < n; ++k)
+    {
+        S value;
+        std::memcpy(&value, bytes + k * sizeof(S), sizeof(S));
+        out[k] = static_cast<T>(value);
+    }
+}
+
+template <typename T>
+void convertValues(std::string const& type, char const* const bytes,
+                   std::size_t const n, T* const out)
+{
+    if (type == "Int8")
+        convertValues<T, std::int8_t>(bytes, n, out);
+    else if (type == "UInt8")
+        convertValues<T, std::uint8_t>(bytes, n, out);
+    else if (type == "Int16")
+        convertValues<T, std::int16_t>(bytes, n, out);
+    else if (type == "UInt16")
+        convertValues<T, std::uint16_t>(bytes, n, out);
+    else if (type == "Int32")
+        convertValues<T, std::int32_t>(bytes, n, out);
+    else if (type == "UInt32")
+        convertValues<T, std::uint32_t>(bytes, n, out);
+    else if (type == "Int64")
+        convertValues<T, std::int64_t>(bytes, n, out);
+    else if (type == "UInt64")
+        convertValues<T, std::uint64_t>(bytes, n, out);
+    else if (type == "Float32")
+        convertValues<T, float>(bytes, n, out);
+    else if (type == "Float64")
+        convertValues<T, double>(bytes, n, out);
+    else
+        throw VtuReadError("Unsupported data type " + type + ".");
+}
+
+/// Reads n values of the array converting them to the type T.
+template <typename T>
+void readArray(VtuFile const& file, DataArray const& array, T* const out,
+               std::size_t const n)
+{
+    if (array.format == "ascii")
+    {
+        char const* p = array.content_begin;
+        for (std::size_t k = 0; k < n; ++k)
+        {
+            while (p < array.content_end && isWhitespace(*p))
+                ++p;
+            if (p >= array.content_end)
+                throw VtuReadError("DataArray '" + array.name +
+                                   "' has too few values.");
+            char* q;
+            out[k] = std::is_floating_point<T>::value
+                         ? static_cast<T>(std::strtod(p, &q))
+                         : static_cast<T>(std::strtoll(p, &q, 10));
+            if (q == p)
+                throw VtuReadError("DataArray '" + array.name +
+                                   "' contains invalid values.");
+            p = q;
+        }
+        return;
+    }
+
+    char const* p = nullptr;
+    bool base64 = true;
+    if (array.format == "appended")
+    {
+        if (!file.appended_begin)
+            throw VtuReadError("The file contains no appended data.");
+        p = file.appended_begin + array.offset;
+        base64 = file.appended_base64;
+    }
+    else if (array.format == "binary")
+    {
+        p = array.content_begin;
+        while (p < array.content_end && isWhitespace(*p))
+            ++p;
+    }
+    else
+        throw VtuReadError("Unsupported format " + array.format + ".");
+    if (p > file.end)
+        throw VtuReadError("Invalid offset of DataArray '" + array.name +
+                           "'.");
+
+    std::size_t const type_size = getTypeSize(array.type);
+    if (array.type == getVtkTypeName<T>())
+    {
+        readBinaryData(file, p, base64, reinterpret_cast<char*>(out),
+                       n * type_size);
+        return;
+    }
+    std::vector<char> bytes(n * type_size);
+    readBinaryData(file, p, base64, bytes.data(), bytes.size());
+    convertValues(array.type, bytes.data(), n, out);
+}
+
+template <typename T>
+std::vector<T> readArray(VtuFile const& file, DataArray const& array,
+                         std::size_t const n)
+{
+    std::vector<T> values(n);
+    readArray(file, array, values.data(), n);
+    return values;
+}
+
+template <typename T>
+void addPropertyVector(VtuFile const& file, DataArray const& array,
+                       std::size_t const n_tuples,
+                       MeshLib::MeshItemType const item_type,
+                       MeshLib::Properties& properties)
+{
+    auto* const vec = properties.createNewPropertyVector<T>(
+        array.name, item_type, array.n_components);
+    if (!vec)
+    {
+        WARN("Array %s could not be converted to PropertyVector.",
+             array.name.c_str());
+        return;
+    }
+    vec->resize(n_tuples * array.n_components);
+    readArray(file, array, vec->data(), vec->size());
+}
+
+/// Creates a PropertyVector of the same type VtkMeshConverter would create
+/// for the array.
+void addPropertyVector(VtuFile const& file, DataArray const& array,
+                       std::size_t const n_tuples,
+                       MeshLib::MeshItemType const item_type,
+                       MeshLib::Properties& properties)
+{
+    using UInt64 = std::conditional<sizeof(unsigned long) == 8, unsigned long,
+                                    unsigned long long>::type;
+
+    if (array.type == "Float64")
+        addPropertyVector<double>(file, array, n_tuples, item_type,
+                                  properties);
+    else if (array.type == "Int32")
+        addPropertyVector<int>(file, array, n_tuples, item_type, properties);
+    else if (array.type == "Int8")
+        addPropertyVector<char>(file, array, n_tuples, item_type, properties);
+    else if (array.type == "UInt64")
+        addPropertyVector<UInt64>(file, array, n_tuples, item_type,
+                                  properties);
+    else if (array.type == "UInt32")
+    {
+        // MaterialIDs are assumed to be integers
+        if (array.name.compare(0, 11, "MaterialIDs") == 0)
+            addPropertyVector<int>(file, array, n_tuples, item_type,
+                                   properties);
+        else
+            addPropertyVector<unsigned>(file, array, n_tuples, item_type,
+                                        properties);
+    }
+    else if (array.type == "Bit")
+        throw VtuReadError("Bit arrays are not supported.");
+    else
+        ERR("Array \"%s\" in VTU file uses unsupported data type.",
+            array.name.c_str());
+}
+
+template <typename ElementType>
+MeshLib::Element* createElement(MeshLib::Node** const nodes)
+{
+    return new ElementType(nodes);
+}
+
+/// Element type and the order of the nodes of a VTK cell type; the k-th node
+/// of the element is the node_order[k]-th node of the VTK cell.
+struct CellType
+{
+    MeshLib::Element* (*create)(MeshLib::Node**);
+    std::vector<unsigned> node_order;
+};
+
+std::vector<unsigned> sameNodeOrder(unsigned const n)
+{
+    std::vector<unsigned> order(n);
+    for (unsigned k = 0; k < n; ++k)
+        order[k] = k;
+    return order;
+}
+
+/// The node orders are the same as in VtkMeshConverter.
+std::map<int, CellType> const& getCellTypes()
+{
+    static std::map<int, CellType> const cell_types = {
+        {VTK_LINE, {&createElement<MeshLib::Line>, sameNodeOrder(2)}},
+        {VTK_TRIANGLE, {&createElement<MeshLib::Tri>, sameNodeOrder(3)}},
+        {VTK_QUAD, {&createElement<MeshLib::Quad>, sameNodeOrder(4)}},
+        {VTK_PIXEL, {&createElement<MeshLib::Quad>, {0, 1, 3, 2}}},
+        {VTK_TETRA, {&createElement<MeshLib::Tet>, sameNodeOrder(4)}},
+        {VTK_HEXAHEDRON, {&createElement<MeshLib::Hex>, sameNodeOrder(8)}},
+        {VTK_VOXEL,
+         {&createElement<MeshLib::Hex>, {0, 1, 3, 2, 4, 5, 7, 6}}},
+        {VTK_PYRAMID, {&createElement<MeshLib::Pyramid>, sameNodeOrder(5)}},
+        {VTK_WEDGE, {&createElement<MeshLib::Prism>, {3, 4, 5, 0, 1, 2}}},
+        {VTK_QUADRATIC_EDGE,
+         {&createElement<MeshLib::Line3>, sameNodeOrder(3)}},
+        {VTK_QUADRATIC_TRIANGLE,
+         {&createElement<MeshLib::Tri6>, sameNodeOrder(6)}},
+        {VTK_QUADRATIC_QUAD,
+         {&createElement<MeshLib::Quad8>, sameNodeOrder(8)}},
+        {VTK_BIQUADRATIC_QUAD,
+         {&createElement<MeshLib::Quad9>, sameNodeOrder(9)}},
+        {VTK_QUADRATIC_TETRA,
+         {&createElement<MeshLib::Tet10>, sameNodeOrder(10)}},
+        {VTK_QUADRATIC_HEXAHEDRON,
+         {&createElement<MeshLib::Hex20>, sameNodeOrder(20)}},
+        {VTK_QUADRATIC_PYRAMID,
+         {&createElement<MeshLib::Pyramid13>, sameNodeOrder(13)}},
+        {VTK_QUADRATIC_WEDGE,
+         {&createElement<MeshLib::Prism15>,
+          {3, 4, 5, 0, 1, 2, 8, 7, 6, 12, 14, 13, 11, 10, 9}}}};
+    return cell_types;
+}
+
+std::vector<MeshLib::Node*> createNodes(VtuFile const& file)
+{
+    auto const coords = readArray<double>(file, file.points, 3 * file.n_points);
+    std::vector<MeshLib::Node*> nodes(file.n_points);
+    auto const n = static_cast<long>(file.n_points);
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (long i = 0; i < n; ++i)
+        nodes[i] = new MeshLib::Node(coords[3 * i], coords[3 * i + 1],
+                                     coords[3 * i + 2], i);
+    return nodes;
+}
+
+std::vector<MeshLib::Element*> createElements(
+    VtuFile const& file, std::vector<MeshLib::Node*> const& nodes)
+{
+    auto const types =
+        readArray<unsigned char>(file, file.types, file.n_cells);
+    // Older files store the end offset of each cell, newer ones additionally
+    // begin with a zero.
+    std::size_t const n_offsets =
+        file.offsets.n_tuples == file.n_cells + 1 ? file.n_cells + 1
+                                                  : file.n_cells;
+    auto offsets = readArray<std::int64_t>(file, file.offsets, n_offsets);
+    if (n_offsets == file.n_cells)
+        offsets.insert(offsets.begin(), 0);
+    if (offsets.back() < 0)
+        throw VtuReadError("Invalid cell offsets.");
+    auto const connectivity = readArray<std::int64_t>(
+        file, file.connectivity,
+        file.n_cells == 0 ? 0 : static_cast<std::size_t>(offsets.back()));
+
+    auto const& cell_types = getCellTypes();
+    std::vector<MeshLib::Element*> elements(file.n_cells, nullptr);
+    auto const n = static_cast<long>(file.n_cells);
+    long invalid_cell = -1;
+#ifdef _OPENMP
+#pragma omp parallel for
+#endif
+    for (long i = 0; i < n; ++i)
+    {
+        auto const it = cell_types.find(types[i]);
+        auto const n_cell_nodes = offsets[i + 1] - offsets[i];
+        if (it == cell_types.end() || offsets[i] < 0 ||
+            static_cast<std::size_t>(offsets[i + 1]) > connectivity.size() ||
+            static_cast<std::size_t>(n_cell_nodes) !=
+                it->second.node_order.size())
+        {
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            invalid_cell = i;
+            continue;
+        }
+
+        auto const& node_order = it->second.node_order;
+        auto** const element_nodes = new MeshLib::Node*[node_order.size()];
+        bool valid = true;
+        for (std::size_t k = 0; k < node_order.size(); ++k)
+        {
+            auto const id = connectivity[offsets[i] + node_order[k]];
+            valid = valid && id >= 0 &&
+                    static_cast<std::size_t>(id) < nodes.size();
+            element_nodes[k] = valid ? nodes[id] : nullptr;
+        }
+        if (!valid)
+        {
+            delete[] element_nodes;
+#ifdef _OPENMP
+#pragma omp critical
+#endif
+            invalid_cell = i;
+            continue;
+        }
+        elements[i] = it->second.create(element_nodes);
+    }
+
+    if (invalid_cell >= 0)
+    {
+        for (auto* e : elements)
+            delete e;
+        throw VtuReadError("Unknown element type or invalid nodes of cell " +
+                           std::to_string(invalid_cell) + " (VTK type " +
+                           std::to_string(types[invalid_cell]) + ").");
+    }
+    return elements;
+}
+}  // namespace
+
+namespace MeshLib
+{
+namespace IO
+{
+MeshLib::Mesh* readVTUFileNative(std::string const& file_name)
+{
+    namespace bip = boost::interprocess;
+
+    std::vector<MeshLib::Node*> nodes;
+    try
+    {
+        bip::file_mapping const mapping(file_name.c_str(), bip::read_only);
+        bip::mapped_region const region(mapping, bip::read_only);
+        auto const* const begin =
+            static_cast<char const*>(region.get_address());
+        auto const file = parseVtuFile(begin, begin + region.get_size());
+        if (file.n_points == 0)
+            return nullptr;
+
+        nodes = createNodes(file);
+        auto elements = createElements(file, nodes);
+        std::string const mesh_name(
+            BaseLib::extractBaseNameWithoutExtension(file_name));
+        auto* const mesh = new MeshLib::Mesh(mesh_name, nodes, elements);
+        nodes.clear();  // owned by the mesh
+
+        try
+        {
+            auto& properties = mesh->getProperties();
+            for (auto const& array : file.point_data)
+                addPropertyVector(file, array, file.n_points,
+                                  MeshLib::MeshItemType::Node, properties);
+            for (auto const& array : file.cell_data)
+                addPropertyVector(file, array, file.n_cells,
+                                  MeshLib::MeshItemType::Cell, properties);
+            for (auto const& array : file.field_data)
+                addPropertyVector(file, array, array.n_tuples,
+                                  MeshLib::MeshItemType::IntegrationPoint,
+                                  properties);
+        }
+        catch (...)
+        {
+            delete mesh;
+            throw;
+        }
+        return mesh;
+    }
+    catch (VtuReadError const& e)
+    {
+        INFO("Native vtu reader: %s: %s", file_name.c_str(), e.what());
+    }
+    catch (bip::interprocess_exception const& e)
+    {
+        ERR("Could not map file %s: %s", file_name.c_str(), e.what());
+    }
+    for (auto* node : nodes)
+        delete node;
+    return nullptr;
+}
+
+}  // namespace IO
+}  // namespace MeshLib
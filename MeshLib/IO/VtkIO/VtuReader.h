@@ -0,0 +1,36 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+
+namespace MeshLib
+{
+class Mesh;
+
+namespace IO
+{
+/**
+ * Reads a vtu-file directly into a MeshLib::Mesh without creating a
+ * vtkUnstructuredGrid first.
+ *
+ * The reader supports the subset of the VTK XML format written by OGS and
+ * VTK: a single piece, little endian byte order, UInt32 or UInt64 headers,
+ * ascii, binary (base64) and appended (raw or base64) data arrays and the
+ * vtkZLibDataCompressor. The file is mapped into memory, and the blocks of
+ * compressed data arrays are decompressed in parallel if OpenMP is enabled.
+ *
+ * \return The mesh or a nullptr if the file could not be read or uses
+ * features not supported by this reader.
+ */
+MeshLib::Mesh* readVTUFileNative(std::string const& file_name);
+
+}  // namespace IO
+}  // namespace MeshLib
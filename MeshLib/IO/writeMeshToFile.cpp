@@ -15,6 +15,7 @@
 
 #include "MeshLib/Mesh.h"
 
+#include "MeshLib/IO/BinaryIO/BinaryMeshWriter.h"
 #include "MeshLib/IO/Legacy/MeshIO.h"
 #include "MeshLib/IO/VtkIO/VtuInterface.h"
 
@@ -37,6 +38,8 @@ int writeMeshToFile(const MeshLib::Mesh &mesh, const std::string &file_name)
         writer.writeToFile(file_name);
         return 0;
     }
+    if (BaseLib::hasFileExtension("ogsmesh", file_name))
+        return MeshLib::IO::writeBinaryMesh(mesh, file_name) ? 0 : -1;
 
     ERR("writeMeshToFile(): Unknown mesh file format in file %s.", file_name.c_str());
     return -1;
@@ -14,12 +14,15 @@
 
 #include "Mesh.h"
 
+#include <algorithm>
+#include <array>
 #include <memory>
 #include <utility>
 
 #include "BaseLib/RunTime.h"
 
 #include "Elements/Element.h"
+#include "Elements/LocalTopology.h"
 #include "Elements/Tri.h"
 #include "Elements/Quad.h"
 #include "Elements/Tet.h"
@@ -182,83 +185,96 @@ void Mesh::calcEdgeLengthRange()
     this->_edge_length.second = sqrt(this->_edge_length.second);
 }
 
-void Mesh::setElementNeighbors()
+namespace
+{
+/// Finds the element sharing the face, given by local base node numbers, with
+/// the element. The elements connected to the first face node serve as
+/// candidates, which are compared by their sorted face node ids.
+Element* findNeighbor(Element const& element,
+                      std::vector<unsigned> const& face)
 {
-    std::vector<Element*> neighbors;
-    for (auto element : _elements)
+    std::size_t const n = face.size();
+    std::array<std::size_t, 4> key;
+    for (std::size_t k = 0; k < n; ++k)
+        key[k] = element.getNodeIndex(face[k]);
+    std::sort(key.begin(), key.begin() + n);
+
+    std::array<std::size_t, 4> candidate_key;
+    for (Element* const candidate : element.getNode(face[0])->getElements())
     {
-        // create vector with all elements connected to current element (includes lots of doubles!)
-        const std::size_t nNodes (element->getNumberOfBaseNodes());
-        for (unsigned n(0); n<nNodes; ++n)
+        if (candidate == &element ||
+            candidate->getDimension() != element.getDimension())
+            continue;
+        for (auto const& candidate_face :
+             getLocalTopology(*candidate).neighbor_faces)
         {
-            std::vector<Element*> const& conn_elems ((element->getNode(n)->getElements()));
-            neighbors.insert(neighbors.end(), conn_elems.begin(), conn_elems.end());
+            if (candidate_face.size() != n)
+                continue;
+            for (std::size_t k = 0; k < n; ++k)
+                candidate_key[k] = candidate->getNodeIndex(candidate_face[k]);
+            std::sort(candidate_key.begin(), candidate_key.begin() + n);
+            if (std::equal(key.begin(), key.begin() + n,
+                           candidate_key.begin()))
+                return candidate;
         }
-        std::sort(neighbors.begin(), neighbors.end());
-        auto const neighbors_new_end = std::unique(neighbors.begin(), neighbors.end());
+    }
+    return nullptr;
+}
+}  // namespace
 
-        for (auto neighbor = neighbors.begin(); neighbor != neighbors_new_end; ++neighbor)
-        {
-            boost::optional<unsigned> const opposite_face_id = element->addNeighbor(*neighbor);
-            if (opposite_face_id)
-            {
-                (*neighbor)->setNeighbor(element, *opposite_face_id);
-            }
-        }
-        neighbors.clear();
+void Mesh::setElementNeighbors()
+{
+    // Each element sets only its own neighbors, hence the elements can be
+    // processed in parallel.
+    auto const n_elements = static_cast<long>(_elements.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (long i = 0; i < n_elements; ++i)
+    {
+        Element* const element = _elements[i];
+        auto const& faces = getLocalTopology(*element).neighbor_faces;
+        for (unsigned f = 0; f < faces.size(); ++f)
+            element->_neighbors[f] = findNeighbor(*element, faces[f]);
     }
 }
 
 void Mesh::setNodesConnectedByEdges()
 {
-    const std::size_t nNodes (this->_nodes.size());
-    for (unsigned i=0; i<nNodes; ++i)
+    auto const n_nodes = static_cast<long>(_nodes.size());
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+    for (long i = 0; i < n_nodes; ++i)
     {
         MeshLib::Node* node (_nodes[i]);
         std::vector<MeshLib::Node*> conn_set;
-        const std::vector<MeshLib::Element*> &conn_elems (node->getElements());
-        const std::size_t nConnElems (conn_elems.size());
-        for (unsigned j=0; j<nConnElems; ++j)
+        for (MeshLib::Element const* conn_ele : node->getElements())
         {
-            MeshLib::Element* conn_ele = conn_elems[j];
             const unsigned idx (conn_ele->getNodeIDinElement(node));
+            auto const& edges = getLocalTopology(*conn_ele).edges;
             const unsigned nElemNodes (conn_ele->getNumberOfBaseNodes());
             for (unsigned k(0); k<nElemNodes; ++k)
             {
-                MeshLib::Node const* node_k = conn_ele->getNode(k);
-                bool is_in_vector (false);
-                const std::size_t nConnNodes (conn_set.size());
-                for (unsigned l(0); l<nConnNodes; ++l)
-                    if (node_k == conn_set[l])
-                        is_in_vector = true;
-                if (is_in_vector) continue;
-
-                if (conn_ele->getNumberOfBaseNodes() == conn_ele->getNumberOfNodes())
-                {
-                    if (conn_ele->isEdge(idx, k))
-                        conn_set.push_back(const_cast<MeshLib::Node*>(node_k));
-                }
-                else
-                {
-                    for (unsigned l=0; l<conn_ele->getNumberOfEdges(); l++)
-                    {
-                        std::unique_ptr<Element const> edge(conn_ele->getEdge(l));
-                        unsigned match = 0;
-                        for (unsigned m=0; m<edge->getNumberOfBaseNodes(); m++)
-                        {
-                            auto edge_node = edge->getNode(m);
-                            if (edge_node == node || edge_node == node_k)
-                                match++;
-                        }
-                        if (match != 2)
-                            continue;
-                        conn_set.push_back(const_cast<MeshLib::Node*>(node_k));
-                        for (unsigned m=edge->getNumberOfBaseNodes(); m<edge->getNumberOfNodes(); m++)
-                            conn_set.push_back(const_cast<MeshLib::Node*>(edge->getNode(m)));
-                        break;
-                    }
-                }
-
+                MeshLib::Node* const node_k =
+                    const_cast<MeshLib::Node*>(conn_ele->getNode(k));
+                if (std::find(conn_set.begin(), conn_set.end(), node_k) !=
+                    conn_set.end())
+                    continue;
+
+                // The edge's base nodes are followed by its non-linear nodes.
+                auto const edge = std::find_if(
+                    edges.begin(), edges.end(),
+                    [idx, k](SubElementTopology const& e) {
+                        return (e.nodes[0] == idx && e.nodes[1] == k) ||
+                               (e.nodes[0] == k && e.nodes[1] == idx);
+                    });
+                if (edge == edges.end())
+                    continue;
+                conn_set.push_back(node_k);
+                for (std::size_t m = 2; m < edge->nodes.size(); ++m)
+                    conn_set.push_back(const_cast<MeshLib::Node*>(
+                        conn_ele->getNode(edge->nodes[m])));
             }
         }
         node->setConnectedNodes(conn_set);
@@ -267,32 +283,42 @@ void Mesh::setNodesConnectedByEdges()
 
 void Mesh::setNodesConnectedByElements()
 {
-    // Allocate temporary space for adjacent nodes.
-    std::vector<Node*> adjacent_nodes;
-    for (Node* const node : _nodes)
+    auto const n_nodes = static_cast<long>(_nodes.size());
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
     {
-        adjacent_nodes.clear();
+        // Allocate temporary space for adjacent nodes.
+        std::vector<Node*> adjacent_nodes;
+#ifdef _OPENMP
+#pragma omp for schedule(static)
+#endif
+        for (long i = 0; i < n_nodes; ++i)
+        {
+            Node* const node = _nodes[i];
+            adjacent_nodes.clear();
 
-        // Get all elements, to which this node is connected.
-        std::vector<Element*> const& conn_elems = node->getElements();
+            // Get all elements, to which this node is connected.
+            std::vector<Element*> const& conn_elems = node->getElements();
 
-        // And collect all elements' nodes.
-        for (Element const* const element : conn_elems)
-        {
-            Node* const* const single_elem_nodes = element->getNodes();
-            std::size_t const nnodes = element->getNumberOfNodes();
-            for (std::size_t n = 0; n < nnodes; n++)
-                adjacent_nodes.push_back(single_elem_nodes[n]);
-        }
+            // And collect all elements' nodes.
+            for (Element const* const element : conn_elems)
+            {
+                Node* const* const single_elem_nodes = element->getNodes();
+                std::size_t const nnodes = element->getNumberOfNodes();
+                for (std::size_t n = 0; n < nnodes; n++)
+                    adjacent_nodes.push_back(single_elem_nodes[n]);
+            }
 
-        // Make nodes unique and sorted by their ids.
-        // This relies on the node's id being equivalent to it's address.
-        std::sort(adjacent_nodes.begin(), adjacent_nodes.end(),
-            [](Node* a, Node* b) { return a->getID() < b->getID(); });
-        auto const last = std::unique(adjacent_nodes.begin(), adjacent_nodes.end());
-        adjacent_nodes.erase(last, adjacent_nodes.end());
+            // Make nodes unique and sorted by their ids.
+            // This relies on the node's id being equivalent to it's address.
+            std::sort(adjacent_nodes.begin(), adjacent_nodes.end(),
+                [](Node* a, Node* b) { return a->getID() < b->getID(); });
+            auto const last = std::unique(adjacent_nodes.begin(), adjacent_nodes.end());
+            adjacent_nodes.erase(last, adjacent_nodes.end());
 
-        node->setConnectedNodes(adjacent_nodes);
+            node->setConnectedNodes(adjacent_nodes);
+        }
     }
 }
 
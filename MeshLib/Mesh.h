@@ -159,8 +159,12 @@ protected:
 
     /// Fills in the neighbor-information for elements.
     /// Note: Using this implementation, an element e can only have neighbors that have the same dimensionality as e.
+    /// Two elements are neighbors if they share a face with the same base
+    /// nodes; the elements are processed in parallel if OpenMP is enabled.
     void setElementNeighbors();
 
+    /// Computes the edge-connectivity of nodes using the edge tables of the
+    /// element types, see MeshLib::getLocalTopology().
     void setNodesConnectedByEdges();
 
     /// Computes the element-connectivity of nodes. Two nodes i and j are
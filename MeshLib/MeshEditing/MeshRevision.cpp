@@ -464,33 +464,30 @@ unsigned MeshRevision::reduceHex(MeshLib::Element const*const org_elem,
         // reduce to prism
         for (unsigned i=0; i<6; ++i)
         {
-            const MeshLib::Element* face (org_elem->getFace(i));
-            if (face->getNode(0)->getID() == face->getNode(1)->getID() && face->getNode(2)->getID() == face->getNode(3)->getID())
+            auto const face = org_elem->getFaceView(i);
+            if (face.getNode(0)->getID() == face.getNode(1)->getID() && face.getNode(2)->getID() == face.getNode(3)->getID())
             {
                 auto** prism_nodes = new MeshLib::Node*[6];
-                prism_nodes[0] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face->getNode(0))))->getID()];
-                prism_nodes[1] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face->getNode(1))))->getID()];
-                prism_nodes[2] = nodes[org_elem->getNode(org_elem->getNodeIDinElement(face->getNode(2)))->getID()];
-                prism_nodes[3] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face->getNode(2))))->getID()];
-                prism_nodes[4] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face->getNode(3))))->getID()];
-                prism_nodes[5] = nodes[org_elem->getNode(org_elem->getNodeIDinElement(face->getNode(0)))->getID()];
+                prism_nodes[0] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face.getNode(0))))->getID()];
+                prism_nodes[1] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face.getNode(1))))->getID()];
+                prism_nodes[2] = nodes[org_elem->getNode(org_elem->getNodeIDinElement(face.getNode(2)))->getID()];
+                prism_nodes[3] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face.getNode(2))))->getID()];
+                prism_nodes[4] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face.getNode(3))))->getID()];
+                prism_nodes[5] = nodes[org_elem->getNode(org_elem->getNodeIDinElement(face.getNode(0)))->getID()];
                 new_elements.push_back (new MeshLib::Prism(prism_nodes));
-                delete face;
                 return 1;
             }
-            if (face->getNode(0)->getID() == face->getNode(3)->getID() && face->getNode(1)->getID() == face->getNode(2)->getID())
+            if (face.getNode(0)->getID() == face.getNode(3)->getID() && face.getNode(1)->getID() == face.getNode(2)->getID())
             {
                 auto** prism_nodes = new MeshLib::Node*[6];
-                prism_nodes[0] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face->getNode(0))))->getID()];
-                prism_nodes[1] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face->getNode(3))))->getID()];
-                prism_nodes[2] = nodes[org_elem->getNode(org_elem->getNodeIDinElement(face->getNode(2)))->getID()];
-                prism_nodes[3] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face->getNode(1))))->getID()];
-                prism_nodes[4] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face->getNode(2))))->getID()];
-                prism_nodes[5] = nodes[org_elem->getNode(org_elem->getNodeIDinElement(face->getNode(0)))->getID()];
-                delete face;
+                prism_nodes[0] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face.getNode(0))))->getID()];
+                prism_nodes[1] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face.getNode(3))))->getID()];
+                prism_nodes[2] = nodes[org_elem->getNode(org_elem->getNodeIDinElement(face.getNode(2)))->getID()];
+                prism_nodes[3] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face.getNode(1))))->getID()];
+                prism_nodes[4] = nodes[org_elem->getNode(this->lutHexDiametralNode(org_elem->getNodeIDinElement(face.getNode(2))))->getID()];
+                prism_nodes[5] = nodes[org_elem->getNode(org_elem->getNodeIDinElement(face.getNode(0)))->getID()];
                 return 1;
             }
-            delete face;
         }
         // reduce to four tets -> divide into 2 prisms such that each has one collapsed node
         for (unsigned i=0; i<7; ++i)
@@ -0,0 +1,228 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "SpaceFillingCurveReordering.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+int const bits = 21;
+
+/// Spreads the lowest 21 bits of v such that two zero bits follow each bit.
+std::uint64_t spreadBits(std::uint64_t v)
+{
+    v &= 0x1fffff;
+    v = (v | v << 32) & 0x1f00000000ffff;
+    v = (v | v << 16) & 0x1f0000ff0000ff;
+    v = (v | v << 8) & 0x100f00f00f00f00f;
+    v = (v | v << 4) & 0x10c30c30c30c30c3;
+    v = (v | v << 2) & 0x1249249249249249;
+    return v;
+}
+
+std::uint64_t mortonKey(std::array<std::uint32_t, 3> const& x)
+{
+    return spreadBits(x[0]) | spreadBits(x[1]) << 1 | spreadBits(x[2]) << 2;
+}
+
+/// Hilbert index of the quantized coordinates using the transpose
+/// representation of J. Skilling, "Programming the Hilbert curve",
+/// AIP Conf. Proc. 707 (2004).
+std::uint64_t hilbertKey(std::array<std::uint32_t, 3> x)
+{
+    std::uint32_t const m = 1u << (bits - 1);
+
+    // Inverse undo excess work.
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+    {
+        std::uint32_t const p = q - 1;
+        for (int i = 0; i < 3; ++i)
+        {
+            if (x[i] & q)
+            {
+                x[0] ^= p;
+            }
+            else
+            {
+                std::uint32_t const t = (x[0] ^ x[i]) & p;
+                x[0] ^= t;
+                x[i] ^= t;
+            }
+        }
+    }
+
+    // Gray encode.
+    for (int i = 1; i < 3; ++i)
+        x[i] ^= x[i - 1];
+    std::uint32_t t = 0;
+    for (std::uint32_t q = m; q > 1; q >>= 1)
+        if (x[2] & q)
+            t ^= q - 1;
+    for (int i = 0; i < 3; ++i)
+        x[i] ^= t;
+
+    // The first coordinate holds the most significant bit of each level.
+    return spreadBits(x[2]) | spreadBits(x[1]) << 1 | spreadBits(x[0]) << 2;
+}
+
+/// Sorts the indices in [first, last) of the points by their curve keys.
+template <typename IndexIterator>
+void sortAlongCurve(std::vector<MathLib::Point3d> const& points,
+                    IndexIterator first, IndexIterator last,
+                    MeshLib::SpaceFillingCurve const curve)
+{
+    if (first == last)
+        return;
+
+    std::array<double, 3> min;
+    std::array<double, 3> max;
+    min.fill(std::numeric_limits<double>::max());
+    max.fill(std::numeric_limits<double>::lowest());
+    for (auto it = first; it != last; ++it)
+    {
+        for (int k = 0; k < 3; ++k)
+        {
+            min[k] = std::min(min[k], points[*it][k]);
+            max[k] = std::max(max[k], points[*it][k]);
+        }
+    }
+
+    // The same scale in all directions preserves the aspect ratio of the
+    // bounding box.
+    double extent = 0;
+    for (int k = 0; k < 3; ++k)
+        extent = std::max(extent, max[k] - min[k]);
+    double const scale = extent > 0 ? (((1u << bits) - 1) / extent) : 0;
+
+    std::vector<std::pair<std::uint64_t, std::size_t>> keys;
+    keys.reserve(std::distance(first, last));
+    for (auto it = first; it != last; ++it)
+    {
+        std::array<std::uint32_t, 3> x;
+        for (int k = 0; k < 3; ++k)
+            x[k] = static_cast<std::uint32_t>((points[*it][k] - min[k]) *
+                                              scale);
+        keys.emplace_back(curve == MeshLib::SpaceFillingCurve::Hilbert
+                              ? hilbertKey(x)
+                              : mortonKey(x),
+                          *it);
+    }
+    // Ties are resolved by the original index.
+    std::sort(keys.begin(), keys.end());
+
+    for (auto const& key : keys)
+        *first++ = key.second;
+}
+}  // namespace
+
+namespace MeshLib
+{
+SpaceFillingCurve convertStringToSpaceFillingCurve(std::string const& curve)
+{
+    if (curve == "morton")
+        return SpaceFillingCurve::Morton;
+    if (curve == "hilbert")
+        return SpaceFillingCurve::Hilbert;
+    OGS_FATAL("Unknown space-filling curve `%s'.", curve.c_str());
+}
+
+std::vector<std::size_t> computeSpaceFillingCurveOrdering(
+    std::vector<MathLib::Point3d> const& points, SpaceFillingCurve const curve)
+{
+    std::vector<std::size_t> ordering(points.size());
+    std::iota(ordering.begin(), ordering.end(), 0);
+    sortAlongCurve(points, ordering.begin(), ordering.end(), curve);
+    return ordering;
+}
+
+std::vector<std::size_t> computeSpaceFillingCurveNodeOrdering(
+    MeshLib::Mesh const& mesh, SpaceFillingCurve const curve)
+{
+    std::vector<MathLib::Point3d> points;
+    points.reserve(mesh.getNumberOfNodes());
+    for (auto const* node : mesh.getNodes())
+        points.emplace_back(*node);
+
+    std::vector<std::size_t> ordering(points.size());
+    std::iota(ordering.begin(), ordering.end(), 0);
+    auto const base_nodes_end = ordering.begin() + mesh.getNumberOfBaseNodes();
+    sortAlongCurve(points, ordering.begin(), base_nodes_end, curve);
+    sortAlongCurve(points, base_nodes_end, ordering.end(), curve);
+    return ordering;
+}
+
+std::vector<std::size_t> computeSpaceFillingCurveElementOrdering(
+    MeshLib::Mesh const& mesh, SpaceFillingCurve const curve)
+{
+    std::vector<MathLib::Point3d> centres;
+    centres.reserve(mesh.getNumberOfElements());
+    for (auto const* element : mesh.getElements())
+        centres.emplace_back(element->getCenterOfGravity());
+    return computeSpaceFillingCurveOrdering(centres, curve);
+}
+
+std::unique_ptr<MeshLib::Mesh> createReorderedMesh(
+    MeshLib::Mesh const& mesh,
+    std::vector<std::size_t> const& node_ordering,
+    std::vector<std::size_t> const& element_ordering)
+{
+    auto const& nodes = mesh.getNodes();
+    auto const& elements = mesh.getElements();
+    if (node_ordering.size() != nodes.size() ||
+        element_ordering.size() != elements.size())
+    {
+        OGS_FATAL(
+            "The sizes of the node and element orderings do not match the "
+            "mesh.");
+    }
+
+    std::vector<Node*> new_nodes(nodes.size());
+    std::vector<std::size_t> new_node_ids(nodes.size());
+    for (std::size_t k = 0; k < node_ordering.size(); ++k)
+    {
+        new_nodes[k] = new Node(*nodes[node_ordering[k]]);
+        new_node_ids[node_ordering[k]] = k;
+    }
+
+    std::vector<Element*> new_elements(elements.size());
+    for (std::size_t k = 0; k < element_ordering.size(); ++k)
+    {
+        Element const& element = *elements[element_ordering[k]];
+        new_elements[k] = element.clone();
+        for (unsigned i = 0; i < element.getNumberOfNodes(); ++i)
+            new_elements[k]->setNode(
+                i, new_nodes[new_node_ids[element.getNodeIndex(i)]]);
+    }
+
+    return std::make_unique<MeshLib::Mesh>(
+        mesh.getName(), new_nodes, new_elements,
+        mesh.getProperties().reorderCopyProperties(element_ordering,
+                                                   node_ordering),
+        mesh.isNonlinear() ? mesh.getNumberOfBaseNodes() : 0);
+}
+
+std::unique_ptr<MeshLib::Mesh> reorderMeshAlongSpaceFillingCurve(
+    MeshLib::Mesh const& mesh, SpaceFillingCurve const curve)
+{
+    return createReorderedMesh(
+        mesh, computeSpaceFillingCurveNodeOrdering(mesh, curve),
+        computeSpaceFillingCurveElementOrdering(mesh, curve));
+}
+
+}  // namespace MeshLib
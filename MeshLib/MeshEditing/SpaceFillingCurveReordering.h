@@ -0,0 +1,66 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "MathLib/Point3d.h"
+
+namespace MeshLib
+{
+class Mesh;
+
+/// Space-filling curves used to order points such that points close on the
+/// curve are close in space.
+enum class SpaceFillingCurve
+{
+    Morton,  ///< Z-order curve, cheap but with jumps between octants.
+    Hilbert  ///< Continuous curve with better locality.
+};
+
+/// Converts "morton" or "hilbert" to the corresponding SpaceFillingCurve.
+/// Calls OGS_FATAL for other strings.
+SpaceFillingCurve convertStringToSpaceFillingCurve(std::string const& curve);
+
+/// Sorts the given points along the space-filling curve through their
+/// bounding box. The coordinates are quantized to 21 bits per direction.
+/// \return The indices of the points in the order along the curve.
+std::vector<std::size_t> computeSpaceFillingCurveOrdering(
+    std::vector<MathLib::Point3d> const& points, SpaceFillingCurve curve);
+
+/// Orders the mesh nodes along the space-filling curve. The base nodes of
+/// nonlinear meshes are kept in front of the nonlinear nodes.
+/// \return The node ids in the new order.
+std::vector<std::size_t> computeSpaceFillingCurveNodeOrdering(
+    MeshLib::Mesh const& mesh, SpaceFillingCurve curve);
+
+/// Orders the mesh elements along the space-filling curve through their
+/// centres of gravity.
+/// \return The element ids in the new order.
+std::vector<std::size_t> computeSpaceFillingCurveElementOrdering(
+    MeshLib::Mesh const& mesh, SpaceFillingCurve curve);
+
+/// Creates a copy of the mesh where the k-th node (element) is the node
+/// (element) node_ordering[k] (element_ordering[k]) of the given mesh. The
+/// node and cell properties are reordered accordingly.
+std::unique_ptr<MeshLib::Mesh> createReorderedMesh(
+    MeshLib::Mesh const& mesh,
+    std::vector<std::size_t> const& node_ordering,
+    std::vector<std::size_t> const& element_ordering);
+
+/// Creates a copy of the mesh with nodes and elements ordered along the
+/// space-filling curve, such that consecutive elements share nodes with
+/// nearby ids. This improves the cache locality of all element loops.
+std::unique_ptr<MeshLib::Mesh> reorderMeshAlongSpaceFillingCurve(
+    MeshLib::Mesh const& mesh, SpaceFillingCurve curve);
+
+}  // namespace MeshLib
@@ -93,9 +93,9 @@ std::size_t NodeSearch::searchBoundaryNodes()
             {
                 if (elem->getNeighbor(i) != nullptr)
                     continue;
-                std::unique_ptr<MeshLib::Element const> edge(elem->getEdge(i));
-                for (unsigned j=0; j<edge->getNumberOfNodes(); j++)
-                    vec_boundary_nodes.push_back(edge->getNode(j)->getID());
+                auto const edge = elem->getEdgeView(i);
+                for (unsigned j=0; j<edge.getNumberOfNodes(); j++)
+                    vec_boundary_nodes.push_back(edge.getNodeIndex(j));
             }
         }
     }
@@ -113,9 +113,9 @@ std::size_t NodeSearch::searchBoundaryNodes()
             {
                 if (elem->getNeighbor(i) != nullptr)
                     continue;
-                std::unique_ptr<MeshLib::Element const> face(elem->getFace(i));
-                for (unsigned j=0; j<face->getNumberOfNodes(); j++)
-                    vec_boundary_nodes.push_back(face->getNode(j)->getID());
+                auto const face = elem->getFaceView(i);
+                for (unsigned j=0; j<face.getNumberOfNodes(); j++)
+                    vec_boundary_nodes.push_back(face.getNodeIndex(j));
             }
         }
     }
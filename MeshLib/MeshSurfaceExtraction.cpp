@@ -28,6 +28,19 @@
 #include "MeshLib/MeshSearch/NodeSearch.h"
 #include "MeshLib/MeshEditing/RemoveMeshComponents.h"
 
+namespace
+{
+/// Creates a linear triangle or quadrilateral from the base nodes of a face.
+template <typename FaceType>
+MeshLib::Element* createLinearFace(MeshLib::SubElementView const& face)
+{
+    auto** const nodes = new MeshLib::Node*[FaceType::n_all_nodes];
+    for (unsigned k = 0; k < FaceType::n_all_nodes; ++k)
+        nodes[k] = const_cast<MeshLib::Node*>(face.getNode(k));
+    return new FaceType(nodes);
+}
+}  // namespace
+
 namespace MeshLib {
 
 std::vector<double> MeshSurfaceExtraction::getSurfaceAreaForNodes(const MeshLib::Mesh &mesh)
@@ -235,24 +248,21 @@ void MeshSurfaceExtraction::get2DSurfaceElements(
                 if (elem->getNeighbor(j) != nullptr)
                     continue;
 
-                auto const face =
-                    std::unique_ptr<MeshLib::Element const>{elem->getFace(j)};
+                auto const face = elem->getFaceView(j);
                 if (!complete_surface)
                 {
                     if (MathLib::scalarProduct(
-                            FaceRule::getSurfaceNormal(face.get())
-                                .getNormalizedVector(),
+                            face.getSurfaceNormal().getNormalizedVector(),
                             norm_dir) < cos_theta)
                     {
                         continue;
                     }
                 }
-                if (face->getGeomType() == MeshElemType::TRIANGLE)
-                    sfc_elements.push_back(new MeshLib::Tri(
-                        *static_cast<const MeshLib::Tri*>(face.get())));
+                if (face.getNumberOfBaseNodes() == 3)
+                    sfc_elements.push_back(createLinearFace<MeshLib::Tri>(face));
                 else
-                    sfc_elements.push_back(new MeshLib::Quad(
-                        *static_cast<const MeshLib::Quad*>(face.get())));
+                    sfc_elements.push_back(
+                        createLinearFace<MeshLib::Quad>(face));
                 element_to_bulk_element_id_map.push_back(elem->getID());
                 element_to_bulk_face_id_map.push_back(j);
             }
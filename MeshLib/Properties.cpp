@@ -99,6 +99,36 @@ Properties Properties::excludeCopyProperties(
     return new_properties;
 }
 
+Properties Properties::reorderCopyProperties(
+    std::vector<std::size_t> const& element_ordering,
+    std::vector<std::size_t> const& node_ordering) const
+{
+    Properties reordered_copy;
+    for (auto name_vector_pair : _properties)
+    {
+        auto const item_type = name_vector_pair.second->getMeshItemType();
+        if (item_type == MeshItemType::Cell)
+        {
+            reordered_copy._properties.insert(std::make_pair(
+                name_vector_pair.first,
+                name_vector_pair.second->cloneReordered(element_ordering)));
+        }
+        else if (item_type == MeshItemType::Node)
+        {
+            reordered_copy._properties.insert(std::make_pair(
+                name_vector_pair.first,
+                name_vector_pair.second->cloneReordered(node_ordering)));
+        }
+        else
+        {
+            WARN("The property \"%s\" is neither a node nor a cell property "
+                 "and is not copied.",
+                 name_vector_pair.first.c_str());
+        }
+    }
+    return reordered_copy;
+}
+
 Properties::Properties(Properties const& properties)
     : _properties(properties._properties)
 {
@@ -120,6 +120,15 @@ public:
     Properties excludeCopyProperties(
         std::vector<MeshItemType> const& exclude_mesh_item_types) const;
 
+    /** copy all PropertyVector objects stored in the (internal) map with
+     * their node/element tuples reordered, i.e. the k-th tuple of the copy is
+     * the tuple element_ordering[k] (node_ordering[k]) of the original.
+     * PropertyVector objects of other mesh item types are not copied.
+     */
+    Properties reorderCopyProperties(
+        std::vector<std::size_t> const& element_ordering,
+        std::vector<std::size_t> const& node_ordering) const;
+
     Properties() = default;
 
     Properties(Properties const& properties);
@@ -10,6 +10,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <cassert>
 #include <iterator>
 #include <ostream>
@@ -29,6 +30,10 @@ public:
     virtual PropertyVectorBase* clone(
         std::vector<std::size_t> const& exclude_positions
     ) const = 0;
+    /// Creates a copy where the k-th tuple is the tuple ordering[k] of this
+    /// vector.
+    virtual PropertyVectorBase* cloneReordered(
+        std::vector<std::size_t> const& ordering) const = 0;
     virtual ~PropertyVectorBase() = default;
 
     MeshItemType getMeshItemType() const { return _mesh_item_type; }
@@ -93,6 +98,18 @@ public:
         return t;
     }
 
+    PropertyVectorBase* cloneReordered(
+        std::vector<std::size_t> const& ordering) const override
+    {
+        assert(ordering.size() == getNumberOfTuples());
+        auto* t(new PropertyVector<PROP_VAL_TYPE>(
+            ordering.size(), _property_name, _mesh_item_type, _n_components));
+        for (std::size_t k = 0; k < ordering.size(); ++k)
+            std::copy_n(this->begin() + ordering[k] * _n_components,
+                        _n_components, t->begin() + k * _n_components);
+        return t;
+    }
+
     /// Method returns the number of tuples times the number of tuple components.
     std::size_t size() const
     {
@@ -214,6 +231,27 @@ public:
         return t;
     }
 
+    PropertyVectorBase* cloneReordered(
+        std::vector<std::size_t> const& ordering) const override
+    {
+        assert(ordering.size() == getNumberOfTuples());
+        // Only the item to group mapping is reordered, the groups remain.
+        std::vector<std::size_t> item2group_mapping(ordering.size());
+        for (std::size_t k = 0; k < ordering.size(); ++k)
+            item2group_mapping[k] =
+                std::vector<std::size_t>::operator[](ordering[k]);
+        auto* t(new PropertyVector<T*>(_values.size() / _n_components,
+                                       std::move(item2group_mapping),
+                                       _property_name, _mesh_item_type,
+                                       _n_components));
+        for (std::size_t j(0); j < _values.size(); j++)
+        {
+            std::vector<T> values(_values[j], _values[j] + _n_components);
+            t->initPropertyValue(j, values);
+        }
+        return t;
+    }
+
     //! Returns the value for the given component stored in the given tuple.
     T const& getComponent(std::size_t tuple_index, std::size_t component) const
     {
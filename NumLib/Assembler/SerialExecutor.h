@@ -36,7 +36,9 @@ struct SerialExecutor
     ///             an index as arguments (and possibly further arguments).
     /// \param c    a container supporting access over operator[].
     ///             The elements of \c c must have pointer semantics, i.e.,
-    ///             support dereferencing via unary operator*().
+    ///             support dereferencing via unary operator*(). Null elements,
+    ///             e.g. the local assemblers of inactive mesh elements, are
+    ///             skipped.
     /// \param args additional arguments passed to \c f.
     ///
     template <typename F, typename C, typename ...Args_>
@@ -49,7 +51,11 @@ struct SerialExecutor
 #endif
     {
         for (std::size_t i = 0; i < c.size(); i++)
+        {
+            if (!c[i])
+                continue;
             f(i, *c[i], std::forward<Args_>(args)...);
+        }
     }
 
     /// Executes the given \c method of the given \c object for each element
@@ -57,7 +63,8 @@ struct SerialExecutor
     ///
     /// This method is very similar to executeDereferenced().
     ///
-    /// \param container collection of objects having pointer semantics.
+    /// \param container collection of objects having pointer semantics. Null
+    ///                  elements are skipped.
     /// \param object    the object whose method will be called.
     /// \param method    the method being called, i.e., a member function pointer
     ///                  to a member function of the class \c Object.
@@ -71,6 +78,8 @@ struct SerialExecutor
             Container const& container, Args&&... args)
     {
         for (std::size_t i = 0; i < container.size(); i++) {
+            if (!container[i])
+                continue;
             (object.*method)(i, *container[i], std::forward<Args>(args)...);
         }
     }
@@ -79,7 +88,8 @@ struct SerialExecutor
     ///
     /// This method is very similar to executeMemberDereferenced().
     ///
-    /// \param container collection of objects having pointer semantics.
+    /// \param container collection of objects having pointer semantics. Null
+    ///                  elements are skipped.
     /// \param method    the method being called, i.e., a member function pointer
     ///                  to a member function of the \c container's elements.
     /// \param args      further arguments passed on to the method
@@ -91,6 +101,8 @@ struct SerialExecutor
                                             Args&&... args)
     {
         for (std::size_t i = 0; i < container.size(); i++) {
+            if (!container[i])
+                continue;
             ((*container[i]).*method)(i, std::forward<Args>(args)...);
         }
     }
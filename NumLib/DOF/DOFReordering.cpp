@@ -0,0 +1,168 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "DOFReordering.h"
+
+#include <algorithm>
+
+#include "BaseLib/Error.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/SpaceFillingCurveReordering.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+using Graph = std::vector<std::vector<std::size_t>>;
+
+/// Adjacency lists of the mesh nodes without the node itself, each sorted by
+/// increasing degree as required by the Cuthill-McKee algorithm.
+Graph createNodeGraph(MeshLib::Mesh const& mesh)
+{
+    auto const& nodes = mesh.getNodes();
+    Graph graph(nodes.size());
+    for (auto const* node : nodes)
+    {
+        auto& adjacent = graph[node->getID()];
+        for (auto const* n : node->getConnectedNodes())
+            if (n != node)
+                adjacent.push_back(n->getID());
+    }
+    for (auto& adjacent : graph)
+        std::stable_sort(adjacent.begin(), adjacent.end(),
+                         [&graph](std::size_t const a, std::size_t const b) {
+                             return graph[a].size() < graph[b].size();
+                         });
+    return graph;
+}
+
+/// Breadth first traversal of the connected component containing \c start.
+/// The visited nodes are appended to \c order and marked with \c stamp in
+/// \c marks.
+/// \return The position in \c order where the last level begins and the
+/// number of levels.
+std::pair<std::size_t, std::size_t> traverseLevels(
+    Graph const& graph, std::size_t const start,
+    std::vector<std::size_t>& marks, std::size_t const stamp,
+    std::vector<std::size_t>& order)
+{
+    std::size_t level_begin = order.size();
+    std::size_t n_levels = 0;
+    order.push_back(start);
+    marks[start] = stamp;
+    while (level_begin < order.size())
+    {
+        ++n_levels;
+        std::size_t const level_end = order.size();
+        for (std::size_t i = level_begin; i < level_end; ++i)
+        {
+            for (auto const n : graph[order[i]])
+            {
+                if (marks[n] == stamp)
+                    continue;
+                marks[n] = stamp;
+                order.push_back(n);
+            }
+        }
+        if (order.size() == level_end)
+            break;
+        level_begin = level_end;
+    }
+    return {level_begin, n_levels};
+}
+
+/// Finds a pseudo-peripheral node of the component containing \c start with
+/// the heuristic of George and Liu.
+std::size_t findPseudoPeripheralNode(Graph const& graph, std::size_t start,
+                                     std::vector<std::size_t>& marks,
+                                     std::size_t& stamp)
+{
+    std::vector<std::size_t> order;
+    auto levels = traverseLevels(graph, start, marks, ++stamp, order);
+    for (;;)
+    {
+        // Node of minimal degree in the last level.
+        auto const candidate = *std::min_element(
+            order.begin() + levels.first, order.end(),
+            [&graph](std::size_t const a, std::size_t const b) {
+                return graph[a].size() < graph[b].size();
+            });
+        order.clear();
+        auto const candidate_levels =
+            traverseLevels(graph, candidate, marks, ++stamp, order);
+        if (candidate_levels.second <= levels.second)
+            return start;
+        start = candidate;
+        levels = candidate_levels;
+    }
+}
+}  // namespace
+
+namespace NumLib
+{
+DOFReordering convertStringToDOFReordering(std::string const& reordering)
+{
+    if (reordering == "none")
+        return DOFReordering::None;
+    if (reordering == "reverse_cuthill_mckee")
+        return DOFReordering::ReverseCuthillMcKee;
+    if (reordering == "space_filling_curve")
+        return DOFReordering::SpaceFillingCurve;
+    OGS_FATAL("Unknown DOF reordering `%s'.", reordering.c_str());
+}
+
+std::vector<std::size_t> computeNodeOrdering(MeshLib::Mesh const& mesh,
+                                             DOFReordering const reordering)
+{
+    switch (reordering)
+    {
+        case DOFReordering::None:
+            return {};
+        case DOFReordering::ReverseCuthillMcKee:
+            return computeReverseCuthillMcKeeOrdering(mesh);
+        case DOFReordering::SpaceFillingCurve:
+            return computeSpaceFillingCurveOrdering(mesh);
+    }
+    OGS_FATAL("Unhandled DOF reordering.");
+}
+
+std::vector<std::size_t> computeReverseCuthillMcKeeOrdering(
+    MeshLib::Mesh const& mesh)
+{
+    Graph const graph = createNodeGraph(mesh);
+    std::size_t const n_nodes = graph.size();
+
+    // Marks for the traversals; the final numbering uses stamp 1, the
+    // searches for pseudo-peripheral nodes use increasing stamps.
+    std::vector<std::size_t> marks(n_nodes, 0);
+    std::vector<std::size_t> search_marks(n_nodes, 0);
+    std::size_t search_stamp = 0;
+
+    std::vector<std::size_t> order;
+    order.reserve(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; ++i)
+    {
+        if (marks[i] != 0)
+            continue;
+        auto const start =
+            findPseudoPeripheralNode(graph, i, search_marks, search_stamp);
+        traverseLevels(graph, start, marks, 1, order);
+    }
+
+    std::reverse(order.begin(), order.end());
+    return order;
+}
+
+std::vector<std::size_t> computeSpaceFillingCurveOrdering(
+    MeshLib::Mesh const& mesh)
+{
+    return MeshLib::computeSpaceFillingCurveNodeOrdering(
+        mesh, MeshLib::SpaceFillingCurve::Hilbert);
+}
+
+}  // namespace NumLib
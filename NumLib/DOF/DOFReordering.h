@@ -0,0 +1,53 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <string>
+#include <vector>
+
+namespace MeshLib
+{
+class Mesh;
+}
+
+namespace NumLib
+{
+/// Renumbering of the mesh nodes applied to the global indices of a
+/// ComponentOrder::BY_LOCATION ordered MeshComponentMap.
+enum class DOFReordering
+{
+    None,                ///< Global indices follow the mesh node ids.
+    ReverseCuthillMcKee, ///< Bandwidth reducing ordering of the node graph.
+    SpaceFillingCurve    ///< Nodes sorted along a Hilbert curve.
+};
+
+/// Converts "none", "reverse_cuthill_mckee" or "space_filling_curve" to the
+/// corresponding DOFReordering. Calls OGS_FATAL for other strings.
+DOFReordering convertStringToDOFReordering(std::string const& reordering);
+
+/// Computes a new ordering of the mesh nodes.
+///
+/// \return The node ids in the new order, i.e. the k-th entry is the id of
+/// the node numbered k. For DOFReordering::None an empty vector is returned.
+std::vector<std::size_t> computeNodeOrdering(MeshLib::Mesh const& mesh,
+                                             DOFReordering const reordering);
+
+/// Computes the reverse Cuthill-McKee ordering of the graph of the mesh nodes
+/// connected by elements. Each connected component starts at a
+/// pseudo-peripheral node.
+std::vector<std::size_t> computeReverseCuthillMcKeeOrdering(
+    MeshLib::Mesh const& mesh);
+
+/// Sorts the mesh nodes along a Hilbert curve through the bounding box of the
+/// mesh, see MeshLib::computeSpaceFillingCurveNodeOrdering().
+std::vector<std::size_t> computeSpaceFillingCurveOrdering(
+    MeshLib::Mesh const& mesh);
+
+}  // namespace NumLib
@@ -107,9 +107,10 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
 LocalToGlobalIndexMap::LocalToGlobalIndexMap(
     std::vector<MeshLib::MeshSubsets>&& mesh_subsets,
     std::vector<unsigned> const& vec_var_n_components,
-    NumLib::ComponentOrder const order)
+    NumLib::ComponentOrder const order,
+    std::vector<std::size_t> const& node_ordering)
     : _mesh_subsets(std::move(mesh_subsets)),
-      _mesh_component_map(_mesh_subsets, order),
+      _mesh_component_map(_mesh_subsets, order, node_ordering),
       _variable_component_offsets(to_cumulative(vec_var_n_components))
 {
     // For all MeshSubsets and each of their MeshSubset's and each element
@@ -146,9 +147,10 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
     std::vector<MeshLib::MeshSubsets>&& mesh_subsets,
     std::vector<unsigned> const& vec_var_n_components,
     std::vector<std::vector<MeshLib::Element*> const*> const& vec_var_elements,
-    NumLib::ComponentOrder const order)
+    NumLib::ComponentOrder const order,
+    std::vector<std::size_t> const& node_ordering)
     : _mesh_subsets(std::move(mesh_subsets)),
-      _mesh_component_map(_mesh_subsets, order),
+      _mesh_component_map(_mesh_subsets, order, node_ordering),
       _variable_component_offsets(to_cumulative(vec_var_n_components))
 {
     assert(vec_var_n_components.size() == vec_var_elements.size());
@@ -156,14 +158,24 @@ LocalToGlobalIndexMap::LocalToGlobalIndexMap(
     // For all MeshSubsets and each of their MeshSubset's and each element
     // of that MeshSubset save a line of global indices.
 
-    // _rows should be resized based on an element ID
+    // _rows should be resized based on an element ID. Rows are kept for all
+    // elements of the meshes, such that elements without any of the given
+    // variables have empty lines of global indices.
     std::size_t max_elem_id = 0;
     for (std::vector<MeshLib::Element*>const* eles : vec_var_elements)
     {
         for (auto e : *eles)
             max_elem_id = std::max(max_elem_id, e->getID());
     }
-    _rows.resize(max_elem_id + 1, _mesh_subsets.size());
+    std::size_t n_rows = max_elem_id + 1;
+    for (auto const& mss : _mesh_subsets)
+    {
+        for (auto const& ms : mss)
+            n_rows = std::max(n_rows, static_cast<std::size_t>(std::distance(
+                                          ms->elementsBegin(),
+                                          ms->elementsEnd())));
+    }
+    _rows.resize(n_rows, _mesh_subsets.size());
 
     std::size_t offset = 0;
     for (int variable_id = 0; variable_id < static_cast<int>(vec_var_n_components.size());
@@ -58,10 +58,13 @@ public:
     /// The size of the vector should be equal to the number of variables. Sum of the entries
     /// should be equal to the size of the mesh_subsets.
     /// \param order  type of ordering values in a vector
+    /// \param node_ordering  optional renumbering of the mesh nodes passed to
+    /// the MeshComponentMap.
     LocalToGlobalIndexMap(
         std::vector<MeshLib::MeshSubsets>&& mesh_subsets,
         std::vector<unsigned> const& vec_var_n_components,
-        NumLib::ComponentOrder const order);
+        NumLib::ComponentOrder const order,
+        std::vector<std::size_t> const& node_ordering = {});
 
     /// Creates a MeshComponentMap internally and stores the global indices for
     /// the given mesh elements
@@ -71,12 +74,16 @@ public:
     /// The size of the vector should be equal to the number of variables. Sum of the entries
     /// should be equal to the size of the mesh_subsets.
     /// \param vec_var_elements  a vector of active mesh elements for each variable.
+    /// Elements not contained in any of the vectors have no global indices.
     /// \param order  type of ordering values in a vector
+    /// \param node_ordering  optional renumbering of the mesh nodes passed to
+    /// the MeshComponentMap.
     LocalToGlobalIndexMap(
         std::vector<MeshLib::MeshSubsets>&& mesh_subsets,
         std::vector<unsigned> const& vec_var_n_components,
         std::vector<std::vector<MeshLib::Element*>const*> const& vec_var_elements,
-        NumLib::ComponentOrder const order);
+        NumLib::ComponentOrder const order,
+        std::vector<std::size_t> const& node_ordering = {});
 
     /// Derive a LocalToGlobalIndexMap constrained to a set of mesh subsets and
     /// elements. A new mesh component map will be constructed using the passed
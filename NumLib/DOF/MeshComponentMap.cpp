@@ -12,6 +12,11 @@
 
 #include "MeshComponentMap.h"
 
+#include <algorithm>
+#include <tuple>
+
+#include <logog/include/logog.hpp>
+
 #include "BaseLib/Error.h"
 #include "MeshLib/MeshSubsets.h"
 
@@ -29,8 +34,14 @@ GlobalIndexType const MeshComponentMap::nop =
 
 #ifdef USE_PETSC
 MeshComponentMap::MeshComponentMap(
-    const std::vector<MeshLib::MeshSubsets>& components, ComponentOrder order)
+    const std::vector<MeshLib::MeshSubsets>& components, ComponentOrder order,
+    std::vector<std::size_t> const& node_ordering)
 {
+    if (!node_ordering.empty())
+        WARN(
+            "The DOF reordering is ignored in parallel computations, the "
+            "global indices are given by the mesh partitioning.");
+
     // get number of unknows
     GlobalIndexType num_unknowns = 0;
     for (auto const& c : components)
@@ -116,7 +127,8 @@ MeshComponentMap::MeshComponentMap(
 }
 #else
 MeshComponentMap::MeshComponentMap(
-    const std::vector<MeshLib::MeshSubsets>& components, ComponentOrder order)
+    const std::vector<MeshLib::MeshSubsets>& components, ComponentOrder order,
+    std::vector<std::size_t> const& node_ordering)
 {
     // construct dict (and here we number global_index by component type)
     GlobalIndexType global_index = 0;
@@ -138,7 +150,12 @@ MeshComponentMap::MeshComponentMap(
     _num_local_dof = _dict.size();
 
     if (order == ComponentOrder::BY_LOCATION)
-        renumberByLocation();
+    {
+        if (node_ordering.empty())
+            renumberByLocation();
+        else
+            renumberByNodeOrdering(node_ordering);
+    }
 }
 #endif // end of USE_PETSC
 
@@ -184,6 +201,47 @@ void MeshComponentMap::renumberByLocation(GlobalIndexType offset)
     }
 }
 
+void MeshComponentMap::renumberByNodeOrdering(
+    std::vector<std::size_t> const& node_ordering)
+{
+    auto const invalid = std::numeric_limits<std::size_t>::max();
+    std::vector<std::size_t> node_ranks(node_ordering.size(), invalid);
+    for (std::size_t k = 0; k < node_ordering.size(); ++k)
+        node_ranks[node_ordering[k]] = k;
+
+    // Position of a location in the new numbering; items other than nodes
+    // keep their order.
+    auto const rank = [&](Location const& l) {
+        if (l.item_type != MeshLib::MeshItemType::Node)
+            return l.item_id;
+        if (l.item_id >= node_ranks.size() || node_ranks[l.item_id] == invalid)
+            OGS_FATAL("Node %d is not contained in the node ordering.",
+                      l.item_id);
+        return node_ranks[l.item_id];
+    };
+
+    using Key = std::tuple<std::size_t, MeshLib::MeshItemType, std::size_t,
+                           std::size_t>;
+    std::vector<std::pair<Key, Line>> lines;
+    lines.reserve(_dict.size());
+    for (auto const& line : _dict)
+        lines.emplace_back(Key(line.location.mesh_id, line.location.item_type,
+                               rank(line.location), line.comp_id),
+                           line);
+    std::sort(lines.begin(), lines.end(),
+              [](std::pair<Key, Line> const& a, std::pair<Key, Line> const& b) {
+                  return a.first < b.first;
+              });
+
+    _dict.clear();
+    GlobalIndexType global_index = 0;
+    for (auto& key_and_line : lines)
+    {
+        key_and_line.second.global_index = global_index++;
+        _dict.insert(key_and_line.second);
+    }
+}
+
 std::vector<std::size_t> MeshComponentMap::getComponentIDs(const Location &l) const
 {
     auto const &m = _dict.get<ByLocation>();
@@ -40,8 +40,15 @@ public:
 public:
     /// \param components   a vector of components
     /// \param order        type of ordering values in a vector
+    /// \param node_ordering optional renumbering of the mesh nodes, the k-th
+    /// entry being the id of the node numbered k (see DOFReordering.h). It is
+    /// used for ComponentOrder::BY_LOCATION only, where the global indices of
+    /// the nodes follow this order instead of the node ids. Global indices
+    /// are always obtained through the map, so the renumbering is transparent
+    /// to the users of the map.
     MeshComponentMap(std::vector<MeshLib::MeshSubsets> const& components,
-                     ComponentOrder order);
+                     ComponentOrder order,
+                     std::vector<std::size_t> const& node_ordering = {});
 
     /// Creates a multi-component subset of the current mesh component map.
     /// The order (BY_LOCATION/BY_COMPONENT) of components is the same as of the
@@ -174,6 +181,10 @@ private:
 
     void renumberByLocation(GlobalIndexType offset=0);
 
+    /// Renumbers the global indices by location, where the node locations are
+    /// ordered by the given node ordering instead of their ids.
+    void renumberByNodeOrdering(std::vector<std::size_t> const& node_ordering);
+
     detail::ComponentGlobalIndexDict _dict;
 
     /// Number of local unknowns excluding those associated
@@ -59,11 +59,33 @@ void LocalLinearLeastSquaresExtrapolator::extrapolate(
         MathLib::MatrixVectorTraits<GlobalVector>::newInstance(_nodal_values);
     counts->setZero();  // TODO BLAS?
 
+    bool has_inactive_elements = false;
     auto const size = extrapolatables.size();
     for (std::size_t i=0; i<size; ++i) {
+        // Inactive elements have no degrees of freedom.
+        if (_local_to_global(i, 0).rows.empty())
+        {
+            has_inactive_elements = true;
+            continue;
+        }
         extrapolateElement(i, extrapolatables, *counts);
     }
 
+    // Nodes connected to inactive elements only got no contributions; their
+    // values stay zero.
+    if (has_inactive_elements)
+    {
+        MathLib::LinAlg::finalizeAssembly(*counts);
+        MathLib::LinAlg::setLocalAccessibleVector(*counts);
+        for (GlobalIndexType i = counts->getRangeBegin();
+             i < static_cast<GlobalIndexType>(counts->getRangeEnd()); ++i)
+        {
+            if ((*counts)[i] == 0.0)
+                counts->set(i, 1.0);
+        }
+        MathLib::LinAlg::finalizeAssembly(*counts);
+    }
+
     MathLib::LinAlg::componentwiseDivide(_nodal_values, _nodal_values, *counts);
 }
 
@@ -75,6 +97,10 @@ void LocalLinearLeastSquaresExtrapolator::calculateResiduals(
 
     auto const size = extrapolatables.size();
     for (std::size_t i=0; i<size; ++i) {
+        // Inactive elements have no degrees of freedom; their residual stays
+        // zero.
+        if (_local_to_global(i, 0).rows.empty())
+            continue;
         calculateResidualElement(i, extrapolatables);
     }
 }
@@ -96,19 +96,12 @@ computeMappingMatrices(
 {
 }
 
-template <class T_MESH_ELEMENT, class T_SHAPE_FUNC, class T_SHAPE_MATRICES>
-inline
-typename std::enable_if<T_SHAPE_FUNC::DIM!=0>::type
-computeMappingMatrices(
-        const T_MESH_ELEMENT &ele,
-        const double* natural_pt,
+/// Computes J and detJ from the already evaluated dNdr.
+template <class T_MESH_ELEMENT, class T_SHAPE_MATRICES>
+inline void computeJacobian(
         const MeshLib::ElementCoordinatesMappingLocal &ele_local_coord,
-        T_SHAPE_MATRICES &shapemat,
-        FieldType<ShapeMatrixType::DNDR_J>)
+        T_SHAPE_MATRICES &shapemat)
 {
-    computeMappingMatrices<T_MESH_ELEMENT, T_SHAPE_FUNC, T_SHAPE_MATRICES>
-        (ele, natural_pt, ele_local_coord, shapemat, FieldType<ShapeMatrixType::DNDR>());
-
     auto const dim = T_MESH_ELEMENT::dimension;
     auto const nnodes = T_MESH_ELEMENT::n_all_nodes;
 
@@ -128,6 +121,51 @@ computeMappingMatrices(
     if (shapemat.detJ<=.0)
         OGS_FATAL("det J = %e is not positive.\n", shapemat.detJ);
 }
+
+/// Computes invJ and dNdx from the already evaluated dNdr, J, and detJ.
+template <class T_MESH_ELEMENT, class T_SHAPE_MATRICES>
+inline void computeInverseJacobianAndDNDX(
+        const T_MESH_ELEMENT &ele,
+        const MeshLib::ElementCoordinatesMappingLocal &ele_local_coord,
+        T_SHAPE_MATRICES &shapemat)
+{
+    if (shapemat.detJ > 0) {
+        //J^-1, dshape/dx
+        shapemat.invJ.noalias() = shapemat.J.inverse();
+
+        auto const nnodes(shapemat.dNdr.cols());
+        auto const ele_dim(shapemat.dNdr.rows());
+        assert(shapemat.dNdr.rows()==ele.getDimension());
+        const unsigned global_dim = ele_local_coord.getGlobalDimension();
+        if (global_dim==ele_dim) {
+            shapemat.dNdx.topLeftCorner(ele_dim, nnodes).noalias() = shapemat.invJ * shapemat.dNdr;
+        } else {
+            auto const& matR = ele_local_coord.getRotationMatrixToGlobal(); // 3 x 3
+            auto invJ_dNdr = shapemat.invJ * shapemat.dNdr;
+            auto dshape_global = matR.topLeftCorner(3u, ele_dim) * invJ_dNdr; //3 x nnodes
+            shapemat.dNdx = dshape_global.topLeftCorner(global_dim, nnodes);;
+        }
+    } else {
+        OGS_FATAL("det J = %e is not positive.\n", shapemat.detJ);
+    }
+}
+
+template <class T_MESH_ELEMENT, class T_SHAPE_FUNC, class T_SHAPE_MATRICES>
+inline
+typename std::enable_if<T_SHAPE_FUNC::DIM!=0>::type
+computeMappingMatrices(
+        const T_MESH_ELEMENT &ele,
+        const double* natural_pt,
+        const MeshLib::ElementCoordinatesMappingLocal &ele_local_coord,
+        T_SHAPE_MATRICES &shapemat,
+        FieldType<ShapeMatrixType::DNDR_J>)
+{
+    computeMappingMatrices<T_MESH_ELEMENT, T_SHAPE_FUNC, T_SHAPE_MATRICES>
+        (ele, natural_pt, ele_local_coord, shapemat, FieldType<ShapeMatrixType::DNDR>());
+
+    computeJacobian<T_MESH_ELEMENT>(ele_local_coord, shapemat);
+}
+
 template <class T_MESH_ELEMENT, class T_SHAPE_FUNC, class T_SHAPE_MATRICES>
 inline
 typename std::enable_if<T_SHAPE_FUNC::DIM==0>::type
@@ -168,25 +206,34 @@ computeMappingMatrices(
     computeMappingMatrices<T_MESH_ELEMENT, T_SHAPE_FUNC, T_SHAPE_MATRICES>
         (ele, natural_pt, ele_local_coord, shapemat, FieldType<ShapeMatrixType::DNDR_J>());
 
-    if (shapemat.detJ > 0) {
-        //J^-1, dshape/dx
-        shapemat.invJ.noalias() = shapemat.J.inverse();
+    computeInverseJacobianAndDNDX(ele, ele_local_coord, shapemat);
+}
 
-        auto const nnodes(shapemat.dNdr.cols());
-        auto const ele_dim(shapemat.dNdr.rows());
-        assert(shapemat.dNdr.rows()==ele.getDimension());
-        const unsigned global_dim = ele_local_coord.getGlobalDimension();
-        if (global_dim==ele_dim) {
-            shapemat.dNdx.topLeftCorner(ele_dim, nnodes).noalias() = shapemat.invJ * shapemat.dNdr;
-        } else {
-            auto const& matR = ele_local_coord.getRotationMatrixToGlobal(); // 3 x 3
-            auto invJ_dNdr = shapemat.invJ * shapemat.dNdr;
-            auto dshape_global = matR.topLeftCorner(3u, ele_dim) * invJ_dNdr; //3 x nnodes
-            shapemat.dNdx = dshape_global.topLeftCorner(global_dim, nnodes);;
-        }
-    } else {
-        OGS_FATAL("det J = %e is not positive.\n", shapemat.detJ);
-    }
+template <class T_MESH_ELEMENT, class T_SHAPE_FUNC, class T_SHAPE_MATRICES>
+inline
+typename std::enable_if<T_SHAPE_FUNC::DIM!=0>::type
+computeMappingMatrices(
+        const T_MESH_ELEMENT &ele,
+        const double* /*natural_pt*/,
+        const MeshLib::ElementCoordinatesMappingLocal &ele_local_coord,
+        T_SHAPE_MATRICES &shapemat,
+        FieldType<ShapeMatrixType::J_DNDX>)
+{
+    computeJacobian<T_MESH_ELEMENT>(ele_local_coord, shapemat);
+    computeInverseJacobianAndDNDX(ele, ele_local_coord, shapemat);
+}
+
+template <class T_MESH_ELEMENT, class T_SHAPE_FUNC, class T_SHAPE_MATRICES>
+inline
+typename std::enable_if<T_SHAPE_FUNC::DIM==0>::type
+computeMappingMatrices(
+        const T_MESH_ELEMENT &/*ele*/,
+        const double* /*natural_pt*/,
+        const MeshLib::ElementCoordinatesMappingLocal &/*ele_local_coord*/,
+        T_SHAPE_MATRICES &shapemat,
+        FieldType<ShapeMatrixType::J_DNDX>)
+{
+    shapemat.detJ = 1.0;
 }
 
 template <class T_MESH_ELEMENT, class T_SHAPE_FUNC, class T_SHAPE_MATRICES>
@@ -255,6 +302,8 @@ void naturalCoordinatesMappingComputeShapeMatrices(const T_MESH_ELEMENT& ele,
 #define OGS_INSTANTIATE_NATURAL_COORDINATES_MAPPING_DYN(RULE, SHAPE) \
     OGS_INSTANTIATE_NATURAL_COORDINATES_MAPPING_PART(                \
         RULE, SHAPE, 0, ALL, EigenDynamicShapeMatrixPolicy);         \
+    OGS_INSTANTIATE_NATURAL_COORDINATES_MAPPING_PART(                \
+        RULE, SHAPE, 0, J_DNDX, EigenDynamicShapeMatrixPolicy);      \
     /* Those instantiations are needed in unit tests only */         \
     OGS_INSTANTIATE_NATURAL_COORDINATES_MAPPING_PART(                \
         RULE, SHAPE, 0, N, EigenDynamicShapeMatrixPolicy);           \
@@ -270,6 +319,8 @@ void naturalCoordinatesMappingComputeShapeMatrices(const T_MESH_ELEMENT& ele,
 #define OGS_INSTANTIATE_NATURAL_COORDINATES_MAPPING_FIX(RULE, SHAPE, DIM) \
     OGS_INSTANTIATE_NATURAL_COORDINATES_MAPPING_PART(                     \
         RULE, SHAPE, DIM, ALL, EigenFixedShapeMatrixPolicy);              \
+    OGS_INSTANTIATE_NATURAL_COORDINATES_MAPPING_PART(                     \
+        RULE, SHAPE, DIM, J_DNDX, EigenFixedShapeMatrixPolicy);           \
     /* Those instantiations are needed in unit tests only */              \
     OGS_INSTANTIATE_NATURAL_COORDINATES_MAPPING_PART(                     \
         RULE, SHAPE, DIM, N, EigenFixedShapeMatrixPolicy);                \
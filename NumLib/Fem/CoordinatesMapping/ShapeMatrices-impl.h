@@ -82,6 +82,16 @@ inline void setZero(ShapeMatrices<T_N, T_DNDR, T_J, T_DNDX> &shape, ShapeDataFie
     setMatrixZero(shape.dNdx);
 }
 
+template <class T_N, class T_DNDR, class T_J, class T_DNDX>
+inline void setZero(ShapeMatrices<T_N, T_DNDR, T_J, T_DNDX> &shape, ShapeDataFieldType<ShapeMatrixType::J_DNDX>)
+{
+    setMatrixZero(shape.J);
+    shape.detJ = .0;
+    shape.integralMeasure = 0.0;
+    setMatrixZero(shape.invJ);
+    setMatrixZero(shape.dNdx);
+}
+
 template <class T_N, class T_DNDR, class T_J, class T_DNDX>
 inline void setZero(ShapeMatrices<T_N, T_DNDR, T_J, T_DNDX> &shape, ShapeDataFieldType<ShapeMatrixType::ALL>)
 {
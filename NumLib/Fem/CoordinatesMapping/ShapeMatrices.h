@@ -28,6 +28,7 @@ enum class ShapeMatrixType
     N_J,    ///< calculates N, dNdr, J, and detJ
     DNDR_J, ///< calculates dNdr, J, and detJ
     DNDX,   ///< calculates dNdr, J, detJ, invJ, and dNdx
+    J_DNDX, ///< calculates J, detJ, invJ, and dNdx from a given dNdr
     ALL     ///< calculates all
 };
 
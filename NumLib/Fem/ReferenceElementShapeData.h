@@ -0,0 +1,121 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#include <Eigen/StdVector>
+
+namespace NumLib
+{
+/**
+ * Shape functions and their derivatives in natural coordinates tabulated at
+ * the integration points of the reference element.
+ *
+ * The data depends only on the shape function and the integration method, not
+ * on the geometry of a particular mesh element. Therefore it is computed once
+ * per integration order and shared by all elements of the same type, see
+ * get().
+ *
+ * Local assemblers using the table store only the geometry dependent data,
+ * i.e. the integration weight and dNdx, per integration point and take N from
+ * here. Currently these are the mechanics assemblers of SmallDeformation,
+ * ThermoMechanics and HydroMechanics; the other processes still keep complete
+ * shape matrices per integration point.
+ *
+ * \tparam ShapeFunction      The shape function type, e.g. ShapeHex20.
+ * \tparam ShapeMatricesType  A ShapeMatrixPolicy providing the storage types.
+ * \tparam IntegrationMethod  The integration method, e.g.
+ *                            IntegrationGaussRegular<3>.
+ */
+template <typename ShapeFunction, typename ShapeMatricesType,
+          typename IntegrationMethod>
+class ReferenceElementShapeData final
+{
+public:
+    using ShapeMatrices = typename ShapeMatricesType::ShapeMatrices;
+    using ShapeType = typename ShapeMatrices::ShapeType;
+    using DrShapeType = typename ShapeMatrices::DrShapeType;
+
+    /// Returns the tabulated data for the integration order of the given
+    /// integration method. The data is computed on the first request only.
+    /// The returned reference stays valid for the life time of the program.
+    static ReferenceElementShapeData const& get(
+        IntegrationMethod const& integration_method)
+    {
+        static std::mutex mutex;
+        static std::map<unsigned, std::unique_ptr<ReferenceElementShapeData>>
+            cache;
+
+        std::lock_guard<std::mutex> lock(mutex);
+        auto& data = cache[integration_method.getIntegrationOrder()];
+        if (!data)
+            data.reset(new ReferenceElementShapeData(integration_method));
+        return *data;
+    }
+
+    /// Number of integration points the data is tabulated at.
+    std::size_t getNumberOfPoints() const { return _N.size(); }
+
+    /// Shape functions at the given integration point.
+    ShapeType const& N(unsigned const ip) const { return _N[ip]; }
+
+    /// Derivatives of the shape functions in natural coordinates at the given
+    /// integration point.
+    DrShapeType const& dNdr(unsigned const ip) const { return _dNdr[ip]; }
+
+private:
+    explicit ReferenceElementShapeData(
+        IntegrationMethod const& integration_method)
+    {
+        unsigned const n_integration_points =
+            integration_method.getNumberOfPoints();
+        _N.reserve(n_integration_points);
+        _dNdr.reserve(n_integration_points);
+
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            auto const* const natural_pt =
+                integration_method.getWeightedPoint(ip).getCoords();
+
+            _N.emplace_back(ShapeFunction::NPOINTS);
+            ShapeFunction::computeShapeFunction(natural_pt, _N.back());
+
+            _dNdr.emplace_back(ShapeFunction::DIM, ShapeFunction::NPOINTS);
+            _dNdr.back().setZero();
+            computeGradShapeFunction(
+                natural_pt, _dNdr.back(),
+                std::integral_constant<bool, (ShapeFunction::DIM != 0)>{});
+        }
+    }
+
+    static void computeGradShapeFunction(double const* natural_pt,
+                                         DrShapeType& dNdr,
+                                         std::true_type /*has_derivatives*/)
+    {
+        double* const dNdr_data = dNdr.data();
+        ShapeFunction::computeGradShapeFunction(natural_pt, dNdr_data);
+    }
+
+    static void computeGradShapeFunction(double const* /*natural_pt*/,
+                                         DrShapeType& /*dNdr*/,
+                                         std::false_type /*has_derivatives*/)
+    {
+    }
+
+    std::vector<ShapeType, Eigen::aligned_allocator<ShapeType>> _N;
+    std::vector<DrShapeType, Eigen::aligned_allocator<DrShapeType>> _dNdr;
+};
+
+}  // namespace NumLib
@@ -0,0 +1,117 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ExplicitTimeIntegration.h"
+
+#include <cmath>
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
+
+namespace
+{
+//! Updates x = x + h M_lumped^{-1} r in all rows but those of the known
+//! solutions, which are set to their values.
+template <typename KnownSolutions>
+void updateSolution(double const h, GlobalVector const& M_lumped,
+                    GlobalVector const& r,
+                    KnownSolutions const* const known_solutions,
+                    GlobalVector& x)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(M_lumped);
+    MathLib::LinAlg::setLocalAccessibleVector(r);
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+
+    auto const begin = x.getRangeBegin();
+    auto const end = x.getRangeEnd();
+
+    std::vector<bool> is_known(end - begin, false);
+    if (known_solutions)
+    {
+        for (auto const& bc : *known_solutions)
+        {
+            for (auto const id : bc.ids)
+            {
+                if (id >= static_cast<decltype(id)>(begin) &&
+                    id < static_cast<decltype(id)>(end))
+                    is_known[id - begin] = true;
+            }
+        }
+    }
+
+    for (auto i = begin; i < end; ++i)
+    {
+        if (is_known[i - begin])
+            continue;
+
+        auto const m = M_lumped.get(i);
+        if (m == 0)
+            OGS_FATAL(
+                "The lumped mass matrix vanishes in row %d. Explicit time "
+                "integration is not possible for this equation.",
+                i);
+        x.set(i, x.get(i) + h * r.get(i) / m);
+    }
+
+    if (known_solutions)
+    {
+        for (auto const& bc : *known_solutions)
+        {
+            for (std::size_t k = 0; k < bc.ids.size(); ++k)
+                x.set(bc.ids[k], bc.values[k]);
+        }
+    }
+    MathLib::LinAlg::finalizeAssembly(x);
+}
+}  // namespace
+
+namespace NumLib
+{
+unsigned integrateExplicitlyWithLumpedMass(
+    ODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+              NonlinearSolverTag::Picard>& ode,
+    double const t, double const delta_t, GlobalVector& x,
+    ProcessLib::StaggeredCouplingTerm const& coupling_term,
+    double const safety_factor)
+{
+    auto const matrix_specification = ode.getMatrixSpecifications();
+    auto& M_lumped =
+        NumLib::GlobalVectorProvider::provider.getVector(matrix_specification);
+    auto& r =
+        NumLib::GlobalVectorProvider::provider.getVector(matrix_specification);
+
+    double const t_end = t + delta_t;
+    double t_sub = t;
+    unsigned number_of_substeps = 0;
+    while (t_sub < t_end)
+    {
+        double const stable_dt =
+            safety_factor *
+            ode.assembleLumped(t_sub, x, M_lumped, r, coupling_term);
+
+        // Divide the remaining interval into equal substeps, the first of
+        // which is taken now.
+        double const n = std::ceil((t_end - t_sub) / stable_dt);
+        double const t_next = n > 1 ? t_sub + (t_end - t_sub) / n : t_end;
+
+        updateSolution(t_next - t_sub, M_lumped, r,
+                       ode.getKnownSolutions(t_next), x);
+
+        t_sub = t_next;
+        ++number_of_substeps;
+    }
+
+    NumLib::GlobalVectorProvider::provider.releaseVector(r);
+    NumLib::GlobalVectorProvider::provider.releaseVector(M_lumped);
+
+    return number_of_substeps;
+}
+
+}  // namespace NumLib
@@ -0,0 +1,39 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include "ODESystem.h"
+
+namespace NumLib
+{
+//! \addtogroup ODESolver
+//! @{
+
+/*! Advances the solution \c x of the given ODE from \c t to \c t + \c delta_t
+ * by the forward Euler scheme with lumped mass matrix,
+ * \f[ x_{n+1} = x_n + \Delta t \, M_\mathrm{lumped}^{-1} (b - K x_n). \f]
+ *
+ * Since the lumped mass matrix is diagonal, no linear system is solved and no
+ * global matrix is formed, cf. ODESystem::assembleLumped(). If \c delta_t
+ * exceeds \c safety_factor times the stable time step size reported by the
+ * ODE, the time step is divided into equal substeps, each of which is
+ * assembled anew. Known solutions are set at the end of each substep.
+ *
+ * \return the number of substeps.
+ */
+unsigned integrateExplicitlyWithLumpedMass(
+    ODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
+              NonlinearSolverTag::Picard>& ode,
+    double t, double delta_t, GlobalVector& x,
+    ProcessLib::StaggeredCouplingTerm const& coupling_term,
+    double safety_factor = 0.9);
+
+//! @}
+}  // namespace NumLib
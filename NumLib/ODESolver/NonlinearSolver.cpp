@@ -79,7 +79,16 @@ bool NonlinearSolver<NonlinearSolverTag::Picard>::solve(
 
         BaseLib::RunTime time_linear_solver;
         time_linear_solver.start();
-        bool iteration_succeeded = _linear_solver.solve(A, rhs, x_new);
+        // The linear solver may be shared with other nonlinear solvers,
+        // which would have replaced the setup of the last solve.
+        bool const reuse_setup =
+            sys.isLinearSystemMatrixUnchanged() && _setup_system == &sys &&
+            _setup_number == _linear_solver.getNumberOfSetups();
+        bool iteration_succeeded =
+            reuse_setup ? _linear_solver.solveWithPreviousSetup(A, rhs, x_new)
+                        : _linear_solver.solve(A, rhs, x_new);
+        _setup_system = &sys;
+        _setup_number = _linear_solver.getNumberOfSetups();
         INFO("[time] Linear solver took %g s.", time_linear_solver.elapsed());
 
         if (!iteration_succeeded)
@@ -197,6 +197,11 @@ private:
     std::size_t _rhs_id = 0u;    //!< ID of the right-hand side vector.
     std::size_t _x_new_id = 0u;  //!< ID of the vector storing the solution of
                                  //!the linearized equation.
+
+    //! System of the last linear solve and the number of setups of the linear
+    //! solver after it. The setup is reused only if both are unchanged.
+    System const* _setup_system = nullptr;
+    std::size_t _setup_number = 0u;
 };
 
 /*! Creates a new nonlinear solver from the given configuration.
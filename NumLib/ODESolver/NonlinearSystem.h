@@ -101,6 +101,11 @@ public:
     //! \f$ A \cdot x = \mathit{rhs} \f$.
     virtual void applyKnownSolutionsPicard(GlobalMatrix& A, GlobalVector& rhs,
                                            GlobalVector& x) = 0;
+
+    //! Check whether the matrix \c A of the last call of
+    //! applyKnownSolutionsPicard() equals the one of the call before. Then
+    //! the linear solver can reuse its factorization or preconditioner.
+    virtual bool isLinearSystemMatrixUnchanged() const { return false; }
 };
 
 //! @}
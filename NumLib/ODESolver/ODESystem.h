@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/MatrixVectorTraits.h"
 #include "NumLib/IndexValueVector.h"
 
@@ -55,6 +56,26 @@ public:
         GlobalVector& b,
         ProcessLib::StaggeredCouplingTerm const& coupling_term) = 0;
 
+    /*! Assemble the lumped mass matrix, i.e., the row sums of \c M, into
+     * \c M_lumped and the residual \f$ r = b - K x \f$ into \c r at the
+     * provided state (\c t, \c x) without forming the global matrices.
+     *
+     * This is used for explicit time integration, see
+     * integrateExplicitlyWithLumpedMass().
+     *
+     * \return the largest time step size for which the forward Euler scheme
+     *         is stable, or infinity if there is no such bound.
+     */
+    virtual double assembleLumped(
+        const double /*t*/, GlobalVector const& /*x*/,
+        GlobalVector& /*M_lumped*/, GlobalVector& /*r*/,
+        ProcessLib::StaggeredCouplingTerm const& /*coupling_term*/)
+    {
+        OGS_FATAL(
+            "This ODE system does not support the assembly with lumped mass "
+            "matrix.");
+    }
+
     using Index = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
 
     //! Provides known solutions (Dirichlet boundary conditions) vector for
@@ -65,6 +86,14 @@ public:
         (void)t;
         return nullptr;  // by default there are no known solutions
     }
+
+    /*! Check whether \c M, \c K and \c b depend neither on time nor on the
+     * solution, such that they have to be assembled only once.
+     *
+     * \remark
+     * The known solutions are still evaluated at every time step.
+     */
+    virtual bool isAssemblyConstant() const { return false; }
 };
 
 /*! Interface for a first-order implicit quasi-linear ODE.
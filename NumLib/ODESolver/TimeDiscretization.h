@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <vector>
 
 #include "MathLib/LinAlg/LinAlg.h"
@@ -52,10 +53,6 @@ public:
  * \note The method documentation of this class uses quantities introduced in the
  *       following section.
  *
- * \todo Currently this interface does not yet support adaptive timestepping.
- *       While implementing that will lead to no changes for single-step methods,
- *       for multi-step methods this interface will have to be extended.
- *
  *
  * Discretizing first-order ODEs {#concept_time_discretization}
  * =============================
@@ -108,7 +105,9 @@ public:
  * BDF(2)         | \f$ x_{n+2} \f$ | \f$ t_{n+1} \f$ | \f$ 3/(2\Delta t) \f$ | \f$ x_{n+2} \f$ | \f$ (2\cdot x_{n+1} - x_n/2)/\Delta t \f$
  *
  * The other backward differentiation formulas of orders 1 to 6 are also implemented, but only
- * BDF(2) has bee given here for brevity.
+ * BDF(2) has bee given here for brevity. The table lists the BDF(2) weights for
+ * a constant timestep size; for varying timestep sizes they are computed from
+ * the times of the solution history.
  *
  */
 class TimeDiscretization
@@ -133,9 +132,10 @@ public:
 
     /*! Indicate that the computation of a new timestep is being started now.
      *
-     * \warning Currently changing timestep sizes are not supported. Thus,
-     *          \p delta_t must not change throughout the entire time
-     *          integration process! This is not checked by this code!
+     * The timestep size \p delta_t may change from one timestep to the next.
+     * If a timestep is repeated, e.g., because it has been rejected, this
+     * method is called again without pushState() having been called in
+     * between.
      */
     virtual void nextTimestep(const double t, const double delta_t) = 0;
 
@@ -199,6 +199,27 @@ public:
      * The CrankNicolson scheme needs such preload.
      */
     virtual bool needsPreload() const { return false; }
+
+    /*! Overwrites \c x with a prediction of the solution at the current time,
+     * which is used as the initial guess of the nonlinear solver.
+     *
+     * Must be called after nextTimestep(). The default implementation leaves
+     * \c x, i.e., the solution of the preceding timestep, unchanged.
+     */
+    virtual void predictX(GlobalVector& /*x*/) {}
+
+    /*! Computes an estimate of the local truncation error of the current
+     * timestep from the new solution \c x_new.
+     *
+     * \return the order of the scheme the estimate belongs to, or zero if no
+     *         estimate is available for the current timestep, in which case
+     *         \c error is not touched.
+     */
+    virtual unsigned estimateLocalTruncationError(
+        GlobalVector const& /*x_new*/, GlobalVector& /*error*/)
+    {
+        return 0;
+    }
     //! @}
 };
 
@@ -255,8 +276,16 @@ private:
 class ForwardEuler final : public TimeDiscretization
 {
 public:
-    ForwardEuler()
-        : _x_old(NumLib::GlobalVectorProvider::provider.getVector())
+    /*! Constructs a new instance.
+     *
+     * \param mass_lumping If set, the mass matrix is lumped and the time step
+     *                     is computed without a linear solver and without
+     *                     global matrices, see
+     *                     integrateExplicitlyWithLumpedMass().
+     */
+    explicit ForwardEuler(bool const mass_lumping = false)
+        : _mass_lumping(mass_lumping),
+          _x_old(NumLib::GlobalVectorProvider::provider.getVector())
     {
     }
 
@@ -310,7 +339,10 @@ public:
     double getDxDx() const override { return 0.0; }
     //! Returns the solution from the preceding timestep.
     GlobalVector const& getXOld() const { return _x_old; }
+    //! Tells whether the mass matrix is lumped.
+    bool useMassLumping() const { return _mass_lumping; }
 private:
+    bool const _mass_lumping;
     double _t;        //!< \f$ t_C \f$
     double _t_old;    //!< the time of the preceding timestep
     double _delta_t;  //!< the timestep size
@@ -382,24 +414,20 @@ private:
     GlobalVector& _x_old;       //!< the solution from the preceding timestep
 };
 
-namespace detail
-{
-//! Coefficients used in the backward differentiation formulas.
-const double BDF_Coeffs[6][7] = {
-    // leftmost column: weight of the solution at the new timestep
-    // signs of columns > 1 are flipped compared to standard BDF tableaus
-    {1.0, 1.0},
-    {1.5, 2.0, -0.5},
-    {11.0 / 6.0, 3.0, -1.5, 1.0 / 3.0},
-    {25.0 / 12.0, 4.0, -3.0, 4.0 / 3.0, -0.25},
-    {137.0 / 60.0, 5.0, -5.0, 10.0 / 3.0, -1.25, 1.0 / 5.0},
-    {147.0 / 60.0, 6.0, -7.5, 20.0 / 3.0, -3.75, 6.0 / 5.0, -1.0 / 6.0}
-    // coefficient of (for BDF(6), the oldest state, x_n, is always rightmost)
-    //        x_+6, x_+5, x_+4,       x_+3,  x_+2, x_+1,     x_n
-};
-}
-
-//! Backward differentiation formula.
+/*! Variable-step backward differentiation formula.
+ *
+ * The BDF of order \f$ k \f$ approximates \f$ \dot x(t_{n+1}) \f$ by the
+ * derivative of the polynomial interpolating the solutions at
+ * \f$ t_{n+1}, t_n, \ldots, t_{n+1-k} \f$. Its weights are computed from the
+ * actual times of the solution history, such that the timestep size may change
+ * from one timestep to the next. For constant timestep sizes the classical BDF
+ * coefficients are obtained.
+ *
+ * The polynomial through the solutions at \f$ t_n, \ldots, t_{n-k} \f$,
+ * evaluated at \f$ t_{n+1} \f$, predicts the new solution; see predictX().
+ * The difference between prediction and solution yields an estimate of the
+ * local truncation error, see estimateLocalTruncationError().
+ */
 class BackwardDifferentiationFormula final : public TimeDiscretization
 {
 public:
@@ -407,25 +435,30 @@ public:
      *
      * \param num_steps The order of the BDF to be used
      *                  (= the number of timesteps kept in the internal history
-     * buffer).
+     *                  buffer).
      *                  Valid range: 1 through 6.
      *
      * \note Until a sufficient number of timesteps has been computed to be able
      *       to use the full \c num_steps order BDF, lower order BDFs are used
-     * in
-     *       the first timesteps.
+     *       in the first timesteps.
      */
     explicit BackwardDifferentiationFormula(const unsigned num_steps)
-        : _num_steps(num_steps)
+        : _num_steps(num_steps), _order(num_steps)
     {
         assert(1 <= num_steps && num_steps <= 6);
-        _xs_old.reserve(num_steps);
+        // One more solution than needed by the BDF itself is kept for the
+        // predictor of the same order.
+        _xs_old.reserve(num_steps + 1);
+        _ts_old.reserve(num_steps + 1);
     }
 
     ~BackwardDifferentiationFormula() override
     {
         for (auto* x : _xs_old)
             NumLib::GlobalVectorProvider::provider.releaseVector(*x);
+        if (_x_predicted)
+            NumLib::GlobalVectorProvider::provider.releaseVector(
+                *_x_predicted);
     }
 
     void setInitialState(const double t0, GlobalVector const& x0) override
@@ -433,25 +466,49 @@ public:
         _t = t0;
         _xs_old.push_back(
             &NumLib::GlobalVectorProvider::provider.getVector(x0));
+        _ts_old.push_back(t0);
     }
 
-    void pushState(const double, GlobalVector const& x,
+    void pushState(const double t, GlobalVector const& x,
                    InternalMatrixStorage const&) override
     {
-        namespace LinAlg = MathLib::LinAlg;
-        // TODO use boost cirular buffer?
+        _predicted_order = 0;
 
-        // until _xs_old is filled, lower-order BDF formulas are used.
-        if (_xs_old.size() < _num_steps)
+        // A repeated push at the same time replaces the newest solution.
+        if (t == _ts_old.front())
+        {
+            MathLib::LinAlg::copy(x, *_xs_old.front());
+            return;
+        }
+
+        // The history is ordered from the newest to the oldest solution.
+        // Until it is filled, lower-order BDF formulas are used.
+        if (_xs_old.size() < _num_steps + 1)
         {
             _xs_old.push_back(
                 &NumLib::GlobalVectorProvider::provider.getVector(x));
+            _ts_old.push_back(t);
         }
         else
         {
-            LinAlg::copy(x, *_xs_old[_offset]);
-            _offset = (_offset + 1) %
-                      _num_steps;  // treat _xs_old as a circular buffer
+            MathLib::LinAlg::copy(x, *_xs_old.back());
+            _ts_old.back() = t;
+        }
+        std::rotate(_xs_old.begin(), _xs_old.end() - 1, _xs_old.end());
+        std::rotate(_ts_old.begin(), _ts_old.end() - 1, _ts_old.end());
+
+        if (!_variable_order)
+            return;
+
+        // Raise the order after order + 1 steps at the current order,
+        // provided that the history suffices for the predictor of the
+        // raised order.
+        ++_steps_at_order;
+        if (_steps_at_order > _order && _order < _max_variable_order &&
+            _xs_old.size() >= _order + 2)
+        {
+            ++_order;
+            _steps_at_order = 0;
         }
     }
 
@@ -464,8 +521,11 @@ public:
     double getCurrentTime() const override { return _t; }
     double getNewXWeight() const override
     {
-        auto const k = eff_num_steps();
-        return detail::BDF_Coeffs[k - 1][0] / _delta_t;
+        // derivative of the Lagrange polynomial belonging to t_{n+1}
+        double weight = 0.0;
+        for (std::size_t j = 0; j < eff_num_steps(); ++j)
+            weight += 1.0 / (_t - _ts_old[j]);
+        return weight;
     }
 
     void getWeightedOldX(GlobalVector& y) const override
@@ -473,29 +533,155 @@ public:
         namespace LinAlg = MathLib::LinAlg;
 
         auto const k = eff_num_steps();
-        auto const* const BDFk = detail::BDF_Coeffs[k - 1];
 
-        // compute linear combination \sum_{i=0}^{k-1} BDFk_{k-i} \cdot x_{n+i}
-        LinAlg::copy(*_xs_old[_offset], y);  // _xs_old[offset] = x_n
-        LinAlg::scale(y, BDFk[k]);
+        // y = -\sum_{i=0}^{k-1} l_i'(t_{n+1}) \cdot x_{n-i}, where l_i is the
+        // Lagrange polynomial belonging to t_{n-i}.
+        for (std::size_t i = 0; i < k; ++i)
+        {
+            double weight = 1.0 / (_t - _ts_old[i]);
+            for (std::size_t j = 0; j < k; ++j)
+            {
+                if (j != i)
+                    weight *= (_t - _ts_old[j]) / (_ts_old[i] - _ts_old[j]);
+            }
+            if (i == 0)
+            {
+                LinAlg::copy(*_xs_old[0], y);
+                LinAlg::scale(y, weight);
+            }
+            else
+            {
+                LinAlg::axpy(y, weight, *_xs_old[i]);
+            }
+        }
+    }
+
+    /*! Extrapolates the solution history to the current time.
+     *
+     * The polynomial through the solutions at \f$ t_n, \ldots, t_{n-k} \f$ is
+     * used, or through fewer solutions if the history is still too short.
+     */
+    void predictX(GlobalVector& x) override
+    {
+        auto const k = eff_num_steps();
+        _predicted_order = 0;
+        if (_xs_old.size() < 2)
+            return;
+
+        auto const num_points = std::min(k + 1, _xs_old.size());
+        if (!_x_predicted)
+            _x_predicted =
+                &NumLib::GlobalVectorProvider::provider.getVector(x);
+        extrapolate(num_points, *_x_predicted);
+        MathLib::LinAlg::copy(*_x_predicted, x);
+
+        // The error estimate requires a predictor of the same order.
+        if (num_points == k + 1)
+            _predicted_order = k;
+    }
+
+    /*! Estimates the local truncation error of the current timestep by
+     * \f[ e = \frac{t_{n+1} - t_n}{t_{n+1} - t_{n-k}}
+     *         (x_{n+1} - x_{n+1}^{\mathrm{pred}}). \f]
+     *
+     * If the variable order has been enabled, the order is lowered for the
+     * following timesteps if the same estimate for the BDF of order \f$ k-1
+     * \f$ is not larger.
+     */
+    unsigned estimateLocalTruncationError(GlobalVector const& x_new,
+                                          GlobalVector& error) override
+    {
+        namespace LinAlg = MathLib::LinAlg;
 
-        for (unsigned i = 1; i < k; ++i)
+        auto const k = _predicted_order;
+        if (k == 0)
+            return 0;
+
+        LinAlg::copy(x_new, error);
+        LinAlg::axpy(error, -1.0, *_x_predicted);
+        LinAlg::scale(error, _delta_t / (_t - _ts_old[k]));
+
+        if (_variable_order && k > 1)
         {
-            auto const off = (_offset + i) % k;
-            LinAlg::axpy(y, BDFk[k - i], *_xs_old[off]);
+            auto& error_lower =
+                NumLib::GlobalVectorProvider::provider.getVector(x_new);
+            extrapolate(k, error_lower);
+            LinAlg::aypx(error_lower, -1.0, x_new);
+            LinAlg::scale(error_lower, _delta_t / (_t - _ts_old[k - 1]));
+
+            auto const norm_type = MathLib::VecNormType::NORM2;
+            if (LinAlg::norm(error_lower, norm_type) <=
+                LinAlg::norm(error, norm_type))
+            {
+                _order = k - 1;
+                _steps_at_order = 0;
+            }
+            NumLib::GlobalVectorProvider::provider.releaseVector(error_lower);
         }
 
-        LinAlg::scale(y, 1.0 / _delta_t);
+        return k;
+    }
+
+    /*! Lets the order of the BDF vary between one and the order given to the
+     * constructor, but at most five, based on the local truncation error
+     * estimates. The integration restarts with the first order BDF.
+     */
+    void enableVariableOrder()
+    {
+        _variable_order = true;
+        _max_variable_order = std::min(_num_steps, 5u);
+        _order = 1;
+        _steps_at_order = 0;
     }
 
 private:
-    std::size_t eff_num_steps() const { return _xs_old.size(); }
-    const unsigned _num_steps;  //!< The order of the BDF method
+    std::size_t eff_num_steps() const
+    {
+        return std::min<std::size_t>(_order, _xs_old.size());
+    }
+
+    //! Evaluates the polynomial through the newest \c num_points solutions at
+    //! the current time.
+    void extrapolate(std::size_t const num_points, GlobalVector& y) const
+    {
+        namespace LinAlg = MathLib::LinAlg;
+
+        for (std::size_t i = 0; i < num_points; ++i)
+        {
+            double weight = 1.0;
+            for (std::size_t j = 0; j < num_points; ++j)
+            {
+                if (j != i)
+                    weight *= (_t - _ts_old[j]) / (_ts_old[i] - _ts_old[j]);
+            }
+            if (i == 0)
+            {
+                LinAlg::copy(*_xs_old[0], y);
+                LinAlg::scale(y, weight);
+            }
+            else
+            {
+                LinAlg::axpy(y, weight, *_xs_old[i]);
+            }
+        }
+    }
+
+    const unsigned _num_steps;  //!< The maximum order of the BDF method
+    unsigned _order;            //!< The current order of the BDF method
     double _t;                  //!< \f$ t_C \f$
     double _delta_t;            //!< the timestep size
 
-    std::vector<GlobalVector*> _xs_old;  //!< solutions from the preceding timesteps
-    unsigned _offset = 0;  //!< allows treating \c _xs_old as circular buffer
+    //! solutions from the preceding timesteps, newest first
+    std::vector<GlobalVector*> _xs_old;
+    std::vector<double> _ts_old;  //!< times of the solutions in \c _xs_old
+
+    GlobalVector* _x_predicted = nullptr;  //!< result of predictX()
+    //! order of the predictor of the current timestep, zero if none
+    std::size_t _predicted_order = 0;
+
+    bool _variable_order = false;
+    unsigned _max_variable_order = 1;
+    unsigned _steps_at_order = 0;  //!< accepted timesteps at current order
 };
 
 //! @}
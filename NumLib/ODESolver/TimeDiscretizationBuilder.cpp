@@ -27,7 +27,10 @@ std::unique_ptr<TimeDiscretization> createTimeDiscretization(
     //! \ogs_file_param_special{prj__time_loop__processes__process__time_discretization__ForwardEuler}
     if (type == "ForwardEuler")
     {
-        return std::make_unique<ForwardEuler>();
+        auto const mass_lumping =
+            //! \ogs_file_param{prj__time_loop__processes__process__time_discretization__ForwardEuler__mass_lumping}
+            config.getConfigParameter<bool>("mass_lumping", false);
+        return std::make_unique<ForwardEuler>(mass_lumping);
     }
     //! \ogs_file_param_special{prj__time_loop__processes__process__time_discretization__CrankNicolson}
     if (type == "CrankNicolson")
@@ -12,6 +12,7 @@
 #include "MathLib/LinAlg/ApplyKnownSolution.h"
 #include "MathLib/LinAlg/UnifiedMatrixSetters.h"
 #include "NumLib/IndexValueVector.h"
+#include "ProcessLib/StaggeredCouplingTerm.h"
 
 namespace detail
 {
@@ -45,20 +46,14 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
       _time_disc(time_discretization),
       _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
 {
-    _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(), _Jac_id);
-    _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(), _M_id);
-    _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        _ode.getMatrixSpecifications(), _K_id);
-    _b = &NumLib::GlobalVectorProvider::provider.getVector(
-        _ode.getMatrixSpecifications(), _b_id);
 }
 
 TimeDiscretizedODESystem<
     ODESystemTag::FirstOrderImplicitQuasilinear,
     NonlinearSolverTag::Newton>::~TimeDiscretizedODESystem()
 {
+    if (!_M)
+        return;
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_Jac);
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
@@ -77,6 +72,20 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     auto const dxdot_dx = _time_disc.getNewXWeight();
     auto const dx_dx = _time_disc.getDxDx();
 
+    // The global matrices are allocated on first use only, such that they are
+    // never formed if the ODE is integrated explicitly with lumped mass.
+    if (!_M)
+    {
+        _Jac = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(), _Jac_id);
+        _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(), _M_id);
+        _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(), _K_id);
+        _b = &NumLib::GlobalVectorProvider::provider.getVector(
+            _ode.getMatrixSpecifications(), _b_id);
+    }
+
     auto& xdot = NumLib::GlobalVectorProvider::provider.getVector(_xdot_id);
     _time_disc.getXdot(x_new_timestep, xdot);
 
@@ -157,18 +166,14 @@ TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
       _time_disc(time_discretization),
       _mat_trans(createMatrixTranslator<ODETag>(time_discretization))
 {
-    _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        ode.getMatrixSpecifications(), _M_id);
-    _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
-        ode.getMatrixSpecifications(), _K_id);
-    _b = &NumLib::GlobalVectorProvider::provider.getVector(
-        ode.getMatrixSpecifications(), _b_id);
 }
 
 TimeDiscretizedODESystem<
     ODESystemTag::FirstOrderImplicitQuasilinear,
     NonlinearSolverTag::Picard>::~TimeDiscretizedODESystem()
 {
+    if (!_M)
+        return;
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_M);
     NumLib::GlobalMatrixProvider::provider.releaseMatrix(*_K);
     NumLib::GlobalVectorProvider::provider.releaseVector(*_b);
@@ -184,6 +189,27 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     auto const t = _time_disc.getCurrentTime();
     auto const& x_curr = _time_disc.getCurrentX(x_new_timestep);
 
+    // See the Newton variant regarding the allocation on first use.
+    if (!_M)
+    {
+        _M = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(), _M_id);
+        _K = &NumLib::GlobalMatrixProvider::provider.getMatrix(
+            _ode.getMatrixSpecifications(), _K_id);
+        _b = &NumLib::GlobalVectorProvider::provider.getVector(
+            _ode.getMatrixSpecifications(), _b_id);
+    }
+
+    // The coupling terms of staggered schemes change the assembly.
+    bool const constant_assembly =
+        _ode.isAssemblyConstant() && coupling_term.empty;
+    _assembly_reused = constant_assembly && _has_constant_assembly;
+    if (_assembly_reused)
+    {
+        DBUG("Reuse the constant M, K and b.");
+        return;
+    }
+
     _M->setZero();
     _K->setZero();
     _b->setZero();
@@ -193,6 +219,8 @@ void TimeDiscretizedODESystem<ODESystemTag::FirstOrderImplicitQuasilinear,
     LinAlg::finalizeAssembly(*_M);
     LinAlg::finalizeAssembly(*_K);
     LinAlg::finalizeAssembly(*_b);
+
+    _has_constant_assembly = constant_assembly;
 }
 
 void TimeDiscretizedODESystem<
@@ -212,10 +240,10 @@ void TimeDiscretizedODESystem<
     auto const* known_solutions =
         _ode.getKnownSolutions(_time_disc.getCurrentTime());
 
+    using IndexType = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
+    std::vector<IndexType> ids;
     if (known_solutions)
     {
-        using IndexType = MathLib::MatrixVectorTraits<GlobalMatrix>::Index;
-        std::vector<IndexType> ids;
         std::vector<double> values;
         for (auto const& bc : *known_solutions)
         {
@@ -225,6 +253,14 @@ void TimeDiscretizedODESystem<
         }
         MathLib::applyKnownSolution(A, rhs, x, ids, values);
     }
+
+    // A = M * weight + K with known solutions only depends on these.
+    auto const new_x_weight = _time_disc.getNewXWeight();
+    _linear_system_matrix_unchanged = _assembly_reused &&
+                                      new_x_weight == _previous_new_x_weight &&
+                                      ids == _previous_known_ids;
+    _previous_new_x_weight = new_x_weight;
+    _previous_known_ids = std::move(ids);
 }
 
 }  // NumLib
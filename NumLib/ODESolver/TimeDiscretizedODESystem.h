@@ -133,10 +133,10 @@ private:
     //! the object used to compute the matrix/vector for the nonlinear solver
     std::unique_ptr<MatTrans> _mat_trans;
 
-    GlobalMatrix* _Jac;  //!< the Jacobian of the residual
-    GlobalMatrix* _M;    //!< Matrix \f$ M \f$.
-    GlobalMatrix* _K;    //!< Matrix \f$ K \f$.
-    GlobalVector* _b;    //!< Matrix \f$ b \f$.
+    GlobalMatrix* _Jac = nullptr;  //!< the Jacobian of the residual
+    GlobalMatrix* _M = nullptr;    //!< Matrix \f$ M \f$.
+    GlobalMatrix* _K = nullptr;    //!< Matrix \f$ K \f$.
+    GlobalVector* _b = nullptr;    //!< Matrix \f$ b \f$.
 
     std::size_t _Jac_id = 0u;  //!< ID of the \c _Jac matrix.
     std::size_t _M_id = 0u;    //!< ID of the \c _M matrix.
@@ -199,6 +199,11 @@ public:
     void applyKnownSolutionsPicard(GlobalMatrix& A, GlobalVector& rhs,
                                    GlobalVector& x) override;
 
+    bool isLinearSystemMatrixUnchanged() const override
+    {
+        return _linear_system_matrix_unchanged;
+    }
+
     bool isLinear() const override
     {
         return _time_disc.isLinearTimeDisc() || _ode.isLinear();
@@ -232,13 +237,26 @@ private:
     //! the object used to compute the matrix/vector for the nonlinear solver
     std::unique_ptr<MatTrans> _mat_trans;
 
-    GlobalMatrix* _M;  //!< Matrix \f$ M \f$.
-    GlobalMatrix* _K;  //!< Matrix \f$ K \f$.
-    GlobalVector* _b;  //!< Matrix \f$ b \f$.
+    GlobalMatrix* _M = nullptr;  //!< Matrix \f$ M \f$.
+    GlobalMatrix* _K = nullptr;  //!< Matrix \f$ K \f$.
+    GlobalVector* _b = nullptr;  //!< Matrix \f$ b \f$.
 
     std::size_t _M_id = 0u;  //!< ID of the \c _M matrix.
     std::size_t _K_id = 0u;  //!< ID of the \c _K matrix.
     std::size_t _b_id = 0u;  //!< ID of the \c _b vector.
+
+    //! Set if \c _M, \c _K and \c _b hold a constant assembly, see
+    //! ODESystem::isAssemblyConstant().
+    bool _has_constant_assembly = false;
+    //! Set if the last call of assemble() reused the constant assembly.
+    bool _assembly_reused = false;
+
+    //! Weight of \c M in the last computed matrix \c A and the ids of the
+    //! known solutions applied to it.
+    double _previous_new_x_weight = 0.0;
+    std::vector<MathLib::MatrixVectorTraits<GlobalMatrix>::Index>
+        _previous_known_ids;
+    bool _linear_system_matrix_unchanged = false;
 };
 
 //! @}
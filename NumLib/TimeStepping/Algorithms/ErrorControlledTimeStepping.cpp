@@ -0,0 +1,206 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include "ErrorControlledTimeStepping.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <logog/include/logog.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "BaseLib/Error.h"
+
+namespace NumLib
+{
+ErrorControlledTimeStepping::ErrorControlledTimeStepping(
+    double const t_initial, double const t_end, double const min_dt,
+    double const max_dt, double const initial_dt, double const abstol,
+    double const reltol, MathLib::VecNormType const norm_type,
+    double const safety_factor, double const min_factor,
+    double const max_factor)
+    : _t_initial(t_initial),
+      _t_end(t_end),
+      _min_dt(min_dt),
+      _max_dt(max_dt),
+      _initial_dt(initial_dt),
+      _abstol(abstol),
+      _reltol(reltol),
+      _norm_type(norm_type),
+      _safety_factor(safety_factor),
+      _min_factor(min_factor),
+      _max_factor(max_factor),
+      _ts_pre(t_initial),
+      _ts_current(t_initial)
+{
+    if (!(0 < min_dt && min_dt <= initial_dt && initial_dt <= max_dt))
+        OGS_FATAL(
+            "ErrorControlledTimeStepping: the time step sizes must satisfy 0 < "
+            "minimum_dt <= initial_dt <= maximum_dt, but minimum_dt = %g, "
+            "initial_dt = %g and maximum_dt = %g were given.",
+            min_dt, initial_dt, max_dt);
+    if (!(abstol > 0 || reltol > 0))
+        OGS_FATAL(
+            "ErrorControlledTimeStepping: at least one of the tolerances must "
+            "be positive.");
+    if (!(0 < min_factor && min_factor <= 1 && 1 <= max_factor))
+        OGS_FATAL(
+            "ErrorControlledTimeStepping: the time step size factors must "
+            "satisfy 0 < minimum_factor <= 1 <= maximum_factor.");
+}
+
+std::unique_ptr<ITimeStepAlgorithm> ErrorControlledTimeStepping::newInstance(
+    BaseLib::ConfigTree const& config)
+{
+    //! \ogs_file_param{prj__time_loop__time_stepping__type}
+    config.checkConfigParameter("type", "ErrorControlledTimeStepping");
+
+    //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__t_initial}
+    auto const t_initial = config.getConfigParameter<double>("t_initial");
+    //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__t_end}
+    auto const t_end = config.getConfigParameter<double>("t_end");
+    //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__initial_dt}
+    auto const initial_dt = config.getConfigParameter<double>("initial_dt");
+    //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__minimum_dt}
+    auto const min_dt = config.getConfigParameter<double>("minimum_dt");
+    //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__maximum_dt}
+    auto const max_dt = config.getConfigParameter<double>("maximum_dt");
+    //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__abstol}
+    auto const abstol = config.getConfigParameter<double>("abstol", 0.0);
+    //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__reltol}
+    auto const reltol = config.getConfigParameter<double>("reltol", 0.0);
+    auto const norm_type_str =
+        //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__norm_type}
+        config.getConfigParameter<std::string>("norm_type", "NORM2");
+    auto const norm_type = MathLib::convertStringToVecNormType(norm_type_str);
+    if (norm_type == MathLib::VecNormType::INVALID)
+        OGS_FATAL("Unknown vector norm type `%s'.", norm_type_str.c_str());
+
+    auto const safety_factor =
+        //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__safety_factor}
+        config.getConfigParameter<double>("safety_factor", 0.9);
+    auto const min_factor =
+        //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__minimum_factor}
+        config.getConfigParameter<double>("minimum_factor", 0.2);
+    auto const max_factor =
+        //! \ogs_file_param{prj__time_loop__time_stepping__ErrorControlledTimeStepping__maximum_factor}
+        config.getConfigParameter<double>("maximum_factor", 5.0);
+
+    return std::make_unique<ErrorControlledTimeStepping>(
+        t_initial, t_end, min_dt, max_dt, initial_dt, abstol, reltol,
+        norm_type, safety_factor, min_factor, max_factor);
+}
+
+void ErrorControlledTimeStepping::addErrorEstimate(double const error_norm,
+                                                   double const solution_norm,
+                                                   unsigned const order)
+{
+    double const scaled_error =
+        error_norm / (_abstol + _reltol * solution_norm);
+    if (scaled_error > _scaled_error)
+    {
+        _scaled_error = scaled_error;
+        _order = order;
+    }
+}
+
+bool ErrorControlledTimeStepping::rejectNonlinearSolverFailure()
+{
+    if (_dt <= _min_dt)
+        return false;
+    _nonlinear_solver_failed = true;
+    return true;
+}
+
+bool ErrorControlledTimeStepping::accepted() const
+{
+    if (_nonlinear_solver_failed)
+        return false;
+    return _scaled_error <= 1.0 || _dt <= _min_dt;
+}
+
+bool ErrorControlledTimeStepping::next()
+{
+    // check current time step
+    if (accepted() && std::abs(_ts_current.current() - _t_end) <
+                          std::numeric_limits<double>::epsilon())
+        return false;
+
+    // confirm current time and move to the next if accepted
+    if (accepted())
+    {
+        if (_scaled_error > 1.0)
+            WARN(
+                "The local truncation error of the time step at t = %g "
+                "exceeds the tolerance by a factor of %g. The time step is "
+                "accepted since its size is the minimum allowed one.",
+                _ts_current.current(), _scaled_error);
+        if (_ts_current.steps() > 0)
+            _dt_vector.push_back(_ts_current.dt());
+        _ts_pre = _ts_current;
+    }
+    else if (_nonlinear_solver_failed)
+    {
+        INFO(
+            "The nonlinear solver failed. The time step at t = %g is repeated.",
+            _ts_current.current());
+        ++_n_rejected_steps;
+    }
+    else
+    {
+        INFO(
+            "The local truncation error exceeds the tolerance by a factor of "
+            "%g. The time step at t = %g is repeated.",
+            _scaled_error, _ts_current.current());
+        ++_n_rejected_steps;
+    }
+
+    // prepare the next time step info
+    _dt = getNextTimeStepSize();
+    _ts_current = _ts_pre;
+    _ts_current += _dt;
+
+    _scaled_error = -1.0;
+    _nonlinear_solver_failed = false;
+
+    return true;
+}
+
+double ErrorControlledTimeStepping::getNextTimeStepSize() const
+{
+    double dt = _initial_dt;
+
+    if (_ts_current.steps() > 0)
+    {
+        dt = _dt;
+        if (_nonlinear_solver_failed)
+            dt *= _min_factor;
+        else if (_scaled_error >= 0.0)
+        {
+            // The error behaves like dt^(k+1).
+            double const factor =
+                _scaled_error > 0.0
+                    ? _safety_factor *
+                          std::pow(_scaled_error, -1.0 / (_order + 1.0))
+                    : _max_factor;
+            dt *= std::min(_max_factor, std::max(_min_factor, factor));
+        }
+    }
+
+    // check whether out of the boundary
+    dt = std::min(_max_dt, std::max(_min_dt, dt));
+
+    if (_ts_pre.current() + dt > _t_end)
+        dt = _t_end - _ts_pre.current();
+
+    return dt;
+}
+
+}  // namespace NumLib
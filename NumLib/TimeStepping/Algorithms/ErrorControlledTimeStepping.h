@@ -0,0 +1,163 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlgEnums.h"
+
+#include "ITimeStepAlgorithm.h"
+
+namespace BaseLib
+{
+class ConfigTree;
+}
+
+namespace NumLib
+{
+/**
+ * \brief Time stepping controlled by an estimate of the local truncation error
+ *
+ * After each time step the time discretization provides an estimate \f$e\f$ of
+ * the local truncation error of the new solution \f$x\f$, cf.
+ * TimeDiscretization::estimateLocalTruncationError(). The error is scaled by
+ * the tolerance
+ * \f[
+ *  \varepsilon = \frac{\|e\|}{\mathrm{abstol} + \mathrm{reltol} \, \|x\|},
+ * \f]
+ * and the time step is accepted if \f$\varepsilon \le 1\f$. Otherwise it is
+ * repeated with a smaller time step size. With the order \f$k\f$ of the time
+ * discretization, the next time step size is
+ * \f[
+ *  \Delta t_{n+1} = \Delta t_n \, \min\left(f_{\max}, \max\left(f_{\min},
+ *      s \, \varepsilon^{-1/(k+1)}\right)\right),
+ * \f]
+ * where \f$s\f$ is a safety factor. The time step size is bounded by the
+ * minimum and maximum allowed values; time steps of the minimum size are
+ * accepted regardless of their error.
+ *
+ * If several processes are integrated, the largest scaled error of all of
+ * them is used. Time steps without an error estimate, e.g. the first ones of a
+ * multistep method, are accepted and the time step size is kept.
+ *
+ * A time step whose nonlinear solution failed is repeated with the time step
+ * size reduced by \f$f_{\min}\f$, see rejectNonlinearSolverFailure().
+ */
+class ErrorControlledTimeStepping final : public ITimeStepAlgorithm
+{
+public:
+    /**
+     * @param t_initial     start time
+     * @param t_end         end time
+     * @param min_dt        the minimum allowed time step size
+     * @param max_dt        the maximum allowed time step size
+     * @param initial_dt    initial time step size
+     * @param abstol        absolute tolerance of the local truncation error
+     * @param reltol        relative tolerance of the local truncation error
+     * @param norm_type     norm in which the errors are measured
+     * @param safety_factor the factor \f$s\f$ applied to the optimal time
+     *                      step size
+     * @param min_factor    the minimum factor \f$f_{\min}\f$ by which the time
+     *                      step size is changed
+     * @param max_factor    the maximum factor \f$f_{\max}\f$ by which the time
+     *                      step size is changed
+     */
+    ErrorControlledTimeStepping(double t_initial, double t_end, double min_dt,
+                                double max_dt, double initial_dt,
+                                double abstol, double reltol,
+                                MathLib::VecNormType norm_type,
+                                double safety_factor = 0.9,
+                                double min_factor = 0.2,
+                                double max_factor = 5.0);
+
+    /// Creates an instance from the given configuration.
+    static std::unique_ptr<ITimeStepAlgorithm> newInstance(
+        BaseLib::ConfigTree const& config);
+
+    /// return the beginning of time steps
+    double begin() const override { return _t_initial; }
+    /// return the end of time steps
+    double end() const override { return _t_end; }
+    /// return current time step
+    const TimeStep getTimeStep() const override { return _ts_current; }
+
+    /// move to the next time step
+    bool next() override;
+
+    /// return if the current step is accepted
+    bool accepted() const override;
+
+    /// return a history of time step sizes
+    const std::vector<double>& getTimeStepSizeHistory() const override
+    {
+        return _dt_vector;
+    }
+
+    /// The norm in which the error estimates have to be measured.
+    MathLib::VecNormType getNormType() const { return _norm_type; }
+
+    /// Adds the error estimate of one process for the current time step.
+    ///
+    /// \param error_norm    norm of the local truncation error estimate
+    /// \param solution_norm norm of the new solution
+    /// \param order         order of the time discretization
+    void addErrorEstimate(double error_norm, double solution_norm,
+                          unsigned order);
+
+    /// Rejects the current time step because the nonlinear solver did not
+    /// converge. The next call of next() repeats the time step with the size
+    /// reduced by the minimum factor.
+    ///
+    /// \return false if the current time step size is the minimum allowed
+    /// one, i.e. the time step cannot be repeated with a smaller size. The
+    /// time step is not rejected then.
+    bool rejectNonlinearSolverFailure();
+
+    /// return the number of repeated steps
+    std::size_t getNumberOfRepeatedSteps() const { return _n_rejected_steps; }
+
+private:
+    /// calculate the next time step size
+    double getNextTimeStepSize() const;
+
+    const double _t_initial;
+    const double _t_end;
+    const double _min_dt;
+    const double _max_dt;
+    const double _initial_dt;
+    const double _abstol;
+    const double _reltol;
+    const MathLib::VecNormType _norm_type;
+    const double _safety_factor;
+    const double _min_factor;
+    const double _max_factor;
+
+    /// largest scaled error of the current time step, negative if none
+    double _scaled_error = -1.0;
+    /// order belonging to \c _scaled_error
+    unsigned _order = 1;
+    /// set if the nonlinear solver failed in the current time step
+    bool _nonlinear_solver_failed = false;
+
+    /// size of the current time step, which is not subject to the round-off
+    /// errors of TimeStep::dt()
+    double _dt = 0.0;
+    /// previous time step
+    TimeStep _ts_pre;
+    /// current time step
+    TimeStep _ts_current;
+    /// history of time step sizes
+    std::vector<double> _dt_vector;
+    /// the number of rejected steps
+    std::size_t _n_rejected_steps = 0;
+};
+
+}  // namespace NumLib
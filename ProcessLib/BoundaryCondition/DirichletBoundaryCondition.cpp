@@ -16,36 +16,21 @@
 
 namespace ProcessLib
 {
-void DirichletBoundaryCondition::preTimestep(const double /*t*/)
-{
-    if (_parameter.isTimeDependent())
-        _already_computed = false;
-}
-
-void DirichletBoundaryCondition::getEssentialBCValues(
-    const double t, NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
+DirichletBoundaryCondition::DirichletBoundaryCondition(
+    Parameter<double> const& parameter,
+    std::vector<std::size_t>&& mesh_node_ids,
+    NumLib::LocalToGlobalIndexMap const& dof_table, std::size_t const mesh_id,
+    int const variable_id, int const component_id)
+    : _parameter(parameter)
 {
-    // TODO: Reenable when fixed ;)
-    //if (_already_computed)
-        //return;
-
-    _already_computed = true;
-
-    SpatialPosition pos;
-
-    bc_values.ids.clear();
-    bc_values.values.clear();
-
     // convert mesh node ids to global index for the given component
-    bc_values.ids.reserve(bc_values.ids.size() + _mesh_node_ids.size());
-    bc_values.values.reserve(bc_values.values.size() + _mesh_node_ids.size());
-    for (auto const id : _mesh_node_ids)
+    _mesh_node_ids.reserve(mesh_node_ids.size());
+    _global_ids.reserve(mesh_node_ids.size());
+    for (auto const id : mesh_node_ids)
     {
-        pos.setNodeID(id);
-        MeshLib::Location l(_mesh_id, MeshLib::MeshItemType::Node, id);
-        // TODO: that might be slow, but only done once
+        MeshLib::Location l(mesh_id, MeshLib::MeshItemType::Node, id);
         const auto g_idx =
-            _dof_table.getGlobalIndex(l, _variable_id, _component_id);
+            dof_table.getGlobalIndex(l, variable_id, component_id);
         if (g_idx == NumLib::MeshComponentMap::nop)
             continue;
         // For the DDC approach (e.g. with PETSc option), the negative
@@ -54,11 +39,45 @@ void DirichletBoundaryCondition::getEssentialBCValues(
         // and MatZeroRowsColumns, which are called to apply the Dirichlet BC,
         // the negative index is not accepted like other matrix or vector
         // PETSc routines. Therefore, the following if-condition is applied.
-        if (g_idx >= 0) {
-            bc_values.ids.emplace_back(g_idx);
-            bc_values.values.emplace_back(_parameter(t, pos).front());
+        if (g_idx >= 0)
+        {
+            _mesh_node_ids.push_back(id);
+            _global_ids.push_back(g_idx);
+        }
+    }
+}
+
+void DirichletBoundaryCondition::preTimestep(const double /*t*/)
+{
+    if (_parameter.isTimeDependent())
+        _already_computed = false;
+}
+
+void DirichletBoundaryCondition::getEssentialBCValues(
+    const double t, NumLib::IndexValueVector<GlobalIndexType>& bc_values) const
+{
+    if (!_already_computed ||
+        (_parameter.isTimeDependent() && t != _values_time))
+    {
+        _values.resize(_mesh_node_ids.size() *
+                       _parameter.getNumberOfComponents());
+        _parameter.evaluateAtNodes(t, _mesh_node_ids, _values.data());
+        // Only the first component is used.
+        auto const num_comp = _parameter.getNumberOfComponents();
+        if (num_comp > 1)
+        {
+            for (std::size_t i = 0; i < _mesh_node_ids.size(); ++i)
+                _values[i] = _values[i * num_comp];
+            _values.resize(_mesh_node_ids.size());
         }
+        _values_time = t;
+        _already_computed = true;
     }
+
+    // The storage might have been modified by the caller, hence it is always
+    // refilled; this is a plain copy without index lookups.
+    bc_values.ids.assign(_global_ids.begin(), _global_ids.end());
+    bc_values.values.assign(_values.begin(), _values.end());
 }
 
 std::unique_ptr<DirichletBoundaryCondition> createDirichletBoundaryCondition(
@@ -21,6 +21,11 @@ namespace ProcessLib
 /// and time Dirichlet boundary condition.
 /// The expected parameter in the passed configuration is "value" which, when
 /// not present defaults to zero.
+///
+/// The global indices of the constrained nodes are computed once on
+/// construction. The values are evaluated on the first request and again
+/// only if the parameter is time-dependent and the time has changed, i.e.
+/// once per time step and not in every nonlinear iteration.
 class DirichletBoundaryCondition final : public BoundaryCondition
 {
 public:
@@ -28,15 +33,7 @@ public:
                                std::vector<std::size_t>&& mesh_node_ids,
                                NumLib::LocalToGlobalIndexMap const& dof_table,
                                std::size_t const mesh_id, int const variable_id,
-                               int const component_id)
-        : _parameter(parameter),
-          _mesh_node_ids(std::move(mesh_node_ids)),
-          _dof_table(dof_table),
-          _mesh_id(mesh_id),
-          _variable_id(variable_id),
-          _component_id(component_id)
-    {
-    }
+                               int const component_id);
 
     void preTimestep(const double t) override;
 
@@ -47,11 +44,14 @@ public:
 private:
     Parameter<double> const& _parameter;
 
+    /// Mesh nodes with a non-ghost global index for the BC's component.
     std::vector<std::size_t> _mesh_node_ids;
-    NumLib::LocalToGlobalIndexMap const& _dof_table;
-    std::size_t const _mesh_id;
-    int const _variable_id;
-    int const _component_id;
+    /// Global indices of the nodes in _mesh_node_ids.
+    std::vector<GlobalIndexType> _global_ids;
+
+    /// Parameter values at the nodes in _mesh_node_ids.
+    mutable std::vector<double> _values;
+    mutable double _values_time = 0;
     mutable bool _already_computed = false;
 };
 
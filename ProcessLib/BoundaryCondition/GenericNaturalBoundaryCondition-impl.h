@@ -7,6 +7,8 @@
  *
  */
 
+#include <algorithm>
+
 #include "GenericNaturalBoundaryCondition.h"
 #include "ProcessLib/Utils/CreateLocalAssemblers.h"
 #include "MeshLib/MeshSearch/NodeSearch.h"
@@ -14,6 +16,35 @@
 
 namespace ProcessLib
 {
+namespace detail
+{
+/// Checks whether the boundary element is a face or an edge of a bulk element
+/// having degrees of freedom in the bulk DOF table. Boundary elements of
+/// inactive bulk elements only, see Process::setElementStatus(), would get
+/// incomplete index lines in the boundary DOF table.
+inline bool isBoundaryOfActiveBulkElement(
+    MeshLib::Element const& boundary_element,
+    NumLib::LocalToGlobalIndexMap const& dof_table_bulk)
+{
+    auto const* const nodes = boundary_element.getNodes();
+    auto const n_nodes = boundary_element.getNumberOfNodes();
+    for (auto const* const bulk_element : nodes[0]->getElements())
+    {
+        auto const bulk_id = bulk_element->getID();
+        if (bulk_id >= dof_table_bulk.size() ||
+            dof_table_bulk.getNumberOfElementDOF(bulk_id) == 0)
+            continue;
+        if (std::all_of(nodes, nodes + n_nodes,
+                        [&](MeshLib::Node const* const node) {
+                            return bulk_element->getNodeIDinElement(node) <
+                                   bulk_element->getNumberOfNodes();
+                        }))
+            return true;
+    }
+    return false;
+}
+}  // namespace detail
+
 template <typename BoundaryConditionData,
           template <typename, typename, unsigned>
           class LocalAssemblerImplementation>
@@ -38,6 +69,24 @@ GenericNaturalBoundaryCondition<BoundaryConditionData,
     assert(component_id <
            static_cast<int>(dof_table_bulk.getNumberOfComponents()));
 
+    auto const active_end = std::partition(
+        _elements.begin(), _elements.end(),
+        [&](MeshLib::Element const* const e) {
+            return detail::isBoundaryOfActiveBulkElement(*e, dof_table_bulk);
+        });
+    if (active_end != _elements.end())
+    {
+        INFO(
+            "Natural BC for the variable %d and component %d: skipping %lu "
+            "boundary elements of inactive bulk elements.",
+            variable_id, component_id,
+            static_cast<unsigned long>(
+                std::distance(active_end, _elements.end())));
+        std::for_each(active_end, _elements.end(),
+                      [](MeshLib::Element* const e) { delete e; });
+        _elements.erase(active_end, _elements.end());
+    }
+
     std::vector<MeshLib::Node*> nodes = MeshLib::getUniqueNodes(_elements);
     DBUG("Found %d nodes for Natural BCs for the variable %d and component %d",
          nodes.size(), variable_id, component_id);
@@ -92,7 +92,11 @@ public:
           _integration_method(integration_order),
           _darcy_velocities(
               GlobalDim,
-              std::vector<double>(_integration_method.getNumberOfPoints()))
+              std::vector<double>(_integration_method.getNumberOfPoints())),
+          _vars(_integration_method.getNumberOfPoints(),
+                MaterialLib::Fluid::FluidProperty::ArrayType{}),
+          _densities(_integration_method.getNumberOfPoints()),
+          _viscosities(_integration_method.getNumberOfPoints())
     {
         // This assertion is valid only if all nodal d.o.f. use the same shape
         // matrices.
@@ -147,7 +151,24 @@ public:
 
         auto const& b = _process_data.specific_body_force;
 
-        MaterialLib::Fluid::FluidProperty::ArrayType vars;
+        // Evaluate the fluid properties for all integration points at once.
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            // Order matters: First C, then p!
+            NumLib::shapeFunctionInterpolate(
+                local_x, _ip_data[ip].N,
+                _vars[ip][static_cast<int>(
+                    MaterialLib::Fluid::PropertyVariableType::C)],
+                _vars[ip][static_cast<int>(
+                    MaterialLib::Fluid::PropertyVariableType::p)]);
+        }
+        // Use the fluid density model to compute the density
+        _process_data.fluid_properties->getValues(
+            MaterialLib::Fluid::FluidPropertyType::Density, _vars, _densities);
+        // Use the viscosity model to compute the viscosity
+        _process_data.fluid_properties->getValues(
+            MaterialLib::Fluid::FluidPropertyType::Viscosity, _vars,
+            _viscosities);
 
         GlobalDimMatrixType const& I(
             GlobalDimMatrixType::Identity(GlobalDim, GlobalDim));
@@ -175,10 +196,8 @@ public:
             auto const& dNdx = ip_data.dNdx;
             auto const& w = ip_data.integration_weight;
 
-            double C_int_pt = 0.0;
-            double p_int_pt = 0.0;
-            // Order matters: First C, then p!
-            NumLib::shapeFunctionInterpolate(local_x, N, C_int_pt, p_int_pt);
+            double const C_int_pt = _vars[ip][static_cast<int>(
+                MaterialLib::Fluid::PropertyVariableType::C)];
 
             // \todo the first argument has to be changed for non constant
             // porosity model
@@ -189,28 +208,20 @@ public:
             auto const retardation_factor =
                 _process_data.retardation_factor(t, pos)[0];
 
-            auto const& solute_dispersivity_transverse =
+            auto const solute_dispersivity_transverse =
                 _process_data.solute_dispersivity_transverse(t, pos)[0];
-            auto const& solute_dispersivity_longitudinal =
+            auto const solute_dispersivity_longitudinal =
                 _process_data.solute_dispersivity_longitudinal(t, pos)[0];
 
-            // Use the fluid density model to compute the density
-            vars[static_cast<int>(
-                MaterialLib::Fluid::PropertyVariableType::C)] = C_int_pt;
-            vars[static_cast<int>(
-                MaterialLib::Fluid::PropertyVariableType::p)] = p_int_pt;
-            auto const density = _process_data.fluid_properties->getValue(
-                MaterialLib::Fluid::FluidPropertyType::Density, vars);
-            auto const& decay_rate = _process_data.decay_rate(t, pos)[0];
-            auto const& molecular_diffusion_coefficient =
+            auto const density = _densities[ip];
+            auto const decay_rate = _process_data.decay_rate(t, pos)[0];
+            auto const molecular_diffusion_coefficient =
                 _process_data.molecular_diffusion_coefficient(t, pos)[0];
 
             auto const& K =
                 _process_data.porous_media_properties.getIntrinsicPermeability(
                     t, pos);
-            // Use the viscosity model to compute the viscosity
-            auto const mu = _process_data.fluid_properties->getValue(
-                MaterialLib::Fluid::FluidPropertyType::Viscosity, vars);
+            auto const mu = _viscosities[ip];
 
             GlobalDimMatrixType const K_over_mu = K / mu;
 
@@ -351,6 +362,11 @@ private:
             IntegrationPointData<NodalRowVectorType, GlobalDimNodalMatrixType>>>
         _ip_data;
     std::vector<std::vector<double>> _darcy_velocities;
+
+    // Scratch space of assemble(), kept to avoid allocations per call.
+    std::vector<MaterialLib::Fluid::FluidProperty::ArrayType> _vars;
+    std::vector<double> _densities;
+    std::vector<double> _viscosities;
 };
 
 }  // namespace ComponentTransport
@@ -51,6 +51,10 @@ public:
                                 MathLib::Point3d const& p,
                                 GlobalVector const& x) const override
     {
+        // Inactive elements have no local assembler and do not contribute.
+        if (!_local_assemblers[element_id])
+            return std::vector<double>(3, 0.0);
+
         // fetch local_x from primary variable
         std::vector<GlobalIndexType> indices_cache;
         auto const r_c_indices = NumLib::getRowColumnIndices(
@@ -93,7 +93,13 @@ public:
           _integration_method(integration_order),
           _darcy_velocities(
               GlobalDim,
-              std::vector<double>(_integration_method.getNumberOfPoints()))
+              std::vector<double>(_integration_method.getNumberOfPoints())),
+          _vars(_integration_method.getNumberOfPoints(),
+                MaterialLib::Fluid::FluidProperty::ArrayType{}),
+          _specific_heat_capacities_fluid(
+              _integration_method.getNumberOfPoints()),
+          _densities(_integration_method.getNumberOfPoints()),
+          _viscosities(_integration_method.getNumberOfPoints())
     {
         // This assertion is valid only if all nodal d.o.f. use the same shape
         // matrices.
@@ -157,11 +163,31 @@ public:
         GlobalDimMatrixType const& I(
             GlobalDimMatrixType::Identity(GlobalDim, GlobalDim));
 
-        MaterialLib::Fluid::FluidProperty::ArrayType vars;
-
         unsigned const n_integration_points =
             _integration_method.getNumberOfPoints();
 
+        // Evaluate the fluid properties for all integration points at once.
+        for (unsigned ip = 0; ip < n_integration_points; ip++)
+        {
+            // Order matters: First T, then P!
+            NumLib::shapeFunctionInterpolate(
+                local_x, _ip_data[ip].N,
+                _vars[ip][static_cast<int>(
+                    MaterialLib::Fluid::PropertyVariableType::T)],
+                _vars[ip][static_cast<int>(
+                    MaterialLib::Fluid::PropertyVariableType::p)]);
+        }
+        _process_data.fluid_properties->getValues(
+            MaterialLib::Fluid::FluidPropertyType::HeatCapacity, _vars,
+            _specific_heat_capacities_fluid);
+        // Use the fluid density model to compute the density
+        _process_data.fluid_properties->getValues(
+            MaterialLib::Fluid::FluidPropertyType::Density, _vars, _densities);
+        // Use the viscosity model to compute the viscosity
+        _process_data.fluid_properties->getValues(
+            MaterialLib::Fluid::FluidPropertyType::Viscosity, _vars,
+            _viscosities);
+
         for (std::size_t ip(0); ip < n_integration_points; ip++)
         {
             pos.setIntegrationPoint(ip);
@@ -189,10 +215,8 @@ public:
             auto const& dNdx = ip_data.dNdx;
             auto const& w = ip_data.integration_weight;
 
-            double T_int_pt = 0.0;
-            double p_int_pt = 0.0;
-            // Order matters: First T, then P!
-            NumLib::shapeFunctionInterpolate(local_x, N, T_int_pt, p_int_pt);
+            double const T_int_pt = _vars[ip][static_cast<int>(
+                MaterialLib::Fluid::PropertyVariableType::T)];
 
             // \todo the first argument has to be changed for non constant
             // porosity model
@@ -207,26 +231,16 @@ public:
             auto const specific_heat_capacity_solid =
                 _process_data.specific_heat_capacity_solid(t, pos)[0];
 
-            vars[static_cast<int>(
-                MaterialLib::Fluid::PropertyVariableType::T)] = T_int_pt;
-            vars[static_cast<int>(
-                MaterialLib::Fluid::PropertyVariableType::p)] = p_int_pt;
             auto const specific_heat_capacity_fluid =
-                _process_data.fluid_properties->getValue(
-                    MaterialLib::Fluid::FluidPropertyType::HeatCapacity, vars);
+                _specific_heat_capacities_fluid[ip];
 
             auto const thermal_dispersivity_longitudinal =
                 _process_data.thermal_dispersivity_longitudinal(t, pos)[0];
             auto const thermal_dispersivity_transversal =
                 _process_data.thermal_dispersivity_transversal(t, pos)[0];
 
-            // Use the fluid density model to compute the density
-            auto const density = _process_data.fluid_properties->getValue(
-                MaterialLib::Fluid::FluidPropertyType::Density, vars);
-
-            // Use the viscosity model to compute the viscosity
-            auto const viscosity = _process_data.fluid_properties->getValue(
-                MaterialLib::Fluid::FluidPropertyType::Viscosity, vars);
+            auto const density = _densities[ip];
+            auto const viscosity = _viscosities[ip];
             GlobalDimMatrixType K_over_mu = intrinsic_permeability / viscosity;
 
             GlobalDimVectorType const velocity =
@@ -356,6 +370,12 @@ private:
             IntegrationPointData<NodalRowVectorType, GlobalDimNodalMatrixType>>>
         _ip_data;
     std::vector<std::vector<double>> _darcy_velocities;
+
+    // Scratch space of assemble(), kept to avoid allocations per call.
+    std::vector<MaterialLib::Fluid::FluidProperty::ArrayType> _vars;
+    std::vector<double> _specific_heat_capacities_fluid;
+    std::vector<double> _densities;
+    std::vector<double> _viscosities;
 };
 
 }  // namespace HT
@@ -15,6 +15,7 @@
 #include "MaterialLib/SolidModels/KelvinVector.h"
 #include "MaterialLib/SolidModels/LinearElasticIsotropic.h"
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
+#include "NumLib/Fem/ReferenceElementShapeData.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "ProcessLib/Deformation/BMatrixPolicy.h"
 #include "ProcessLib/Deformation/LinearBMatrix.h"
@@ -30,7 +31,7 @@ namespace ProcessLib
 namespace HydroMechanics
 {
 template <typename BMatricesType, typename ShapeMatrixTypeDisplacement,
-          typename ShapeMatricesTypePressure, int DisplacementDim, int NPoints>
+          typename ShapeMatricesTypePressure, int DisplacementDim>
 struct IntegrationPointData final
 {
     explicit IntegrationPointData(
@@ -41,16 +42,10 @@ struct IntegrationPointData final
     {
     }
 
-    typename ShapeMatrixTypeDisplacement::template MatrixType<
-        DisplacementDim, NPoints * DisplacementDim>
-        N_u_op;
     typename BMatricesType::KelvinVectorType sigma_eff, sigma_eff_prev;
     typename BMatricesType::KelvinVectorType eps, eps_prev;
 
-    typename ShapeMatrixTypeDisplacement::NodalRowVectorType N_u;
     typename ShapeMatrixTypeDisplacement::GlobalDimNodalMatrixType dNdx_u;
-
-    typename ShapeMatricesTypePressure::NodalRowVectorType N_p;
     typename ShapeMatricesTypePressure::GlobalDimNodalMatrixType dNdx_p;
 
     MaterialLib::Solids::MechanicsBase<DisplacementDim>& solid_material;
@@ -89,14 +84,6 @@ struct IntegrationPointData final
     EIGEN_MAKE_ALIGNED_OPERATOR_NEW;
 };
 
-/// Used by for extrapolation of the integration point values. It is ordered
-/// (and stored) by integration points.
-template <typename ShapeMatrixType>
-struct SecondaryData
-{
-    std::vector<ShapeMatrixType, Eigen::aligned_allocator<ShapeMatrixType>> N_u;
-};
-
 struct HydroMechanicsLocalAssemblerInterface
     : public ProcessLib::LocalAssemblerInterface,
       public NumLib::ExtrapolatableElement
@@ -160,6 +147,15 @@ public:
     using ShapeMatricesTypePressure =
         ShapeMatrixPolicyType<ShapeFunctionPressure, DisplacementDim>;
 
+    using ReferenceShapeDataDisplacement =
+        NumLib::ReferenceElementShapeData<ShapeFunctionDisplacement,
+                                          ShapeMatricesTypeDisplacement,
+                                          IntegrationMethod>;
+    using ReferenceShapeDataPressure =
+        NumLib::ReferenceElementShapeData<ShapeFunctionPressure,
+                                          ShapeMatricesTypePressure,
+                                          IntegrationMethod>;
+
     HydroMechanicsLocalAssembler(HydroMechanicsLocalAssembler const&) = delete;
     HydroMechanicsLocalAssembler(HydroMechanicsLocalAssembler&&) = delete;
 
@@ -171,6 +167,10 @@ public:
         HydroMechanicsProcessData<DisplacementDim>& process_data)
         : _process_data(process_data),
           _integration_method(integration_order),
+          _reference_shape_data_u(
+              ReferenceShapeDataDisplacement::get(_integration_method)),
+          _reference_shape_data_p(
+              ReferenceShapeDataPressure::get(_integration_method)),
           _element(e),
           _is_axially_symmetric(is_axially_symmetric)
     {
@@ -178,7 +178,6 @@ public:
             _integration_method.getNumberOfPoints();
 
         _ip_data.reserve(n_integration_points);
-        _secondary_data.N_u.resize(n_integration_points);
 
         auto const shape_matrices_u =
             initShapeMatrices<ShapeFunctionDisplacement,
@@ -209,22 +208,8 @@ public:
             ip_data.eps_prev.resize(kelvin_vector_size);
             ip_data.sigma_eff_prev.resize(kelvin_vector_size);
 
-            ip_data.N_u_op = ShapeMatricesTypeDisplacement::template MatrixType<
-                DisplacementDim, displacement_size>::Zero(DisplacementDim,
-                                                          displacement_size);
-            for (int i = 0; i < DisplacementDim; ++i)
-                ip_data.N_u_op
-                    .template block<1, displacement_size / DisplacementDim>(
-                        i, i * displacement_size / DisplacementDim)
-                    .noalias() = sm_u.N;
-
-            ip_data.N_u = sm_u.N;
             ip_data.dNdx_u = sm_u.dNdx;
-
-            ip_data.N_p = shape_matrices_p[ip].N;
             ip_data.dNdx_p = shape_matrices_p[ip].dNdx;
-
-            _secondary_data.N_u[ip] = shape_matrices_u[ip].N;
         }
     }
 
@@ -305,14 +290,24 @@ public:
             x_position.setIntegrationPoint(ip);
             auto const& w = _ip_data[ip].integration_weight;
 
-            auto const& N_u_op = _ip_data[ip].N_u_op;
-
-            auto const& N_u = _ip_data[ip].N_u;
+            auto const& N_u = _reference_shape_data_u.N(ip);
             auto const& dNdx_u = _ip_data[ip].dNdx_u;
 
-            auto const& N_p = _ip_data[ip].N_p;
+            auto const& N_p = _reference_shape_data_p.N(ip);
             auto const& dNdx_p = _ip_data[ip].dNdx_p;
 
+            typename ShapeMatricesTypeDisplacement::template MatrixType<
+                DisplacementDim, displacement_size>
+                N_u_op = ShapeMatricesTypeDisplacement::template MatrixType<
+                    DisplacementDim,
+                    displacement_size>::Zero(DisplacementDim,
+                                             displacement_size);
+            for (int i = 0; i < DisplacementDim; ++i)
+                N_u_op
+                    .template block<1, displacement_size / DisplacementDim>(
+                        i, i * displacement_size / DisplacementDim)
+                    .noalias() = N_u;
+
             auto const x_coord =
                 interpolateXCoordinate<ShapeFunctionDisplacement,
                                        ShapeMatricesTypeDisplacement>(_element,
@@ -455,7 +450,7 @@ public:
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
-        auto const& N_u = _secondary_data.N_u[integration_point];
+        auto const& N_u = _reference_shape_data_u.N(integration_point);
 
         // assumes N is stored contiguously in memory
         return Eigen::Map<const Eigen::RowVectorXd>(N_u.data(), N_u.size());
@@ -597,16 +592,14 @@ private:
         BMatrixPolicyType<ShapeFunctionDisplacement, DisplacementDim>;
     using IpData =
         IntegrationPointData<BMatricesType, ShapeMatricesTypeDisplacement,
-                             ShapeMatricesTypePressure, DisplacementDim,
-                             ShapeFunctionDisplacement::NPOINTS>;
+                             ShapeMatricesTypePressure, DisplacementDim>;
     std::vector<IpData, Eigen::aligned_allocator<IpData>> _ip_data;
 
     IntegrationMethod _integration_method;
+    ReferenceShapeDataDisplacement const& _reference_shape_data_u;
+    ReferenceShapeDataPressure const& _reference_shape_data_p;
     MeshLib::Element const& _element;
     bool const _is_axially_symmetric;
-    SecondaryData<
-        typename ShapeMatricesTypeDisplacement::ShapeMatrices::ShapeType>
-        _secondary_data;
 
     std::vector<std::vector<double>> _darcy_velocities =
         std::vector<std::vector<double>>(
@@ -60,6 +60,9 @@ void LocalAssemblerInterface::computeSecondaryVariable(
                               StaggeredCouplingTerm const& coupled_term)
 {
     auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    // Inactive elements have no degrees of freedom.
+    if (indices.empty())
+        return;
     auto const local_x = x.get(indices);
 
     if (coupled_term.empty)
@@ -82,6 +85,9 @@ void LocalAssemblerInterface::preTimestep(
     double const t, double const delta_t)
 {
     auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    // Inactive elements have no degrees of freedom.
+    if (indices.empty())
+        return;
     auto const local_x = x.get(indices);
 
     preTimestepConcrete(local_x, t, delta_t);
@@ -93,6 +99,9 @@ void LocalAssemblerInterface::postTimestep(
     GlobalVector const& x)
 {
     auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    // Inactive elements have no degrees of freedom.
+    if (indices.empty())
+        return;
     auto const local_x = x.get(indices);
 
     postTimestepConcrete(local_x);
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
 
 #include "Parameter.h"
@@ -40,10 +41,29 @@ struct ConstantParameter final : public Parameter<T>
         return static_cast<unsigned>(_values.size());
     }
 
-    std::vector<T> const& operator()(
-        double const /*t*/, SpatialPosition const& /*pos*/) const override
+    void evaluate(double const /*t*/, SpatialPosition const& /*pos*/,
+                  T* const values) const override
     {
-        return _values;
+        std::copy(_values.begin(), _values.end(), values);
+    }
+
+    void evaluateAtIntegrationPoints(double const /*t*/,
+                                     std::size_t const /*element_id*/,
+                                     unsigned const n_integration_points,
+                                     T* const values) const override
+    {
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+            std::copy(_values.begin(), _values.end(),
+                      values + ip * _values.size());
+    }
+
+    void evaluateAtNodes(double const /*t*/,
+                         std::vector<std::size_t> const& node_ids,
+                         T* const values) const override
+    {
+        for (std::size_t i = 0; i < node_ids.size(); ++i)
+            std::copy(_values.begin(), _values.end(),
+                      values + i * _values.size());
     }
 
 private:
@@ -35,7 +35,6 @@ struct CurveScaledParameter final : public Parameter<T> {
     {
         _parameter =
             &findParameter<T>(_referenced_parameter_name, parameters, 0);
-        _cache.resize(_parameter->getNumberOfComponents());
     }
 
     unsigned getNumberOfComponents() const override
@@ -43,23 +42,43 @@ struct CurveScaledParameter final : public Parameter<T> {
         return _parameter->getNumberOfComponents();
     }
 
-    std::vector<T> const& operator()(double const t,
-                                     SpatialPosition const& pos) const override
+    void evaluate(double const t, SpatialPosition const& pos,
+                  T* const values) const override
     {
-        auto const& tup = (*_parameter)(t, pos);
-        auto const scaling = _curve.getValue(t);
+        _parameter->evaluate(t, pos, values);
+        scale(t, _parameter->getNumberOfComponents(), values);
+    }
+
+    void evaluateAtIntegrationPoints(double const t,
+                                     std::size_t const element_id,
+                                     unsigned const n_integration_points,
+                                     T* const values) const override
+    {
+        _parameter->evaluateAtIntegrationPoints(t, element_id,
+                                                n_integration_points, values);
+        scale(t, n_integration_points * _parameter->getNumberOfComponents(),
+              values);
+    }
 
-        auto const num_comp = _parameter->getNumberOfComponents();
-        for (std::size_t c = 0; c < num_comp; ++c) {
-            _cache[c] = scaling * tup[c];
-        }
-        return _cache;
+    void evaluateAtNodes(double const t,
+                         std::vector<std::size_t> const& node_ids,
+                         T* const values) const override
+    {
+        _parameter->evaluateAtNodes(t, node_ids, values);
+        scale(t, node_ids.size() * _parameter->getNumberOfComponents(),
+              values);
     }
 
 private:
+    void scale(double const t, std::size_t const n, T* const values) const
+    {
+        auto const scaling = _curve.getValue(t);
+        for (std::size_t i = 0; i < n; ++i)
+            values[i] *= scaling;
+    }
+
     MathLib::PiecewiseLinearInterpolation const& _curve;
-    Parameter<double> const* _parameter;
-    mutable std::vector<double> _cache;
+    Parameter<T> const* _parameter;
     std::string const _referenced_parameter_name;
 };
 
@@ -9,6 +9,7 @@
 
 #pragma once
 
+#include <algorithm>
 #include <utility>
 
 #include "BaseLib/Error.h"
@@ -56,19 +57,44 @@ struct GroupBasedParameter final
         return _vec_values.empty() ? 0 : _vec_values.front().size();
     }
 
-    std::vector<T> const& operator()(double const /*t*/,
-                                     SpatialPosition const& pos) const override
+    void evaluate(double const /*t*/, SpatialPosition const& pos,
+                  T* const values) const override
     {
         auto const item_id = getMeshItemID(pos, type<MeshItemType>());
         assert(item_id);
-        int const index = _property_index[item_id.get()];
+        auto const& group_values = getGroupValues(item_id.get());
+        std::copy(group_values.begin(), group_values.end(), values);
+    }
+
+    void evaluateAtIntegrationPoints(double const t,
+                                     std::size_t const element_id,
+                                     unsigned const n_integration_points,
+                                     T* const values) const override
+    {
+        if (MeshItemType != MeshLib::MeshItemType::Cell)
+        {
+            Parameter<T>::evaluateAtIntegrationPoints(
+                t, element_id, n_integration_points, values);
+            return;
+        }
+
+        // The value is constant on each element.
+        auto const& group_values = getGroupValues(element_id);
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+            std::copy(group_values.begin(), group_values.end(),
+                      values + ip * group_values.size());
+    }
+
+private:
+    std::vector<T> const& getGroupValues(std::size_t const item_id) const
+    {
+        int const index = _property_index[item_id];
         auto const& values = _vec_values[index];
         if (values.empty())
             OGS_FATAL("No data found for the group index %d", index);
-         return values;
+        return values;
     }
 
-private:
     template <MeshLib::MeshItemType ITEM_TYPE> struct type {};
 
     static boost::optional<std::size_t>
@@ -25,8 +25,7 @@ struct MeshElementParameter final : public Parameter<T> {
     MeshElementParameter(std::string const& name_,
                          MeshLib::PropertyVector<T> const& property)
         : Parameter<T>(name_),
-          _property(property),
-          _cache(_property.getNumberOfComponents())
+          _property(property)
     {
     }
 
@@ -37,21 +36,32 @@ struct MeshElementParameter final : public Parameter<T> {
         return _property.getNumberOfComponents();
     }
 
-    std::vector<T> const& operator()(double const /*t*/,
-                                     SpatialPosition const& pos) const override
+    void evaluate(double const /*t*/, SpatialPosition const& pos,
+                  T* const values) const override
     {
         auto const e = pos.getElementID();
         assert(e);
         auto const num_comp = _property.getNumberOfComponents();
         for (std::size_t c=0; c<num_comp; ++c) {
-            _cache[c] = _property.getComponent(*e, c);
+            values[c] = _property.getComponent(*e, c);
         }
-        return _cache;
+    }
+
+    void evaluateAtIntegrationPoints(double const /*t*/,
+                                     std::size_t const element_id,
+                                     unsigned const n_integration_points,
+                                     T* const values) const override
+    {
+        // The value is constant on each element.
+        auto const num_comp = _property.getNumberOfComponents();
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+            for (std::size_t c = 0; c < num_comp; ++c)
+                values[ip * num_comp + c] =
+                    _property.getComponent(element_id, c);
     }
 
 private:
     MeshLib::PropertyVector<T> const& _property;
-    mutable std::vector<double> _cache;
 };
 
 std::unique_ptr<ParameterBase> createMeshElementParameter(
@@ -25,8 +25,7 @@ struct MeshNodeParameter final : public Parameter<T> {
     MeshNodeParameter(std::string const& name_,
                       MeshLib::PropertyVector<T> const& property)
         : Parameter<T>(name_),
-          _property(property),
-          _cache(_property.getNumberOfComponents())
+          _property(property)
     {
     }
 
@@ -37,21 +36,30 @@ struct MeshNodeParameter final : public Parameter<T> {
         return _property.getNumberOfComponents();
     }
 
-    std::vector<T> const& operator()(double const /*t*/,
-                                     SpatialPosition const& pos) const override
+    void evaluate(double const /*t*/, SpatialPosition const& pos,
+                  T* const values) const override
     {
         auto const n = pos.getNodeID();
         assert(n);
         auto const num_comp = _property.getNumberOfComponents();
         for (std::size_t c=0; c<num_comp; ++c) {
-            _cache[c] = _property.getComponent(*n, c);
+            values[c] = _property.getComponent(*n, c);
         }
-        return _cache;
+    }
+
+    void evaluateAtNodes(double const /*t*/,
+                         std::vector<std::size_t> const& node_ids,
+                         T* const values) const override
+    {
+        auto const num_comp = _property.getNumberOfComponents();
+        for (std::size_t i = 0; i < node_ids.size(); ++i)
+            for (std::size_t c = 0; c < num_comp; ++c)
+                values[i * num_comp + c] =
+                    _property.getComponent(node_ids[i], c);
     }
 
 private:
     MeshLib::PropertyVector<T> const& _property;
-    mutable std::vector<double> _cache;
 };
 
 std::unique_ptr<ParameterBase> createMeshNodeParameter(
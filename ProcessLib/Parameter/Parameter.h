@@ -13,6 +13,7 @@
 #include <memory>
 #include <utility>
 #include <vector>
+#include "ParameterValue.h"
 #include "SpatialPosition.h"
 
 namespace BaseLib
@@ -69,9 +70,64 @@ struct Parameter : public ParameterBase
     //! point in time.
     virtual unsigned getNumberOfComponents() const = 0;
 
+    //! Writes the parameter value at the given time and position to
+    //! \c values, which must provide storage for getNumberOfComponents()
+    //! entries.
+    //!
+    //! Implementations must not modify the parameter, such that parameters can
+    //! be evaluated concurrently.
+    virtual void evaluate(double const t, SpatialPosition const& pos,
+                          T* const values) const = 0;
+
+    //! Writes the parameter values at all integration points of the given
+    //! element to \c values, which must provide storage for
+    //! <tt>n_integration_points * getNumberOfComponents()</tt> entries. The
+    //! components of one integration point are stored contiguously.
+    //!
+    //! The default implementation evaluates the parameter at each integration
+    //! point. Parameters which are constant on an element override it.
+    virtual void evaluateAtIntegrationPoints(double const t,
+                                             std::size_t const element_id,
+                                             unsigned const n_integration_points,
+                                             T* const values) const
+    {
+        auto const num_comp = getNumberOfComponents();
+        SpatialPosition pos;
+        pos.setElementID(element_id);
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            pos.setIntegrationPoint(ip);
+            evaluate(t, pos, values + ip * num_comp);
+        }
+    }
+
+    //! Writes the parameter values at the given mesh nodes to \c values,
+    //! which must provide storage for
+    //! <tt>node_ids.size() * getNumberOfComponents()</tt> entries. The
+    //! components of one node are stored contiguously.
+    //!
+    //! The default implementation evaluates the parameter at each node.
+    virtual void evaluateAtNodes(double const t,
+                                 std::vector<std::size_t> const& node_ids,
+                                 T* const values) const
+    {
+        auto const num_comp = getNumberOfComponents();
+        SpatialPosition pos;
+        for (std::size_t i = 0; i < node_ids.size(); ++i)
+        {
+            pos.setNodeID(node_ids[i]);
+            evaluate(t, pos, values + i * num_comp);
+        }
+    }
+
     //! Returns the parameter value at the given time and position.
-    virtual std::vector<T> const& operator()(
-        double const t, SpatialPosition const& pos) const = 0;
+    ParameterValue<T> operator()(double const t,
+                                 SpatialPosition const& pos) const
+    {
+        ParameterValue<T> value(getNumberOfComponents());
+        evaluate(t, pos, value.data());
+        return value;
+    }
 };
 
 //! Constructs a new ParameterBase from the given configuration.
@@ -0,0 +1,74 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <vector>
+
+namespace ProcessLib
+{
+/// The value of a Parameter at a single point in time and space.
+///
+/// Up to \c InlineCapacity components, which covers scalars, vectors and
+/// second order tensors in three dimensions, are stored in place. Only values
+/// with more components allocate memory.
+template <typename T>
+class ParameterValue final
+{
+public:
+    static constexpr std::size_t InlineCapacity = 9;
+
+    explicit ParameterValue(std::size_t const size) : _size(size)
+    {
+        if (_size > InlineCapacity)
+            _heap_storage.resize(_size);
+    }
+
+    std::size_t size() const { return _size; }
+    bool empty() const { return _size == 0; }
+
+    T* data()
+    {
+        return _size > InlineCapacity ? _heap_storage.data()
+                                      : _inline_storage.data();
+    }
+    T const* data() const
+    {
+        return _size > InlineCapacity ? _heap_storage.data()
+                                      : _inline_storage.data();
+    }
+
+    T& operator[](std::size_t const i)
+    {
+        assert(i < _size);
+        return data()[i];
+    }
+    T const& operator[](std::size_t const i) const
+    {
+        assert(i < _size);
+        return data()[i];
+    }
+
+    T const& front() const { return (*this)[0]; }
+
+    T* begin() { return data(); }
+    T* end() { return data() + _size; }
+    T const* begin() const { return data(); }
+    T const* end() const { return data() + _size; }
+
+private:
+    std::size_t _size;
+    std::array<T, InlineCapacity> _inline_storage;
+    std::vector<T> _heap_storage;
+};
+
+}  // namespace ProcessLib
@@ -9,8 +9,11 @@
 
 #include "Process.h"
 
+#include <limits>
+
 #include "BaseLib/Functional.h"
 #include "NumLib/DOF/ComputeSparsityPattern.h"
+#include "NumLib/DOF/GlobalMatrixProviders.h"
 #include "NumLib/Extrapolation/LocalLinearLeastSquaresExtrapolator.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
 #include "GlobalVectorFromNamedFunction.h"
@@ -36,6 +39,23 @@ Process::Process(
 {
 }
 
+bool Process::canShareDOFTableWith(Process const& other) const
+{
+    if (!other._has_nodal_dof_table || _element_status ||
+        other._element_status || &_mesh != &other._mesh ||
+        _dof_reordering != other._dof_reordering ||
+        _process_variables.size() != other._process_variables.size())
+        return false;
+
+    for (std::size_t i = 0; i < _process_variables.size(); ++i)
+    {
+        if (_process_variables[i].get().getNumberOfComponents() !=
+            other._process_variables[i].get().getNumberOfComponents())
+            return false;
+    }
+    return true;
+}
+
 void Process::initialize()
 {
     DBUG("Initialize process.");
@@ -115,7 +135,7 @@ MathLib::MatrixSpecifications Process::getMatrixSpecifications() const
 {
     auto const& l = *_local_to_global_index_map;
     return {l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
-            &l.getGhostIndices(), &_sparsity_pattern};
+            &l.getGhostIndices(), _sparsity_pattern.get()};
 }
 
 void Process::assemble(const double t, GlobalVector const& x, GlobalMatrix& M,
@@ -146,12 +166,81 @@ void Process::assembleWithJacobian(const double t, GlobalVector const& x,
     _boundary_conditions.applyNaturalBC(t, x, K, b);
 }
 
+double Process::assembleLumped(const double t, GlobalVector const& x,
+                               GlobalVector& M_lumped, GlobalVector& r,
+                               StaggeredCouplingTerm const& coupling_term)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+
+    // No sparsity pattern is given, such that M and K only hold what natural
+    // boundary conditions add; M stays empty.
+    auto const& l = *_local_to_global_index_map;
+    MathLib::MatrixSpecifications const matrix_specification{
+        l.dofSizeWithoutGhosts(), l.dofSizeWithoutGhosts(),
+        &l.getGhostIndices(), nullptr};
+    auto& M =
+        NumLib::GlobalMatrixProvider::provider.getMatrix(matrix_specification);
+    auto& K =
+        NumLib::GlobalMatrixProvider::provider.getMatrix(matrix_specification);
+    M.setZero();
+    K.setZero();
+    MathLib::LinAlg::set(M_lumped, 0.0);
+    MathLib::LinAlg::set(r, 0.0);
+
+    _global_assembler.setLumpedMassAssembly(&M_lumped);
+    assembleConcreteProcess(t, x, M, K, r, coupling_term);
+    auto const max_eigenvalue = _global_assembler.getLumpedMaximumEigenvalue();
+    _global_assembler.setLumpedMassAssembly(nullptr);
+
+    _boundary_conditions.applyNaturalBC(t, x, K, r);
+
+    MathLib::LinAlg::finalizeAssembly(K);
+    MathLib::LinAlg::finalizeAssembly(M_lumped);
+    MathLib::LinAlg::finalizeAssembly(r);
+
+    // r = b - K x for the boundary contributions
+    auto& Kx =
+        NumLib::GlobalVectorProvider::provider.getVector(matrix_specification);
+    MathLib::LinAlg::matMult(K, x, Kx);
+    MathLib::LinAlg::axpy(r, -1.0, Kx);
+
+    NumLib::GlobalVectorProvider::provider.releaseVector(Kx);
+    NumLib::GlobalMatrixProvider::provider.releaseMatrix(K);
+    NumLib::GlobalMatrixProvider::provider.releaseMatrix(M);
+
+    // The forward Euler scheme is stable for dt <= 2 / lambda_max.
+    if (max_eigenvalue > 0)
+        return 2.0 / max_eigenvalue;
+    return std::numeric_limits<double>::infinity();
+}
+
 void Process::constructDofTable()
 {
+    _has_nodal_dof_table = true;
+
+    if (_dof_table_source)
+    {
+        DBUG("Reuse the dof mappings of another process.");
+        _mesh_subset_all_nodes = _dof_table_source->_mesh_subset_all_nodes;
+        _local_to_global_index_map =
+            _dof_table_source->_local_to_global_index_map;
+        return;
+    }
+
     // Create single component dof in every of the mesh's nodes.
     _mesh_subset_all_nodes =
         std::make_unique<MeshLib::MeshSubset>(_mesh, &_mesh.getNodes());
 
+    // With an element status the dofs are restricted to the nodes of the
+    // active elements.
+    MeshLib::MeshSubset const* mesh_subset = _mesh_subset_all_nodes.get();
+    if (_element_status)
+    {
+        _mesh_subset_active_nodes = std::make_unique<MeshLib::MeshSubset>(
+            _mesh, &_element_status->getActiveNodes());
+        mesh_subset = _mesh_subset_active_nodes.get();
+    }
+
     // Collect the mesh subsets in a vector.
     std::vector<MeshLib::MeshSubsets> all_mesh_subsets;
     for (ProcessVariable const& pv : _process_variables)
@@ -160,7 +249,7 @@ void Process::constructDofTable()
             std::back_inserter(all_mesh_subsets),
             pv.getNumberOfComponents(),
             [&]() {
-                return MeshLib::MeshSubsets{_mesh_subset_all_nodes.get()};
+                return MeshLib::MeshSubsets{mesh_subset};
             });
     }
 
@@ -169,10 +258,31 @@ void Process::constructDofTable()
     for (ProcessVariable const& pv : _process_variables)
         vec_var_n_components.push_back(pv.getNumberOfComponents());
 
+    if (!_element_status)
+    {
+        _local_to_global_index_map =
+            std::make_unique<NumLib::LocalToGlobalIndexMap>(
+                std::move(all_mesh_subsets), vec_var_n_components,
+                NumLib::ComponentOrder::BY_LOCATION,
+                NumLib::computeNodeOrdering(_mesh, _dof_reordering));
+        return;
+    }
+
+    // Inactive elements get empty lines of global indices.
+    std::vector<std::vector<MeshLib::Element*> const*> const vec_var_elements(
+        _process_variables.size(), &_element_status->getActiveElements());
     _local_to_global_index_map =
         std::make_unique<NumLib::LocalToGlobalIndexMap>(
             std::move(all_mesh_subsets), vec_var_n_components,
-            NumLib::ComponentOrder::BY_LOCATION);
+            vec_var_elements, NumLib::ComponentOrder::BY_LOCATION,
+            NumLib::computeNodeOrdering(_mesh, _dof_reordering));
+
+    INFO("%lu of %lu elements are active, %lu dofs.",
+         static_cast<unsigned long>(
+             _element_status->getNumberOfActiveElements()),
+         static_cast<unsigned long>(_mesh.getNumberOfElements()),
+         static_cast<unsigned long>(
+             _local_to_global_index_map->dofSizeWithoutGhosts()));
 }
 
 void Process::initializeExtrapolator()
@@ -180,24 +290,40 @@ void Process::initializeExtrapolator()
     NumLib::LocalToGlobalIndexMap const* dof_table_single_component;
     bool manage_storage;
 
-    if (_local_to_global_index_map->getNumberOfComponents() == 1)
+    if (_local_to_global_index_map->getNumberOfComponents() == 1 &&
+        _dof_reordering == NumLib::DOFReordering::None && !_element_status)
     {
         // For single-variable-single-component processes reuse the existing DOF
-        // table.
+        // table. A reordered DOF table cannot be reused since the output
+        // expects the extrapolated values in node order, neither can a DOF
+        // table restricted to the active elements.
         dof_table_single_component = _local_to_global_index_map.get();
         manage_storage = false;
     }
     else
     {
-        // Otherwise construct a new DOF table.
+        // Otherwise construct a new DOF table numbered by node ids.
         std::vector<MeshLib::MeshSubsets> all_mesh_subsets_single_component;
         all_mesh_subsets_single_component.emplace_back(
             _mesh_subset_all_nodes.get());
 
-        dof_table_single_component = new NumLib::LocalToGlobalIndexMap(
-            std::move(all_mesh_subsets_single_component),
-            // by location order is needed for output
-            NumLib::ComponentOrder::BY_LOCATION);
+        if (_element_status)
+        {
+            // Inactive elements get empty lines of global indices and are
+            // skipped by the extrapolator.
+            dof_table_single_component = new NumLib::LocalToGlobalIndexMap(
+                std::move(all_mesh_subsets_single_component), {1},
+                {&_element_status->getActiveElements()},
+                // by location order is needed for output
+                NumLib::ComponentOrder::BY_LOCATION);
+        }
+        else
+        {
+            dof_table_single_component = new NumLib::LocalToGlobalIndexMap(
+                std::move(all_mesh_subsets_single_component),
+                // by location order is needed for output
+                NumLib::ComponentOrder::BY_LOCATION);
+        }
         manage_storage = true;
     }
 
@@ -233,8 +359,17 @@ void Process::finishNamedFunctionsInitialization()
 
 void Process::computeSparsityPattern()
 {
-    _sparsity_pattern =
-        NumLib::computeSparsityPattern(*_local_to_global_index_map, _mesh);
+    // The sparsity pattern is shared together with the DOF table. A derived
+    // process might have ignored the DOF table source.
+    if (_dof_table_source && _local_to_global_index_map ==
+                                 _dof_table_source->_local_to_global_index_map)
+    {
+        _sparsity_pattern = _dof_table_source->_sparsity_pattern;
+        return;
+    }
+
+    _sparsity_pattern = std::make_shared<GlobalSparsityPattern const>(
+        NumLib::computeSparsityPattern(*_local_to_global_index_map, _mesh));
 }
 
 void Process::preTimestep(GlobalVector const& x, const double t,
@@ -9,6 +9,11 @@
 
 #pragma once
 
+#include <cassert>
+#include <memory>
+
+#include "MeshLib/ElementStatus.h"
+#include "NumLib/DOF/DOFReordering.h"
 #include "NumLib/ODESolver/NonlinearSolver.h"
 #include "NumLib/ODESolver/ODESystem.h"
 #include "NumLib/ODESolver/TimeDiscretization.h"
@@ -64,6 +69,55 @@ public:
 
     NumLib::IterationResult postIteration(GlobalVector const& x) final;
 
+    /// Sets the renumbering of the mesh nodes used for the global indices of
+    /// the DOF table. Has to be called before initialize(). Processes
+    /// overriding constructDofTable() ignore this setting.
+    void setDOFReordering(NumLib::DOFReordering const reordering)
+    {
+        _dof_reordering = reordering;
+    }
+
+    NumLib::DOFReordering getDOFReordering() const { return _dof_reordering; }
+
+    /// Restricts the process to the active elements of the given element
+    /// status. Inactive elements are not assembled, and nodes connected to
+    /// inactive elements only have no degrees of freedom. Has to be called
+    /// before initialize(). Processes overriding constructDofTable() ignore
+    /// this setting.
+    void setElementStatus(
+        std::unique_ptr<MeshLib::ElementStatus const>&& element_status)
+    {
+        _element_status = std::move(element_status);
+    }
+
+    /// Assembles M, K and b only at the first time step and reuses them
+    /// afterwards. This is valid only for linear processes whose parameters,
+    /// natural boundary conditions and source terms do not depend on time.
+    void setAssembleOnce(bool const assemble_once)
+    {
+        _assemble_once = assemble_once;
+    }
+
+    bool isAssemblyConstant() const override { return _assemble_once; }
+
+    /// Checks whether this process can reuse the DOF table, the mesh subset and
+    /// the sparsity pattern of the given initialized process, i.e., whether
+    /// both processes use the default node-based DOF table on the same mesh
+    /// with the same numbers of components per process variable and the same
+    /// DOF reordering. This is typically the case for staggered coupling of
+    /// processes with one scalar variable each.
+    bool canShareDOFTableWith(Process const& other) const;
+
+    /// Sets the process whose DOF table, mesh subset and sparsity pattern are
+    /// reused instead of constructing new ones. Has to be called before
+    /// initialize() and only if canShareDOFTableWith() holds. Only the global
+    /// matrices and vectors are allocated separately for each process.
+    void setDOFTableSource(Process const& other)
+    {
+        assert(canShareDOFTableWith(other));
+        _dof_table_source = &other;
+    }
+
     void initialize();
 
     void setInitialConditions(const double t, GlobalVector& x);
@@ -81,6 +135,15 @@ public:
                               GlobalMatrix& Jac,
                               StaggeredCouplingTerm const& coupling_term) final;
 
+    /// Assembles the lumped mass matrix and the residual element by element
+    /// through the regular assembleConcreteProcess(). The stable time step
+    /// size is estimated from the local matrices, i.e., from the element sizes
+    /// and material properties; contributions of natural boundary conditions
+    /// are not considered in that estimate.
+    double assembleLumped(const double t, GlobalVector const& x,
+                          GlobalVector& M_lumped, GlobalVector& r,
+                          StaggeredCouplingTerm const& coupling_term) final;
+
     std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
     getKnownSolutions(double const t) const final
     {
@@ -188,9 +251,9 @@ private:
 
 protected:
     MeshLib::Mesh& _mesh;
-    std::unique_ptr<MeshLib::MeshSubset const> _mesh_subset_all_nodes;
+    std::shared_ptr<MeshLib::MeshSubset const> _mesh_subset_all_nodes;
 
-    std::unique_ptr<NumLib::LocalToGlobalIndexMap> _local_to_global_index_map;
+    std::shared_ptr<NumLib::LocalToGlobalIndexMap> _local_to_global_index_map;
 
     SecondaryVariableCollection _secondary_variables;
 
@@ -207,7 +270,7 @@ protected:
     unsigned const _integration_order;
 
 private:
-    GlobalSparsityPattern _sparsity_pattern;
+    std::shared_ptr<GlobalSparsityPattern const> _sparsity_pattern;
 
     /// Variables used by this process.
     std::vector<std::reference_wrapper<ProcessVariable>> _process_variables;
@@ -215,6 +278,21 @@ private:
     BoundaryConditionCollection _boundary_conditions;
 
     ExtrapolatorData _extrapolator_data;
+
+    NumLib::DOFReordering _dof_reordering = NumLib::DOFReordering::None;
+
+    /// Active elements of the process; all elements are active if not set.
+    std::unique_ptr<MeshLib::ElementStatus const> _element_status;
+    std::unique_ptr<MeshLib::MeshSubset const> _mesh_subset_active_nodes;
+
+    /// Set if M, K and b are assembled only once, see setAssembleOnce().
+    bool _assemble_once = false;
+
+    /// Set if the DOF table was constructed by Process::constructDofTable().
+    bool _has_nodal_dof_table = false;
+
+    /// Process sharing its DOF table and sparsity pattern with this one.
+    Process const* _dof_table_source = nullptr;
 };
 
 }  // namespace ProcessLib
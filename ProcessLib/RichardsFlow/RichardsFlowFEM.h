@@ -166,7 +166,7 @@ public:
             pos.setIntegrationPoint(ip);
             double p_int_pt = 0.0;
             NumLib::shapeFunctionInterpolate(local_x, _ip_data[ip].N, p_int_pt);
-            const double& temperature = _process_data.temperature(t, pos)[0];
+            double const temperature = _process_data.temperature(t, pos)[0];
             auto const porosity = _process_data.material->getPorosity(
                 material_id, t, pos, p_int_pt, temperature, 0);
 
@@ -255,7 +255,7 @@ public:
             double p_int_pt = 0.0;
             NumLib::shapeFunctionInterpolate(local_x, _ip_data[ip].N, p_int_pt);
             double const pc_int_pt = -p_int_pt;
-            const double& temperature = _process_data.temperature(t, pos)[0];
+            double const temperature = _process_data.temperature(t, pos)[0];
             double const Sw = _process_data.material->getSaturation(
                 material_id, t, pos, p_int_pt, temperature, pc_int_pt);
             double const k_rel =
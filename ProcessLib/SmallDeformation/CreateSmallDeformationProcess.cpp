@@ -102,8 +102,13 @@ createSmallDeformationProcess(
             type.c_str());
     }
 
+    auto const recompute_dNdx =
+        //! \ogs_file_param{prj__processes__process__SMALL_DEFORMATION__recompute_shape_function_derivatives}
+        config.getConfigParameter<bool>("recompute_shape_function_derivatives",
+                                        false);
+
     SmallDeformationProcessData<DisplacementDim> process_data{
-        std::move(material)};
+        std::move(material), recompute_dNdx};
 
     SecondaryVariableCollection secondary_variables;
 
@@ -17,6 +17,7 @@
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "NumLib/Extrapolation/ExtrapolatableElement.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
+#include "NumLib/Fem/ReferenceElementShapeData.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "ProcessLib/Deformation/BMatrixPolicy.h"
 #include "ProcessLib/Deformation/LinearBMatrix.h"
@@ -52,8 +53,6 @@ struct IntegrationPointData final
         material_state_variables;
 
     double integration_weight;
-    typename ShapeMatricesType::NodalRowVectorType N;
-    typename ShapeMatricesType::GlobalDimNodalMatrixType dNdx;
 
     void pushBackState()
     {
@@ -63,14 +62,6 @@ struct IntegrationPointData final
     }
 };
 
-/// Used by for extrapolation of the integration point values. It is ordered
-/// (and stored) by integration points.
-template <typename ShapeMatrixType>
-struct SecondaryData
-{
-    std::vector<ShapeMatrixType, Eigen::aligned_allocator<ShapeMatrixType>> N;
-};
-
 struct SmallDeformationLocalAssemblerInterface
     : public ProcessLib::LocalAssemblerInterface,
       public NumLib::ExtrapolatableElement
@@ -123,7 +114,12 @@ public:
     using NodalMatrixType = typename ShapeMatricesType::NodalMatrixType;
     using NodalVectorType = typename ShapeMatricesType::NodalVectorType;
     using ShapeMatrices = typename ShapeMatricesType::ShapeMatrices;
+    using GlobalDimNodalMatrixType =
+        typename ShapeMatricesType::GlobalDimNodalMatrixType;
     using BMatricesType = BMatrixPolicyType<ShapeFunction, DisplacementDim>;
+    using ReferenceShapeData =
+        NumLib::ReferenceElementShapeData<ShapeFunction, ShapeMatricesType,
+                                          IntegrationMethod>;
 
     using BMatrixType = typename BMatricesType::BMatrixType;
     using StiffnessMatrixType = typename BMatricesType::StiffnessMatrixType;
@@ -143,6 +139,8 @@ public:
         SmallDeformationProcessData<DisplacementDim>& process_data)
         : _process_data(process_data),
           _integration_method(integration_order),
+          _reference_shape_data(
+              ReferenceShapeData::get(_integration_method)),
           _element(e),
           _is_axially_symmetric(is_axially_symmetric)
     {
@@ -150,7 +148,8 @@ public:
             _integration_method.getNumberOfPoints();
 
         _ip_data.reserve(n_integration_points);
-        _secondary_data.N.resize(n_integration_points);
+        if (!_process_data.recompute_dNdx)
+            _dNdx.reserve(n_integration_points);
 
         auto const shape_matrices =
             initShapeMatrices<ShapeFunction, ShapeMatricesType,
@@ -166,8 +165,8 @@ public:
                 _integration_method.getWeightedPoint(ip).getWeight() *
                 sm.integralMeasure * sm.detJ;
 
-            ip_data.N = sm.N;
-            ip_data.dNdx = sm.dNdx;
+            if (!_process_data.recompute_dNdx)
+                _dNdx.push_back(sm.dNdx);
 
             // Initialize current time step values
             ip_data.sigma.setZero(
@@ -179,8 +178,6 @@ public:
                 KelvinVectorDimensions<DisplacementDim>::value);
             ip_data.eps_prev.resize(
                 KelvinVectorDimensions<DisplacementDim>::value);
-
-            _secondary_data.N[ip] = shape_matrices[ip].N;
         }
     }
 
@@ -217,12 +214,15 @@ public:
         SpatialPosition x_position;
         x_position.setElementID(_element.getID());
 
+        ShapeMatrices shape_matrices(ShapeFunction::DIM, DisplacementDim,
+                                     ShapeFunction::NPOINTS);
+
         for (unsigned ip = 0; ip < n_integration_points; ip++)
         {
             x_position.setIntegrationPoint(ip);
             auto const& w = _ip_data[ip].integration_weight;
-            auto const& N = _ip_data[ip].N;
-            auto const& dNdx = _ip_data[ip].dNdx;
+            auto const& N = _reference_shape_data.N(ip);
+            auto const& dNdx = getShapeFunctionDerivatives(ip, shape_matrices);
 
             auto const x_coord =
                 interpolateXCoordinate<ShapeFunction, ShapeMatricesType>(
@@ -275,7 +275,7 @@ public:
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
-        auto const& N = _secondary_data.N[integration_point];
+        auto const& N = _reference_shape_data.N(integration_point);
 
         // assumes N is stored contiguously in memory
         return Eigen::Map<const Eigen::RowVectorXd>(N.data(), N.size());
@@ -358,6 +358,21 @@ public:
     }
 
 private:
+    /// Returns the stored dNdx at the given integration point or recomputes
+    /// it into the given shape matrices if the process is configured so.
+    GlobalDimNodalMatrixType const& getShapeFunctionDerivatives(
+        unsigned const ip, ShapeMatrices& shape_matrices) const
+    {
+        if (!_process_data.recompute_dNdx)
+            return _dNdx[ip];
+
+        computeShapeMatrices<ShapeFunction, ShapeMatricesType,
+                             IntegrationMethod, DisplacementDim>(
+            _element, _is_axially_symmetric, _integration_method,
+            _reference_shape_data, ip, shape_matrices);
+        return shape_matrices.dNdx;
+    }
+
     std::vector<double> const& getIntPtSigma(std::vector<double>& cache,
                                              std::size_t const component) const
     {
@@ -400,9 +415,15 @@ private:
             BMatricesType, ShapeMatricesType, DisplacementDim>>>
         _ip_data;
 
+    /// Shape function derivatives at the integration points. Empty if they
+    /// are recomputed at each assembly.
+    std::vector<GlobalDimNodalMatrixType,
+                Eigen::aligned_allocator<GlobalDimNodalMatrixType>>
+        _dNdx;
+
     IntegrationMethod _integration_method;
+    ReferenceShapeData const& _reference_shape_data;
     MeshLib::Element const& _element;
-    SecondaryData<typename ShapeMatrices::ShapeType> _secondary_data;
     bool const _is_axially_symmetric;
 };
 
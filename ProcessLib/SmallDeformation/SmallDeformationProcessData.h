@@ -18,13 +18,17 @@ struct SmallDeformationProcessData
 {
     SmallDeformationProcessData(
         std::unique_ptr<MaterialLib::Solids::MechanicsBase<DisplacementDim>>&&
-            material)
-        : material{std::move(material)}
+            material,
+        bool const recompute_dNdx_)
+        : material{std::move(material)}, recompute_dNdx(recompute_dNdx_)
     {
     }
 
     SmallDeformationProcessData(SmallDeformationProcessData&& other)
-        : material{std::move(other.material)}, dt{other.dt}, t{other.t}
+        : material{std::move(other.material)},
+          recompute_dNdx(other.recompute_dNdx),
+          dt{other.dt},
+          t{other.t}
     {
     }
 
@@ -39,6 +43,9 @@ struct SmallDeformationProcessData
 
     std::unique_ptr<MaterialLib::Solids::MechanicsBase<DisplacementDim>>
         material;
+    /// If set, the shape function derivatives dNdx are recomputed at each
+    /// assembly instead of being stored for every integration point.
+    bool const recompute_dNdx;
     double dt = 0;
     double t = 0;
 };
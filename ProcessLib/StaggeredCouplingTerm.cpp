@@ -12,6 +12,7 @@
 
 #include "StaggeredCouplingTerm.h"
 
+#include "BaseLib/Error.h"
 #include "MathLib/LinAlg/LinAlg.h"
 #include "Process.h"
 
@@ -53,6 +54,25 @@ const StaggeredCouplingTerm createVoidStaggeredCouplingTerm()
     return StaggeredCouplingTerm(coupled_processes, coupled_xs, 0.0, empty);
 }
 
+void checkDOFReorderingOfCoupledProcesses(
+    Process const& process,
+    std::unordered_map<std::type_index, Process const&> const&
+        coupled_processes)
+{
+    for (auto const& coupled_process_pair : coupled_processes)
+    {
+        if (coupled_process_pair.second.getDOFReordering() !=
+            process.getDOFReordering())
+        {
+            OGS_FATAL(
+                "A process and one of its coupled processes use different DOF "
+                "reorderings. The solution of a coupled process is read with "
+                "the global indices of the process itself, hence both have to "
+                "use the same dof_reordering.");
+        }
+    }
+}
+
 std::unordered_map<std::type_index, const std::vector<double>>
 getCurrentLocalSolutionsOfCoupledProcesses(
     const std::unordered_map<std::type_index, GlobalVector const&>&
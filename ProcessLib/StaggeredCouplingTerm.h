@@ -98,6 +98,15 @@ struct LocalCouplingTerm
  */
 const StaggeredCouplingTerm createVoidStaggeredCouplingTerm();
 
+/// Checks that the solutions of the \c coupled_processes can be read with the
+/// global indices of \c process, as done by
+/// getCurrentLocalSolutionsOfCoupledProcesses(). Calls OGS_FATAL if a coupled
+/// process renumbers its degrees of freedom differently.
+void checkDOFReorderingOfCoupledProcesses(
+    Process const& process,
+    std::unordered_map<std::type_index, Process const&> const&
+        coupled_processes);
+
 std::unordered_map<std::type_index, const std::vector<double>>
 getCurrentLocalSolutionsOfCoupledProcesses(
     const std::unordered_map<std::type_index, GlobalVector const&>&
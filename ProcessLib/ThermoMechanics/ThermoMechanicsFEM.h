@@ -17,6 +17,7 @@
 #include "MathLib/LinAlg/Eigen/EigenMapTools.h"
 #include "NumLib/Extrapolation/ExtrapolatableElement.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
+#include "NumLib/Fem/ReferenceElementShapeData.h"
 #include "NumLib/Fem/ShapeMatrixPolicy.h"
 #include "NumLib/Function/Interpolation.h"
 #include "ProcessLib/Deformation/BMatrixPolicy.h"
@@ -43,7 +44,6 @@ struct IntegrationPointData final
     {
     }
 
-    typename ShapeMatrixType::NodalRowVectorType N;
     typename ShapeMatrixType::GlobalDimNodalMatrixType dNdx;
     typename BMatricesType::KelvinVectorType sigma, sigma_prev;
     typename BMatricesType::KelvinVectorType eps;
@@ -89,14 +89,6 @@ struct IntegrationPointData final
     }
 };
 
-/// Used by for extrapolation of the integration point values. It is ordered
-/// (and stored) by integration points.
-template <typename ShapeMatrixType>
-struct SecondaryData
-{
-    std::vector<ShapeMatrixType, Eigen::aligned_allocator<ShapeMatrixType>> N;
-};
-
 struct ThermoMechanicsLocalAssemblerInterface
     : public ProcessLib::LocalAssemblerInterface,
       public NumLib::ExtrapolatableElement
@@ -151,6 +143,9 @@ public:
     // (Higher order elements = ShapeFunction).
     using ShapeMatrices = typename ShapeMatricesType::ShapeMatrices;
     using BMatricesType = BMatrixPolicyType<ShapeFunction, DisplacementDim>;
+    using ReferenceShapeData =
+        NumLib::ReferenceElementShapeData<ShapeFunction, ShapeMatricesType,
+                                          IntegrationMethod>;
 
     using NodalForceVectorType = typename BMatricesType::NodalForceVectorType;
     using RhsVector = typename ShapeMatricesType::template VectorType<
@@ -171,6 +166,8 @@ public:
         ThermoMechanicsProcessData<DisplacementDim>& process_data)
         : _process_data(process_data),
           _integration_method(integration_order),
+          _reference_shape_data(
+              ReferenceShapeData::get(_integration_method)),
           _element(e),
           _is_axially_symmetric(is_axially_symmetric)
     {
@@ -178,7 +175,6 @@ public:
             _integration_method.getNumberOfPoints();
 
         _ip_data.reserve(n_integration_points);
-        _secondary_data.N.resize(n_integration_points);
 
         auto const shape_matrices =
             initShapeMatrices<ShapeFunction, ShapeMatricesType,
@@ -200,10 +196,7 @@ public:
             ip_data.eps_m.setZero(kelvin_vector_size);
             ip_data.eps_m_prev.setZero(kelvin_vector_size);
 
-            ip_data.N = shape_matrices[ip].N;
             ip_data.dNdx = shape_matrices[ip].dNdx;
-
-            _secondary_data.N[ip] = shape_matrices[ip].N;
         }
     }
 
@@ -271,7 +264,7 @@ public:
             auto const& w = _ip_data[ip].integration_weight;
 
             auto const& dNdx = _ip_data[ip].dNdx;
-            auto const& N = _ip_data[ip].N;
+            auto const& N = _reference_shape_data.N(ip);
 
             auto const x_coord =
                 interpolateXCoordinate<ShapeFunction, ShapeMatricesType>(
@@ -378,7 +371,7 @@ public:
     Eigen::Map<const Eigen::RowVectorXd> getShapeMatrix(
         const unsigned integration_point) const override
     {
-        auto const& N = _secondary_data.N[integration_point];
+        auto const& N = _reference_shape_data.N(integration_point);
 
         // assumes N is stored contiguously in memory
         return Eigen::Map<const Eigen::RowVectorXd>(N.data(), N.size());
@@ -503,9 +496,9 @@ private:
         _ip_data;
 
     IntegrationMethod _integration_method;
+    ReferenceShapeData const& _reference_shape_data;
     MeshLib::Element const& _element;
     bool const _is_axially_symmetric;
-    SecondaryData<typename ShapeMatrices::ShapeType> _secondary_data;
 
     static const int temperature_index = 0;
     static const int temperature_size = ShapeFunction::NPOINTS;
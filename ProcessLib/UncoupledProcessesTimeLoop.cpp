@@ -13,6 +13,8 @@
 #include "NumLib/ODESolver/TimeDiscretizationBuilder.h"
 #include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
 #include "NumLib/ODESolver/ConvergenceCriterionPerComponent.h"
+#include "NumLib/ODESolver/ExplicitTimeIntegration.h"
+#include "NumLib/TimeStepping/Algorithms/ErrorControlledTimeStepping.h"
 #include "NumLib/TimeStepping/Algorithms/FixedTimeStepping.h"
 
 #include "MathLib/LinAlg/LinAlg.h"
@@ -36,6 +38,10 @@ std::unique_ptr<NumLib::ITimeStepAlgorithm> createTimeStepper(
     {
         timestepper = NumLib::FixedTimeStepping::newInstance(config);
     }
+    else if (type == "ErrorControlledTimeStepping")
+    {
+        timestepper = NumLib::ErrorControlledTimeStepping::newInstance(config);
+    }
     else
     {
         OGS_FATAL("Unknown timestepper type: `%s'.", type.c_str());
@@ -298,6 +304,19 @@ std::vector<std::unique_ptr<SingleProcessData>> createPerProcessData(
             nonlinear_solvers, nl_slv_name,
             "A nonlinear solver with the given name has not been defined.");
 
+        // The Newton-Raphson method assembles the Jacobian in each iteration,
+        // hence the constant assembly would be ignored silently.
+        if (pcs.isAssemblyConstant() &&
+            dynamic_cast<NumLib::NonlinearSolver<
+                NumLib::NonlinearSolverTag::Newton>*>(&nl_slv))
+        {
+            OGS_FATAL(
+                "The process `%s' is assembled only once, which is not "
+                "supported by the Newton nonlinear solver `%s'. Use a Picard "
+                "nonlinear solver instead.",
+                pcs_name.c_str(), nl_slv_name.c_str());
+        }
+
         auto time_disc = NumLib::createTimeDiscretization(
             //! \ogs_file_param{prj__time_loop__processes__process__time_discretization}
             pcs_config.getConfigSubtree("time_discretization"));
@@ -330,6 +349,7 @@ std::vector<std::unique_ptr<SingleProcessData>> createPerProcessData(
                               cpl_pcs_name.data());
                 }
             }
+            checkDOFReorderingOfCoupledProcesses(pcs, coupled_processes);
         }
 
         //! \ogs_file_param{prj__time_loop__processes__process__output}
@@ -439,7 +459,8 @@ bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
                                 double const t, double const delta_t,
                                 SingleProcessData& process_data,
                                 StaggeredCouplingTerm const& coupling_term,
-                                Output const& output_control)
+                                Output const& output_control,
+                                bool const predict_solution)
 {
     auto& process = process_data.process;
     auto& time_disc = *process_data.time_disc;
@@ -457,6 +478,24 @@ bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
 
     time_disc.nextTimestep(t, delta_t);
 
+    // The explicit scheme with lumped mass bypasses the nonlinear solver.
+    if (auto const* forward_euler =
+            dynamic_cast<NumLib::ForwardEuler const*>(&time_disc))
+    {
+        if (forward_euler->useMassLumping())
+        {
+            auto const number_of_substeps =
+                NumLib::integrateExplicitlyWithLumpedMass(
+                    process, t - delta_t, delta_t, x, coupling_term);
+            INFO("Explicit time step with lumped mass took %u substeps.",
+                 number_of_substeps);
+            return true;
+        }
+    }
+
+    if (predict_solution)
+        time_disc.predictX(x);
+
     applyKnownSolutions(ode_sys, nl_tag, x);
 
     auto const post_iteration_callback = [&](unsigned iteration,
@@ -465,13 +504,7 @@ bool solveOneTimeStepOneProcess(GlobalVector& x, std::size_t const timestep,
             process, process_data.process_output, timestep, t, x, iteration);
     };
 
-    bool nonlinear_solver_succeeded =
-        nonlinear_solver.solve(x, coupling_term, post_iteration_callback);
-
-    auto& mat_strg = *process_data.mat_strg;
-    time_disc.pushState(t, x, mat_strg);
-
-    return nonlinear_solver_succeeded;
+    return nonlinear_solver.solve(x, coupling_term, post_iteration_callback);
 }
 
 UncoupledProcessesTimeLoop::UncoupledProcessesTimeLoop(
@@ -597,6 +630,27 @@ bool UncoupledProcessesTimeLoop::loop()
 
     const bool is_staggered_coupling = setCoupledSolutions();
 
+    if (dynamic_cast<NumLib::ErrorControlledTimeStepping*>(_timestepper.get()))
+    {
+        if (is_staggered_coupling)
+            OGS_FATAL(
+                "The ErrorControlledTimeStepping cannot be used together with "
+                "the staggered coupling of processes.");
+
+        for (auto& spd : _per_process_data)
+        {
+            auto* const bdf =
+                dynamic_cast<NumLib::BackwardDifferentiationFormula*>(
+                    spd->time_disc.get());
+            if (!bdf)
+                OGS_FATAL(
+                    "The ErrorControlledTimeStepping requires the "
+                    "BackwardDifferentiationFormula time discretization for "
+                    "all processes.");
+            bdf->enableVariableOrder();
+        }
+    }
+
     double t = t0;
     std::size_t timestep = 1;  // the first timestep really is number one
     bool nonlinear_solver_succeeded = true;
@@ -650,6 +704,15 @@ bool UncoupledProcessesTimeLoop::loop()
 bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
     const double t, const double dt, const std::size_t timestep_id)
 {
+    auto* const error_control =
+        dynamic_cast<NumLib::ErrorControlledTimeStepping*>(_timestepper.get());
+    // With error control, the solutions of the preceding time step are kept
+    // until the time step has been accepted.
+    std::vector<GlobalVector*> xs_prev;
+
+    const auto void_staggered_coupling_term =
+        ProcessLib::createVoidStaggeredCouplingTerm();
+
     // TODO use process name
     unsigned pcs_idx = 0;
     for (auto& spd : _per_process_data)
@@ -659,14 +722,57 @@ bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
         time_timestep_process.start();
 
         auto& x = *_process_solutions[pcs_idx];
+        if (error_control)
+            xs_prev.push_back(
+                &NumLib::GlobalVectorProvider::provider.getVector(x));
+
         pcs.preTimestep(x, t, dt);
 
-        const auto void_staggered_coupling_term =
-            ProcessLib::createVoidStaggeredCouplingTerm();
+        // The predictor is only used with error control, where the time step
+        // sizes adapt to it.
+        const auto nonlinear_solver_succeeded = solveOneTimeStepOneProcess(
+            x, timestep_id, t, dt, *spd, void_staggered_coupling_term,
+            *_output, error_control != nullptr);
+
+        if (!nonlinear_solver_succeeded && error_control &&
+            error_control->rejectNonlinearSolverFailure())
+        {
+            WARN(
+                "The nonlinear solver failed in time step #%u at t = %g s for "
+                "process #%u. The time step is repeated with a smaller size.",
+                timestep_id, t, pcs_idx);
+
+            // Restore the solutions of the preceding time step.
+            for (std::size_t i = 0; i < xs_prev.size(); ++i)
+            {
+                MathLib::LinAlg::copy(*xs_prev[i], *_process_solutions[i]);
+                NumLib::GlobalVectorProvider::provider.releaseVector(
+                    *xs_prev[i]);
+            }
+            return true;
+        }
+
+        if (nonlinear_solver_succeeded && error_control)
+        {
+            auto& error = NumLib::GlobalVectorProvider::provider.getVector(x);
+            auto const order =
+                spd->time_disc->estimateLocalTruncationError(x, error);
+            if (order > 0)
+            {
+                auto const norm_type = error_control->getNormType();
+                error_control->addErrorEstimate(
+                    MathLib::LinAlg::norm(error, norm_type),
+                    MathLib::LinAlg::norm(x, norm_type), order);
+            }
+            NumLib::GlobalVectorProvider::provider.releaseVector(error);
 
-        const auto nonlinear_solver_succeeded =
-            solveOneTimeStepOneProcess(x, timestep_id, t, dt, *spd,
-                                       void_staggered_coupling_term, *_output);
+            INFO("[time] Solving process #%u took %g s in time step #%u ",
+                 pcs_idx, time_timestep_process.elapsed(), timestep_id);
+            ++pcs_idx;
+            continue;
+        }
+
+        spd->time_disc->pushState(t, x, *spd->mat_strg);
         pcs.postTimestep(x);
         pcs.computeSecondaryVariable(t, x, void_staggered_coupling_term);
 
@@ -683,6 +789,8 @@ bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
             _output->doOutputAlways(pcs, spd->process_output, timestep_id, t,
                                     x);
 
+            for (auto* x_prev : xs_prev)
+                NumLib::GlobalVectorProvider::provider.releaseVector(*x_prev);
             return false;
         }
 
@@ -691,12 +799,43 @@ bool UncoupledProcessesTimeLoop::solveUncoupledEquationSystems(
         ++pcs_idx;
     }  // end of for (auto& spd : _per_process_data)
 
+    if (!error_control)
+        return true;
+
+    bool const accepted = error_control->accepted();
+    pcs_idx = 0;
+    for (auto& spd : _per_process_data)
+    {
+        auto& x = *_process_solutions[pcs_idx];
+        if (accepted)
+        {
+            auto& pcs = spd->process;
+            spd->time_disc->pushState(t, x, *spd->mat_strg);
+            pcs.postTimestep(x);
+            pcs.computeSecondaryVariable(t, x, void_staggered_coupling_term);
+            _output->doOutput(pcs, spd->process_output, timestep_id, t, x);
+        }
+        else
+        {
+            // the time step will be repeated with a smaller size
+            MathLib::LinAlg::copy(*xs_prev[pcs_idx], x);
+        }
+        NumLib::GlobalVectorProvider::provider.releaseVector(
+            *xs_prev[pcs_idx]);
+
+        ++pcs_idx;
+    }
+
     return true;
 }
 
 bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
     const double t, const double dt, const std::size_t timestep_id)
 {
+    auto const* const error_control =
+        dynamic_cast<NumLib::ErrorControlledTimeStepping const*>(
+            _timestepper.get());
+
     // Coupling iteration
     bool coupling_iteration_converged = true;
     for (unsigned global_coupling_iteration = 0;
@@ -733,8 +872,11 @@ bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
                 spd->coupled_processes,
                 _solutions_of_coupled_processes[pcs_idx], dt);
 
+            // As in the uncoupled case the predictor is only used with error
+            // control.
             const auto nonlinear_solver_succeeded = solveOneTimeStepOneProcess(
-                x, timestep_id, t, dt, *spd, coupling_term, *_output);
+                x, timestep_id, t, dt, *spd, coupling_term, *_output,
+                error_control != nullptr && global_coupling_iteration == 0);
 
             INFO(
                 "[time] Solving process #%u took %g s in time step #%u "
@@ -793,6 +935,7 @@ bool UncoupledProcessesTimeLoop::solveCoupledEquationSystemsByStaggeredScheme(
     {
         auto& pcs = spd->process;
         auto& x = *_process_solutions[pcs_idx];
+        spd->time_disc->pushState(t, x, *spd->mat_strg);
         pcs.postTimestep(x);
 
         StaggeredCouplingTerm coupled_term(
@@ -12,10 +12,42 @@
 
 #include "MeshLib/Elements/Element.h"
 #include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
-
+#include "NumLib/Fem/ReferenceElementShapeData.h"
 
 namespace ProcessLib
 {
+/// Computes the shape matrices of the element \c e at the integration point
+/// \c ip.
+///
+/// N and dNdr are copied from the reference element tabulation, which is
+/// shared between all elements of the same type; only the geometry dependent
+/// parts (J, detJ, invJ, dNdx, and the integral measure) are computed for the
+/// element. Local assemblers use this to recompute dNdx during the assembly
+/// instead of storing it for all integration points.
+template <typename ShapeFunction, typename ShapeMatricesType,
+          typename IntegrationMethod, unsigned GlobalDim>
+void computeShapeMatrices(
+    MeshLib::Element const& e, bool is_axially_symmetric,
+    IntegrationMethod const& integration_method,
+    NumLib::ReferenceElementShapeData<ShapeFunction, ShapeMatricesType,
+                                      IntegrationMethod> const& reference_data,
+    unsigned const ip,
+    typename ShapeMatricesType::ShapeMatrices& shape_matrices)
+{
+    using FemType = NumLib::TemplateIsoparametric<
+        ShapeFunction, ShapeMatricesType>;
+
+    FemType fe(*static_cast<const typename ShapeFunction::MeshElement*>(&e));
+
+    shape_matrices.N = reference_data.N(ip);
+    shape_matrices.dNdr = reference_data.dNdr(ip);
+    shape_matrices.template setZero<NumLib::ShapeMatrixType::J_DNDX>();
+
+    fe.template computeShapeFunctions<NumLib::ShapeMatrixType::J_DNDX>(
+        integration_method.getWeightedPoint(ip).getCoords(), shape_matrices,
+        GlobalDim, is_axially_symmetric);
+}
+
 template <typename ShapeFunction, typename ShapeMatricesType,
           typename IntegrationMethod, unsigned GlobalDim>
 std::vector<typename ShapeMatricesType::ShapeMatrices,
@@ -28,10 +60,9 @@ initShapeMatrices(MeshLib::Element const& e, bool is_axially_symmetric,
         Eigen::aligned_allocator<typename ShapeMatricesType::ShapeMatrices>>
         shape_matrices;
 
-    using FemType = NumLib::TemplateIsoparametric<
-        ShapeFunction, ShapeMatricesType>;
-
-    FemType fe(*static_cast<const typename ShapeFunction::MeshElement*>(&e));
+    auto const& reference_data = NumLib::ReferenceElementShapeData<
+        ShapeFunction, ShapeMatricesType,
+        IntegrationMethod>::get(integration_method);
 
     unsigned const n_integration_points = integration_method.getNumberOfPoints();
 
@@ -39,9 +70,10 @@ initShapeMatrices(MeshLib::Element const& e, bool is_axially_symmetric,
     for (unsigned ip = 0; ip < n_integration_points; ++ip) {
         shape_matrices.emplace_back(ShapeFunction::DIM, GlobalDim,
                                      ShapeFunction::NPOINTS);
-        fe.computeShapeFunctions(
-                integration_method.getWeightedPoint(ip).getCoords(),
-                shape_matrices[ip], GlobalDim, is_axially_symmetric);
+        computeShapeMatrices<ShapeFunction, ShapeMatricesType,
+                             IntegrationMethod, GlobalDim>(
+            e, is_axially_symmetric, integration_method, reference_data, ip,
+            shape_matrices[ip]);
     }
 
     return shape_matrices;
@@ -297,6 +297,7 @@ public:
     }
 
     /// Sets the provided \c data_ptr to the newly created local assembler data.
+    /// For mesh items without degrees of freedom \c data_ptr is left empty.
     ///
     /// \attention
     /// The index \c id is not necessarily the mesh item's id. Especially when
@@ -312,6 +313,9 @@ public:
         if (it != _builder.end())
         {
             auto const num_local_dof = _dof_table.getNumberOfElementDOF(id);
+            // Inactive elements have no dofs and get no local assembler.
+            if (num_local_dof == 0)
+                return;
             data_ptr = it->second(mesh_item, num_local_dof,
                                   std::forward<ConstructorArgs>(args)...);
         }
@@ -9,6 +9,7 @@
 
 #include "VectorMatrixAssembler.h"
 
+#include <algorithm>
 #include <cassert>
 
 #include "NumLib/DOF/DOFTableUtil.h"
@@ -62,6 +63,9 @@ void VectorMatrixAssembler::assemble(
     const StaggeredCouplingTerm& coupling_term)
 {
     auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    // Inactive elements have no degrees of freedom.
+    if (indices.empty())
+        return;
     auto const local_x = x.get(indices);
 
     _local_M_data.clear();
@@ -88,6 +92,12 @@ void VectorMatrixAssembler::assemble(
                                           local_coupling_term);
     }
 
+    if (_M_lumped)
+    {
+        addLumped(indices, local_x, b);
+        return;
+    }
+
     auto const num_r_c = indices.size();
     auto const r_c_indices =
         NumLib::LocalToGlobalIndexMap::RowColumnIndices(indices, indices);
@@ -109,6 +119,51 @@ void VectorMatrixAssembler::assemble(
     }
 }
 
+void VectorMatrixAssembler::setLumpedMassAssembly(GlobalVector* M_lumped)
+{
+    _M_lumped = M_lumped;
+    _lumped_max_eigenvalue = 0;
+}
+
+void VectorMatrixAssembler::addLumped(
+    std::vector<GlobalIndexType> const& indices,
+    std::vector<double> const& local_x, GlobalVector& b)
+{
+    auto const num_r_c = indices.size();
+
+    _local_M_lumped_data.assign(num_r_c, 0.0);
+    _local_r_data.assign(num_r_c, 0.0);
+    auto local_M_lumped = MathLib::toVector(_local_M_lumped_data);
+    auto local_r = MathLib::toVector(_local_r_data);
+
+    if (!_local_M_data.empty())
+    {
+        local_M_lumped =
+            MathLib::toMatrix(_local_M_data, num_r_c, num_r_c).rowwise().sum();
+    }
+    if (!_local_b_data.empty())
+    {
+        assert(_local_b_data.size() == num_r_c);
+        local_r = MathLib::toVector(_local_b_data);
+    }
+    if (!_local_K_data.empty())
+    {
+        auto const local_K = MathLib::toMatrix(_local_K_data, num_r_c, num_r_c);
+        local_r.noalias() -= local_K * MathLib::toVector(local_x);
+
+        for (std::size_t i = 0; i < num_r_c; ++i)
+        {
+            if (local_M_lumped[i] > 0)
+                _lumped_max_eigenvalue = std::max(
+                    _lumped_max_eigenvalue,
+                    local_K.row(i).cwiseAbs().sum() / local_M_lumped[i]);
+        }
+    }
+
+    _M_lumped->add(indices, _local_M_lumped_data);
+    b.add(indices, _local_r_data);
+}
+
 void VectorMatrixAssembler::assembleWithJacobian(
     std::size_t const mesh_item_id, LocalAssemblerInterface& local_assembler,
     NumLib::LocalToGlobalIndexMap const& dof_table, const double t,
@@ -117,6 +172,9 @@ void VectorMatrixAssembler::assembleWithJacobian(
     GlobalMatrix& Jac, const StaggeredCouplingTerm& coupling_term)
 {
     auto const indices = NumLib::getIndices(mesh_item_id, dof_table);
+    // Inactive elements have no degrees of freedom.
+    if (indices.empty())
+        return;
     auto const local_x = x.get(indices);
     auto const local_xdot = xdot.get(indices);
 
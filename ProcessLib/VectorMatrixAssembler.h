@@ -54,13 +54,36 @@ public:
                               GlobalMatrix& Jac,
                               const StaggeredCouplingTerm& coupling_term);
 
+    //! Switches assemble() to mass lumping: the row sums of the local \c M
+    //! are added to \c M_lumped, and the local residual \f$ b - K x \f$ is
+    //! added to \c b. The global matrices \c M and \c K are not touched.
+    //! Passing \c nullptr switches back to the regular assembly.
+    void setLumpedMassAssembly(GlobalVector* M_lumped);
+
+    //! Upper bound of the eigenvalues of \f$ M_\mathrm{lumped}^{-1} K \f$ of
+    //! all elements assembled since the last call of setLumpedMassAssembly().
+    //! It is obtained by Gershgorin's theorem and bounds the eigenvalues of
+    //! the assembled global system, too.
+    double getLumpedMaximumEigenvalue() const { return _lumped_max_eigenvalue; }
+
 private:
+    //! Adds the lumped local mass matrix and the local residual to the global
+    //! vectors, see setLumpedMassAssembly().
+    void addLumped(std::vector<GlobalIndexType> const& indices,
+                   std::vector<double> const& local_x, GlobalVector& b);
+
     // temporary data only stored here in order to avoid frequent memory
     // reallocations.
     std::vector<double> _local_M_data;
     std::vector<double> _local_K_data;
     std::vector<double> _local_b_data;
     std::vector<double> _local_Jac_data;
+    std::vector<double> _local_M_lumped_data;
+    std::vector<double> _local_r_data;
+
+    //! Destination of the lumped mass matrix, \c nullptr if not lumping.
+    GlobalVector* _M_lumped = nullptr;
+    double _lumped_max_eigenvalue = 0;
 
     //! Used to assemble the Jacobian.
     std::unique_ptr<AbstractJacobianAssembler> _jacobian_assembler;
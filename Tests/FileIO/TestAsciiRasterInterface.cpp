@@ -0,0 +1,149 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+
+#ifdef _WIN32
+#include <sys/utime.h>
+#else
+#include <utime.h>
+#endif
+
+#include "gtest/gtest.h"
+
+#include "Applications/FileIO/AsciiRasterInterface.h"
+#include "BaseLib/BuildInfo.h"
+#include "GeoLib/Raster.h"
+
+class AsciiRasterInterfaceTest : public ::testing::Test
+{
+public:
+    AsciiRasterInterfaceTest()
+        : _asc_file(BaseLib::BuildInfo::tests_tmp_path + "TestRaster.asc"),
+          _cache_file(_asc_file + ".ogsraster")
+    {
+        // 4 columns and 3 rows given from top to bottom; one value uses a
+        // comma as decimal separator and the last row spans two lines.
+        std::ofstream out(_asc_file);
+        out << "ncols 4\n"
+               "nrows 3\n"
+               "xllcorner 10\n"
+               "yllcorner 20\n"
+               "cellsize 2\n"
+               "NODATA_value -9999\n"
+               "8 9 10 11\n"
+               "4 5,5 6 -9999\n"
+               "0 1\n"
+               "2 3\n";
+    }
+
+    ~AsciiRasterInterfaceTest() override
+    {
+        std::remove(_asc_file.c_str());
+        std::remove(_cache_file.c_str());
+    }
+
+    void checkRaster(GeoLib::Raster const& raster) const
+    {
+        auto const& header = raster.getHeader();
+        ASSERT_EQ(4u, header.n_cols);
+        ASSERT_EQ(3u, header.n_rows);
+        EXPECT_EQ(10.0, header.origin[0]);
+        EXPECT_EQ(20.0, header.origin[1]);
+        EXPECT_EQ(2.0, header.cell_size);
+        EXPECT_EQ(-9999.0, header.no_data);
+
+        double const expected[] = {0, 1, 2,   3,    4, 5.5,
+                                   6, -9999, 8, 9, 10, 11};
+        ASSERT_EQ(12, std::distance(raster.begin(), raster.end()));
+        for (std::size_t k(0); k < 12; ++k)
+            EXPECT_EQ(expected[k], raster.begin()[k]);
+
+        EXPECT_EQ(5.5, raster.getValueAtPoint(MathLib::Point3d(
+                           std::array<double, 3>{{13, 23, 0}})));
+    }
+
+protected:
+    std::string const _asc_file;
+    std::string const _cache_file;
+};
+
+TEST_F(AsciiRasterInterfaceTest, ReadASCFile)
+{
+    std::unique_ptr<GeoLib::Raster> raster(
+        FileIO::AsciiRasterInterface::getRasterFromASCFile(_asc_file));
+    ASSERT_TRUE(raster != nullptr);
+    checkRaster(*raster);
+}
+
+TEST_F(AsciiRasterInterfaceTest, ReadUsingCacheFile)
+{
+    {
+        std::unique_ptr<GeoLib::Raster> raster(
+            FileIO::AsciiRasterInterface::getRasterUsingCacheFile(_asc_file));
+        ASSERT_TRUE(raster != nullptr);
+        checkRaster(*raster);
+    }
+
+    // The existing cache file is reused and may be refined in memory without
+    // changing the file.
+    {
+        std::unique_ptr<GeoLib::Raster> raster(
+            GeoLib::Raster::createFromCacheFile(_cache_file));
+        ASSERT_TRUE(raster != nullptr);
+        checkRaster(*raster);
+        raster->refineRaster(2);
+        ASSERT_EQ(8u, raster->getHeader().n_cols);
+        EXPECT_EQ(5.5, raster->begin()[2 * 8 + 2]);
+    }
+    {
+        std::unique_ptr<GeoLib::Raster> raster(
+            GeoLib::Raster::createFromCacheFile(_cache_file));
+        ASSERT_TRUE(raster != nullptr);
+        checkRaster(*raster);
+    }
+}
+
+TEST_F(AsciiRasterInterfaceTest, OutdatedCacheFile)
+{
+    // Pretend an old raster file to get a modification time different from
+    // the one of the edited file below.
+    utimbuf const old_time{1000000000, 1000000000};
+    ASSERT_EQ(0, utime(_asc_file.c_str(), &old_time));
+    {
+        std::unique_ptr<GeoLib::Raster> raster(
+            FileIO::AsciiRasterInterface::getRasterUsingCacheFile(_asc_file));
+        ASSERT_TRUE(raster != nullptr);
+        checkRaster(*raster);
+    }
+
+    // Edit a value without changing the size of the file.
+    {
+        std::fstream file(_asc_file, std::ios::in | std::ios::out);
+        std::string const content((std::istreambuf_iterator<char>(file)),
+                                  std::istreambuf_iterator<char>());
+        auto const position = content.find("8 9 10 11");
+        ASSERT_NE(std::string::npos, position);
+        file.seekp(position);
+        file << "7";
+    }
+    std::unique_ptr<GeoLib::Raster> raster(
+        FileIO::AsciiRasterInterface::getRasterUsingCacheFile(_asc_file));
+    ASSERT_TRUE(raster != nullptr);
+    EXPECT_EQ(7.0, raster->begin()[8]);
+}
+
+TEST_F(AsciiRasterInterfaceTest, InvalidCacheFile)
+{
+    EXPECT_EQ(nullptr, GeoLib::Raster::createFromCacheFile(_asc_file));
+}
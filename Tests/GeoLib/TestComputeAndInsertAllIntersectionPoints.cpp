@@ -10,6 +10,7 @@
  */
 
 #include <ctime>
+#include <memory>
 #include <tuple>
 
 #include "gtest/gtest.h"
@@ -110,3 +111,66 @@ TEST(GeoLib, TestComputeAndInsertAllIntersectionPoints)
     delete ply0;
 }
 
+
+TEST(GeoLib, TestComputeAndInsertAllIntersectionPointsGrid)
+{
+    GeoLib::GEOObjects geo_objs;
+    std::string geo_name("TestGrid");
+
+    // n horizontal and n vertical lines crossing in n*n points; the first
+    // vertical line starts on the first horizontal line.
+    std::size_t const n(10);
+    {
+        auto pnts = std::make_unique<std::vector<GeoLib::Point*>>();
+        for (std::size_t k(0); k < n; ++k)
+        {
+            pnts->push_back(new GeoLib::Point(-1.0, k, 0.0, 4 * k));
+            pnts->push_back(new GeoLib::Point(n, k, 0.0, 4 * k + 1));
+            pnts->push_back(new GeoLib::Point(k, k == 0 ? 0.0 : -1.0, 0.0,
+                                              4 * k + 2));
+            pnts->push_back(new GeoLib::Point(k, n, 0.0, 4 * k + 3));
+        }
+        geo_objs.addPointVec(std::move(pnts), geo_name);
+    }
+
+    auto& pnts = *geo_objs.getPointVec(geo_name);
+    std::vector<std::unique_ptr<GeoLib::Polyline>> ply_storage;
+    std::vector<GeoLib::Polyline*> plys;
+    for (std::size_t k(0); k < 2 * n; ++k)
+    {
+        ply_storage.emplace_back(new GeoLib::Polyline(pnts));
+        ply_storage.back()->addPoint(2 * k);
+        ply_storage.back()->addPoint(2 * k + 1);
+        plys.push_back(ply_storage.back().get());
+    }
+
+    GeoLib::PointVec& pnt_vec(*(
+        const_cast<GeoLib::PointVec*>(geo_objs.getPointVecObj(geo_name))));
+    GeoLib::computeAndInsertAllIntersectionPoints(pnt_vec, plys);
+
+    // The intersection at (0,0) coincides with the begin of a vertical line.
+    ASSERT_EQ(4 * n + n * n - 1, pnt_vec.size());
+    for (std::size_t k(0); k < n; ++k)
+    {
+        auto const& horizontal = *plys[2 * k];
+        ASSERT_EQ(n + 2, horizontal.getNumberOfPoints());
+        for (std::size_t j(0); j < n; ++j)
+        {
+            EXPECT_EQ(static_cast<double>(j),
+                      (*horizontal.getPoint(j + 1))[0]);
+            EXPECT_EQ(static_cast<double>(k),
+                      (*horizontal.getPoint(j + 1))[1]);
+        }
+
+        auto const& vertical = *plys[2 * k + 1];
+        ASSERT_EQ(k == 0 ? n + 1 : n + 2, vertical.getNumberOfPoints());
+        std::size_t const offset(k == 0 ? 0 : 1);
+        for (std::size_t j(0); j < n; ++j)
+        {
+            EXPECT_EQ(static_cast<double>(k),
+                      (*vertical.getPoint(j + offset))[0]);
+            EXPECT_EQ(static_cast<double>(j),
+                      (*vertical.getPoint(j + offset))[1]);
+        }
+    }
+}
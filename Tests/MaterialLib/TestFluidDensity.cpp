@@ -160,3 +160,41 @@ TEST(Material, checkWaterDensityIAPWSIF97Region1)
     const double rho_p1 = rho->getValue(vars);
     ASSERT_NEAR((rho_p1 - rho_T1) / perturbation, drho_dp, 1.e-6);
 }
+
+TEST(Material, checkTabulatedWaterDensityIAPWSIF97Region1)
+{
+    const char xml[] =
+        "<density>"
+        "   <type>WaterDensityIAPWSIF97Region1</type>"
+        "   <tabulation>"
+        "       <temperature_range> 280 480 </temperature_range>"
+        "       <pressure_range> 1e5 5e7 </pressure_range>"
+        "       <number_of_nodes> 11 11 </number_of_nodes>"
+        "       <tolerance> 1e-9 </tolerance>"
+        "   </tabulation>"
+        "</density>";
+    const auto rho_tabulated = createTestFluidDensityModel(xml);
+    const auto rho = createTestFluidDensityModel(
+        "<density><type>WaterDensityIAPWSIF97Region1</type></density>");
+
+    for (double T = 281.3; T < 480; T += 17.9)
+    {
+        for (double p = 2.1e5; p < 5e7; p += 3.7e6)
+        {
+            ArrayType const vars = {{T, p, 0.0}};
+            double const rho_expected = rho->getValue(vars);
+            ASSERT_NEAR(rho_expected, rho_tabulated->getValue(vars),
+                        1e-8 * rho_expected);
+            ASSERT_NEAR(rho->getdValue(vars, PropertyVariableType::T),
+                        rho_tabulated->getdValue(vars, PropertyVariableType::T),
+                        1e-5);
+            ASSERT_NEAR(rho->getdValue(vars, PropertyVariableType::p),
+                        rho_tabulated->getdValue(vars, PropertyVariableType::p),
+                        1e-12);
+        }
+    }
+
+    // Outside of the table the model itself is evaluated.
+    ArrayType const vars = {{520.0, 4.e+7, 0.0}};
+    ASSERT_EQ(rho->getValue(vars), rho_tabulated->getValue(vars));
+}
@@ -162,3 +162,44 @@ TEST(MaterialFluidProperties, checkFluidPropertiesWithDensityDependentModels_dp)
     ASSERT_NEAR((rho1 - rho) / perturbation, drho_dp, 1.e-7);
     ASSERT_NEAR((mu1 - mu) / perturbation, dmu_dp, 1.e-10);
 }
+
+TEST(MaterialFluidProperties, checkBatchEvaluationOfFluidProperties)
+{
+    const char xml[] =
+        "<fluid>"
+        "   <density>"
+        "       <type>WaterDensityIAPWSIF97Region1</type>"
+        "    </density>"
+        "    <viscosity>"
+        "       <type>WaterViscosityIAPWS</type>"
+        "    </viscosity>"
+        "</fluid>";
+
+    auto const fluid_model = createTestFluidProperties(xml);
+
+    std::vector<ArrayType> vars;
+    for (double T = 280.0; T < 600.0; T += 20.0)
+    {
+        for (double p = 1.e+5; p < 1.e+8; p *= 10.0)
+        {
+            vars.push_back({{T, p, 0.0}});
+        }
+    }
+
+    std::vector<double> densities;
+    fluid_model->getValues(FluidPropertyType::Density, vars, densities);
+    std::vector<double> viscosities;
+    fluid_model->getValues(FluidPropertyType::Viscosity, vars, viscosities);
+
+    ASSERT_EQ(vars.size(), densities.size());
+    ASSERT_EQ(vars.size(), viscosities.size());
+    for (std::size_t i = 0; i < vars.size(); ++i)
+    {
+        ASSERT_DOUBLE_EQ(
+            fluid_model->getValue(FluidPropertyType::Density, vars[i]),
+            densities[i]);
+        ASSERT_DOUBLE_EQ(
+            fluid_model->getValue(FluidPropertyType::Viscosity, vars[i]),
+            viscosities[i]);
+    }
+}
@@ -0,0 +1,81 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <cmath>
+
+#include "MathLib/InterpolationAlgorithms/BicubicHermiteInterpolation.h"
+
+TEST(MathLibInterpolationAlgorithms, BicubicHermiteInterpolationCubic)
+{
+    // The interpolation reproduces cubic polynomials with a constant mixed
+    // derivative exactly.
+    auto const f = [](double x, double y) {
+        return x * x * x + 2 * y * y * y + x * y;
+    };
+    MathLib::BicubicHermiteInterpolation const interpolation(
+        -1.0, 2.0, 4, 0.5, 3.0, 6,
+        [&f](double x, double y) -> std::array<double, 3> {
+            return {{f(x, y), 3 * x * x + y, 6 * y * y + x}};
+        });
+
+    for (double x = -1.0; x <= 2.0; x += 0.13)
+    {
+        for (double y = 0.5; y <= 3.0; y += 0.17)
+        {
+            ASSERT_TRUE(interpolation.contains(x, y));
+            ASSERT_NEAR(f(x, y), interpolation.getValue(x, y), 1e-12);
+            ASSERT_NEAR(3 * x * x + y, interpolation.getDerivativeX(x, y),
+                        1e-12);
+            ASSERT_NEAR(6 * y * y + x, interpolation.getDerivativeY(x, y),
+                        1e-12);
+        }
+    }
+    ASSERT_NEAR(f(2.0, 3.0), interpolation.getValue(2.0, 3.0), 1e-12);
+    ASSERT_FALSE(interpolation.contains(2.1, 1.0));
+    ASSERT_NEAR(0.0, interpolation.getMaximumRelativeError(f, 1.0), 1e-14);
+}
+
+TEST(MathLibInterpolationAlgorithms, BicubicHermiteInterpolationConvergence)
+{
+    auto const f = [](double x, double y) { return std::exp(x) * std::sin(y); };
+    auto const df = [&f](double x, double y) -> std::array<double, 3> {
+        return {{f(x, y), f(x, y), std::exp(x) * std::cos(y)}};
+    };
+
+    MathLib::BicubicHermiteInterpolation const coarse(0.0, 1.0, 5, 0.0, 1.0, 5,
+                                                      df);
+    MathLib::BicubicHermiteInterpolation const fine(0.0, 1.0, 9, 0.0, 1.0, 9,
+                                                    df);
+
+    double const error_coarse = coarse.getMaximumRelativeError(f, 1.0);
+    double const error_fine = fine.getMaximumRelativeError(f, 1.0);
+    ASSERT_LT(error_coarse, 1e-4);
+    // Fourth order convergence with respect to the grid spacing, except for
+    // the contribution of the finite difference mixed derivative.
+    ASSERT_LT(error_fine, error_coarse / 8);
+}
+
+TEST(MathLibInterpolationAlgorithms, BicubicHermiteInterpolationInvalidGrid)
+{
+    auto const df = [](double x, double y) -> std::array<double, 3> {
+        return {{x + y, 1.0, 1.0}};
+    };
+
+    EXPECT_ANY_THROW(
+        MathLib::BicubicHermiteInterpolation(0.0, 1.0, 1, 0.0, 1.0, 3, df));
+    EXPECT_ANY_THROW(
+        MathLib::BicubicHermiteInterpolation(0.0, 1.0, 3, 0.0, 1.0, 0, df));
+    EXPECT_ANY_THROW(
+        MathLib::BicubicHermiteInterpolation(1.0, 1.0, 3, 0.0, 1.0, 3, df));
+    EXPECT_ANY_THROW(
+        MathLib::BicubicHermiteInterpolation(0.0, 1.0, 3, 2.0, 1.0, 3, df));
+}
@@ -0,0 +1,170 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Core>
+
+#include "MathLib/LinAlg/Eigen/BlockCSRMatrix.h"
+#include "MathLib/LinAlg/Eigen/BlockPreconditioners.h"
+#include "MathLib/LinAlg/Eigen/EigenMatrix.h"
+#include "MathLib/LinAlg/Eigen/KrylovSolvers.h"
+
+namespace
+{
+using IndexType = MathLib::EigenMatrix::IndexType;
+
+/// Block tridiagonal, symmetric positive definite matrix of a chain of nodes
+/// with two coupled components each.
+MathLib::EigenMatrix createChainMatrix(IndexType const n_nodes)
+{
+    MathLib::EigenMatrix A(2 * n_nodes);
+    Eigen::Matrix2d const element_matrix =
+        (Eigen::Matrix2d() << 2.0, 0.5, 0.5, 1.0).finished();
+    for (IndexType e = 0; e < n_nodes - 1; ++e)
+    {
+        for (int a = 0; a < 2; ++a)
+        {
+            for (int b = 0; b < 2; ++b)
+            {
+                double const sign = (a == b) ? 1.0 : -1.0;
+                for (int i = 0; i < 2; ++i)
+                    for (int j = 0; j < 2; ++j)
+                        A.add(2 * (e + a) + i, 2 * (e + b) + j,
+                              sign * element_matrix(i, j));
+            }
+        }
+    }
+    // Makes the matrix regular.
+    A.add(0, 0, 1.0);
+    A.add(1, 1, 1.0);
+    A.getRawMatrix().makeCompressed();
+    return A;
+}
+}  // namespace
+
+TEST(MathLibBlockCSRMatrix, ConversionAndProduct)
+{
+    auto const A = createChainMatrix(10);
+    MathLib::BlockCSRMatrix<2> const B(A.getRawMatrix());
+
+    ASSERT_EQ(A.getNumberOfRows(), B.getNumberOfRows());
+    // One diagonal and two off-diagonal blocks per inner block row.
+    EXPECT_EQ(3u * 10 - 2, B.getNumberOfBlocks());
+    for (IndexType i = 0; i < 20; ++i)
+        for (IndexType j = 0; j < 20; ++j)
+            EXPECT_EQ(A.get(i, j), B.get(i, j));
+
+    Eigen::VectorXd const x = Eigen::VectorXd::LinSpaced(20, -1.0, 2.0);
+    Eigen::VectorXd y;
+    B.multiply(x, y);
+    Eigen::VectorXd const y_expected = A.getRawMatrix() * x;
+    EXPECT_LT((y - y_expected).norm(), 1e-14 * y_expected.norm());
+
+    auto const scalar_matrix = B.toScalarMatrix();
+    EXPECT_EQ(0.0, (Eigen::MatrixXd(scalar_matrix) -
+                    Eigen::MatrixXd(A.getRawMatrix()))
+                       .norm());
+}
+
+TEST(MathLibBlockCSRMatrix, AddLocalMatrix)
+{
+    std::vector<std::vector<IndexType>> const block_columns = {
+        {0, 1}, {0, 1, 2}, {1, 2}};
+    MathLib::BlockCSRMatrix<2> B(block_columns);
+    MathLib::EigenMatrix A(6);
+
+    // Local indices of the nodes 2 and 1 ordered by component.
+    std::vector<IndexType> const indices = {4, 2, 5, 3};
+    Eigen::Matrix4d local_matrix;
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            local_matrix(i, j) = 10 * i + j;
+
+    MathLib::RowColumnIndices<IndexType> const rc(indices, indices);
+    B.add(rc, local_matrix, 0.5);
+    A.add(rc, local_matrix, 0.5);
+
+    for (IndexType i = 0; i < 6; ++i)
+        for (IndexType j = 0; j < 6; ++j)
+            EXPECT_EQ(A.get(i, j), B.get(i, j));
+
+    B.setZero();
+    EXPECT_EQ(0.0, B.get(4, 3));
+    EXPECT_EQ(7u, B.getNumberOfBlocks());
+}
+
+TEST(MathLibBlockCSRMatrix, PreconditionedSolvers)
+{
+    auto const A = createChainMatrix(50);
+    MathLib::BlockCSRMatrix<2> const B(A.getRawMatrix());
+
+    Eigen::VectorXd const x_expected = Eigen::VectorXd::LinSpaced(100, 0, 1);
+    Eigen::VectorXd const b = A.getRawMatrix() * x_expected;
+
+    MathLib::EigenOption option;
+    option.error_tolerance = 1e-12;
+    option.max_iterations = 1000;
+
+    MathLib::BlockJacobiPreconditioner<2> jacobi;
+    jacobi.compute(B);
+    Eigen::VectorXd x = Eigen::VectorXd::Zero(100);
+    ASSERT_TRUE(MathLib::solveCG(B, jacobi, b, x, option));
+    EXPECT_LT((x - x_expected).norm(), 1e-8);
+
+    // The block tridiagonal matrix has no fill-in, i.e. ILU(0) is exact.
+    MathLib::BlockILU0Preconditioner<2> ilu;
+    ilu.compute(B);
+    Eigen::VectorXd z;
+    ilu.apply(b, z);
+    EXPECT_LT((z - x_expected).norm(), 1e-10);
+
+    x.setZero();
+    ASSERT_TRUE(MathLib::solveBiCGSTAB(B, ilu, b, x, option));
+    EXPECT_LT((x - x_expected).norm(), 1e-10);
+}
+
+TEST(MathLibBlockCSRMatrix, CopyValues)
+{
+    auto A = createChainMatrix(10);
+    MathLib::BlockCSRMatrix<2> B(A.getRawMatrix());
+
+    // New values within the same pattern are copied without changing it.
+    A.getRawMatrix() *= 3.0;
+    A.add(4, 7, 1.0);
+    ASSERT_TRUE(B.copyValues(A.getRawMatrix()));
+    EXPECT_EQ(3u * 10 - 2, B.getNumberOfBlocks());
+    for (IndexType i = 0; i < 20; ++i)
+        for (IndexType j = 0; j < 20; ++j)
+            EXPECT_EQ(A.get(i, j), B.get(i, j));
+
+    // An entry outside of the block pattern.
+    A.add(0, 19, 1.0);
+    EXPECT_FALSE(B.copyValues(A.getRawMatrix()));
+
+    // A matrix of a different size.
+    EXPECT_FALSE(B.copyValues(createChainMatrix(11).getRawMatrix()));
+}
+
+TEST(MathLibBlockCSRMatrix, ReleaseValues)
+{
+    auto A = createChainMatrix(10);
+    MathLib::BlockCSRMatrix<2> B(A.getRawMatrix());
+    auto const n_blocks = B.getNumberOfBlocks();
+
+    // The pattern is kept and the values are restored by the next copy.
+    B.releaseValues();
+    EXPECT_EQ(n_blocks, B.getNumberOfBlocks());
+    ASSERT_TRUE(B.copyValues(A.getRawMatrix()));
+    for (IndexType i = 0; i < 20; ++i)
+        for (IndexType j = 0; j < 20; ++j)
+            EXPECT_EQ(A.get(i, j), B.get(i, j));
+}
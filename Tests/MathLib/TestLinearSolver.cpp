@@ -13,6 +13,8 @@
  *
  */
 
+#include <cmath>
+
 #include <gtest/gtest.h>
 
 #include "MathLib/LinAlg/LinAlg.h"
@@ -227,6 +229,209 @@ TEST(Math, CheckInterface_Eigen)
 }
 #endif
 
+#ifdef OGS_USE_EIGEN
+TEST(Math, CheckInterface_EigenBlock)
+{
+    using IntType = MathLib::EigenMatrix::IndexType;
+
+    for (auto const& solver_precon : {std::make_pair("CG", "DIAGONAL"),
+                                      std::make_pair("BiCGSTAB", "ILUT")})
+    {
+        boost::property_tree::ptree t_root;
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", solver_precon.first);
+        t_solver.put("precon_type", solver_precon.second);
+        t_solver.put("error_tolerance", 1e-15);
+        t_solver.put("max_iteration_step", 1000);
+        t_solver.put("block_size", 3);
+        t_root.put_child("eigen", t_solver);
+        BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                                 BaseLib::ConfigTree::onwarning);
+
+        MathLib::EigenMatrix A(Example1<IntType>::dim_eqs);
+        checkLinearSolverInterface<MathLib::EigenMatrix, MathLib::EigenVector,
+                                   MathLib::EigenLinearSolver, IntType>(A,
+                                                                        conf);
+    }
+}
+#endif
+
+#ifdef OGS_USE_EIGEN
+TEST(Math, EigenBlockRejectsInvalidOptions)
+{
+    // Only CG and BiCGSTAB work on block matrices, with block sizes up to 4.
+    for (auto const& solver_block : {std::make_pair("GMRES", 3),
+                                     std::make_pair("SparseLU", 2),
+                                     std::make_pair("CG", 5)})
+    {
+        boost::property_tree::ptree t_root;
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", solver_block.first);
+        t_solver.put("block_size", solver_block.second);
+        t_root.put_child("eigen", t_solver);
+        BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                                 BaseLib::ConfigTree::onwarning);
+        EXPECT_ANY_THROW(MathLib::EigenLinearSolver("dummy_name", &conf));
+    }
+}
+#endif
+
+#ifdef OGS_USE_EIGEN
+TEST(Math, CheckInterface_EigenMixedPrecision)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    t_solver.put("precon_type", "NONE");
+    t_solver.put("mixed_precision", true);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+
+    using IntType = MathLib::EigenMatrix::IndexType;
+
+    MathLib::EigenMatrix A(Example1<IntType>::dim_eqs);
+    checkLinearSolverInterface<MathLib::EigenMatrix, MathLib::EigenVector,
+                               MathLib::EigenLinearSolver, IntType>(A, conf);
+}
+
+TEST(Math, EigenMixedPrecisionAccuracy)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    t_solver.put("precon_type", "NONE");
+    t_solver.put("mixed_precision", true);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+    // 1D Laplacian with coefficients varying over several orders of magnitude.
+    // The matrix is solved twice with the same pattern and different values to
+    // exercise the reuse of the symbolic analysis.
+    const int n = 200;
+    for (double const factor : {1.0, 3.0})
+    {
+        MathLib::EigenMatrix A(n);
+        for (int i = 0; i < n; ++i)
+        {
+            double const k = factor * std::pow(10.0, 4.0 * i / n);
+            A.add(i, i, 2.5 * k);
+            if (i > 0)
+                A.add(i, i - 1, -k);
+            if (i < n - 1)
+                A.add(i, i + 1, -k);
+        }
+        MathLib::finalizeMatrixAssembly(A);
+
+        MathLib::EigenVector x_exact(n);
+        for (int i = 0; i < n; ++i)
+            x_exact.getRawVector()[i] = std::sin(0.1 * i) + 1.0;
+        MathLib::EigenVector b(n);
+        b.getRawVector() = A.getRawMatrix() * x_exact.getRawVector();
+
+        MathLib::EigenVector x(n);
+        ASSERT_TRUE(ls.solve(A, b, x));
+        EXPECT_LT((x.getRawVector() - x_exact.getRawVector())
+                      .lpNorm<Eigen::Infinity>(),
+                  1e-12);
+    }
+}
+
+TEST(Math, EigenMixedPrecisionOutOfSinglePrecisionRange)
+{
+    boost::property_tree::ptree t_root;
+    boost::property_tree::ptree t_solver;
+    t_solver.put("solver_type", "SparseLU");
+    t_solver.put("precon_type", "NONE");
+    t_solver.put("mixed_precision", true);
+    t_root.put_child("eigen", t_solver);
+    BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                             BaseLib::ConfigTree::onwarning);
+    MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+    // The entries overflow in single precision, which requires the fallback
+    // to the double precision factorization.
+    const int n = 20;
+    MathLib::EigenMatrix A(n);
+    for (int i = 0; i < n; ++i)
+    {
+        A.add(i, i, 2.5e40);
+        if (i > 0)
+            A.add(i, i - 1, -1e40);
+        if (i < n - 1)
+            A.add(i, i + 1, -1e40);
+    }
+    MathLib::finalizeMatrixAssembly(A);
+
+    MathLib::EigenVector x_exact(n);
+    for (int i = 0; i < n; ++i)
+        x_exact.getRawVector()[i] = std::sin(0.1 * i) + 1.0;
+    MathLib::EigenVector b(n);
+    b.getRawVector() = A.getRawMatrix() * x_exact.getRawVector();
+
+    MathLib::EigenVector x(n);
+    ASSERT_TRUE(ls.solve(A, b, x));
+    EXPECT_LT(
+        (x.getRawVector() - x_exact.getRawVector()).lpNorm<Eigen::Infinity>(),
+        1e-12);
+}
+
+TEST(Math, EigenSolveWithPreviousSetup)
+{
+    for (bool const mixed_precision : {false, true})
+    {
+        boost::property_tree::ptree t_root;
+        boost::property_tree::ptree t_solver;
+        t_solver.put("solver_type", "SparseLU");
+        t_solver.put("precon_type", "NONE");
+        t_solver.put("mixed_precision", mixed_precision);
+        t_root.put_child("eigen", t_solver);
+        BaseLib::ConfigTree conf(t_root, "", BaseLib::ConfigTree::onerror,
+                                 BaseLib::ConfigTree::onwarning);
+        MathLib::EigenLinearSolver ls("dummy_name", &conf);
+
+        const int n = 50;
+        MathLib::EigenMatrix A(n);
+        for (int i = 0; i < n; ++i)
+        {
+            A.add(i, i, 2.5);
+            if (i > 0)
+                A.add(i, i - 1, -1.0);
+            if (i < n - 1)
+                A.add(i, i + 1, -1.0);
+        }
+        MathLib::finalizeMatrixAssembly(A);
+
+        // The first call has no previous setup and solves from scratch, the
+        // second one reuses the factorization for a different right-hand side.
+        for (double const shift : {1.0, 2.0})
+        {
+            MathLib::EigenVector x_exact(n);
+            for (int i = 0; i < n; ++i)
+                x_exact.getRawVector()[i] = std::sin(0.1 * i) + shift;
+            MathLib::EigenVector b(n);
+            b.getRawVector() = A.getRawMatrix() * x_exact.getRawVector();
+
+            MathLib::EigenVector x(n);
+            ASSERT_TRUE(ls.solveWithPreviousSetup(A, b, x));
+            EXPECT_LT((x.getRawVector() - x_exact.getRawVector())
+                          .lpNorm<Eigen::Infinity>(),
+                      1e-12);
+            EXPECT_EQ(1u, ls.getNumberOfSetups());
+        }
+
+        // A different matrix object is factorized again.
+        MathLib::EigenMatrix B(A);
+        MathLib::EigenVector b(n);
+        MathLib::EigenVector x(n);
+        ASSERT_TRUE(ls.solveWithPreviousSetup(B, b, x));
+        EXPECT_EQ(2u, ls.getNumberOfSetups());
+    }
+}
+#endif
+
 #if defined(OGS_USE_EIGEN) && defined(USE_LIS)
 TEST(Math, CheckInterface_EigenLis)
 {
@@ -12,6 +12,8 @@
  */
 
 // stl
+#include <algorithm>
+#include <cmath>
 #include <limits>
 
 // google test
@@ -163,3 +165,49 @@ TEST(MathLibInterpolationAlgorithms, PiecewiseLinearInterpolationDerivative)
     ASSERT_NEAR(0, interpolation.getDerivative(1001),
                 std::numeric_limits<double>::epsilon());
 }
+
+TEST(MathLibInterpolationAlgorithms,
+     PiecewiseLinearInterpolationClusteredSupportPoints)
+{
+    // Logarithmically spaced support points cluster at the lower end of the
+    // range, like typical capillary pressure curves.
+    const std::size_t size(2000);
+    std::vector<double> supp_pnts, values;
+    for (std::size_t k(0); k < size; ++k)
+    {
+        supp_pnts.push_back(std::pow(10.0, -6.0 + 8.0 * k / (size - 1)));
+        values.push_back(std::sin(static_cast<double>(k)));
+    }
+    std::vector<double> const x(supp_pnts);
+    std::vector<double> const y(values);
+
+    MathLib::PiecewiseLinearInterpolation interpolation{
+        std::move(supp_pnts), std::move(values), true};
+
+    auto const expected_value = [&](double const p) {
+        if (p <= x.front())
+            return y.front();
+        if (x.back() <= p)
+            return y.back();
+        auto const i = std::distance(
+            x.begin(), std::lower_bound(x.begin(), x.end(), p)) - 1;
+        return (y[i + 1] - y[i]) / (x[i + 1] - x[i]) * (p - x[i]) + y[i];
+    };
+
+    std::vector<double> pnts;
+    for (double p = 1e-7; p < 1e3; p *= 1.0137)
+        pnts.push_back(p);
+    // Support points themselves and unsorted points.
+    pnts.insert(pnts.end(), x.begin(), x.end());
+    pnts.insert(pnts.end(), x.rbegin(), x.rend());
+
+    std::vector<double> batch_values;
+    interpolation.getValues(pnts, batch_values);
+    ASSERT_EQ(pnts.size(), batch_values.size());
+
+    for (std::size_t i = 0; i < pnts.size(); ++i)
+    {
+        ASSERT_EQ(expected_value(pnts[i]), interpolation.getValue(pnts[i]));
+        ASSERT_EQ(expected_value(pnts[i]), batch_values[i]);
+    }
+}
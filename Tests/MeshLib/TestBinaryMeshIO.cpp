@@ -0,0 +1,204 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cstdint>
+#include <cstdio>
+#include <fstream>
+#include <memory>
+#include <numeric>
+#include <string>
+
+#include <gtest/gtest.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/BinaryIO/BinaryMeshReader.h"
+#include "MeshLib/IO/BinaryIO/BinaryMeshWriter.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+class BinaryMeshIOTest : public ::testing::Test
+{
+public:
+    BinaryMeshIOTest()
+        : mesh(MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 2.0, 3.0,
+                                                                3, 4, 5))
+    {
+        auto* const pressure =
+            mesh->getProperties().createNewPropertyVector<double>(
+                "pressure", MeshLib::MeshItemType::Node, 1);
+        pressure->resize(mesh->getNumberOfNodes());
+        std::iota(pressure->begin(), pressure->end(), 0.5);
+
+        auto* const velocity =
+            mesh->getProperties().createNewPropertyVector<float>(
+                "velocity", MeshLib::MeshItemType::Cell, 3);
+        velocity->resize(3 * mesh->getNumberOfElements());
+        std::iota(velocity->begin(), velocity->end(), 1.0f);
+
+        auto* const material_ids =
+            mesh->getProperties().createNewPropertyVector<int>(
+                "MaterialIDs", MeshLib::MeshItemType::Cell, 1);
+        material_ids->resize(mesh->getNumberOfElements());
+        std::iota(material_ids->begin(), material_ids->end(), -3);
+
+        auto* const bulk_ids =
+            mesh->getProperties().createNewPropertyVector<std::size_t>(
+                "bulk_node_ids", MeshLib::MeshItemType::Node, 1);
+        bulk_ids->resize(mesh->getNumberOfNodes());
+        std::iota(bulk_ids->begin(), bulk_ids->end(), 7);
+    }
+
+    ~BinaryMeshIOTest() override { std::remove(file_name.c_str()); }
+
+    template <typename T>
+    void checkProperty(MeshLib::Mesh const& read_mesh,
+                       std::string const& name) const
+    {
+        auto const& expected =
+            *mesh->getProperties().getPropertyVector<T>(name);
+        ASSERT_TRUE(read_mesh.getProperties().existsPropertyVector<T>(name));
+        auto const& p = *read_mesh.getProperties().getPropertyVector<T>(name);
+        ASSERT_EQ(expected.getMeshItemType(), p.getMeshItemType());
+        ASSERT_EQ(expected.getNumberOfComponents(), p.getNumberOfComponents());
+        ASSERT_EQ(expected.size(), p.size());
+        for (std::size_t i = 0; i < p.size(); ++i)
+            ASSERT_EQ(expected[i], p[i]);
+    }
+
+    void checkMesh(MeshLib::Mesh const& read_mesh) const
+    {
+        ASSERT_EQ(mesh->getName(), read_mesh.getName());
+        ASSERT_EQ(mesh->getNumberOfNodes(), read_mesh.getNumberOfNodes());
+        ASSERT_EQ(mesh->getNumberOfElements(),
+                  read_mesh.getNumberOfElements());
+        for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+            for (int k = 0; k < 3; ++k)
+                ASSERT_EQ((*mesh->getNode(i))[k], (*read_mesh.getNode(i))[k]);
+        for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+        {
+            auto const& expected = *mesh->getElement(e);
+            auto const& element = *read_mesh.getElement(e);
+            ASSERT_EQ(expected.getCellType(), element.getCellType());
+            for (unsigned k = 0; k < expected.getNumberOfNodes(); ++k)
+                ASSERT_EQ(expected.getNodeIndex(k), element.getNodeIndex(k));
+        }
+    }
+
+    std::unique_ptr<MeshLib::Mesh> mesh;
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "BinaryMeshIOTest.ogsmesh";
+};
+
+TEST_F(BinaryMeshIOTest, Roundtrip)
+{
+    for (bool const compress : {false, true})
+    {
+        ASSERT_TRUE(MeshLib::IO::writeBinaryMesh(*mesh, file_name, compress));
+
+        std::unique_ptr<MeshLib::Mesh> read_mesh(
+            MeshLib::IO::readBinaryMesh(file_name));
+        ASSERT_TRUE(read_mesh != nullptr);
+        checkMesh(*read_mesh);
+        checkProperty<double>(*read_mesh, "pressure");
+        checkProperty<float>(*read_mesh, "velocity");
+        checkProperty<int>(*read_mesh, "MaterialIDs");
+        checkProperty<std::size_t>(*read_mesh, "bulk_node_ids");
+    }
+}
+
+TEST_F(BinaryMeshIOTest, LazyPropertyReading)
+{
+    ASSERT_TRUE(MeshLib::IO::writeBinaryMesh(*mesh, file_name, true));
+
+    MeshLib::IO::BinaryMeshReader const reader(file_name);
+    ASSERT_TRUE(reader.good());
+    EXPECT_EQ(mesh->getNumberOfNodes(), reader.getNumberOfNodes());
+    EXPECT_EQ(mesh->getNumberOfElements(), reader.getNumberOfElements());
+    EXPECT_EQ(4u, reader.getPropertyNames().size());
+
+    std::unique_ptr<MeshLib::Mesh> read_mesh(reader.readMesh({"MaterialIDs"}));
+    ASSERT_TRUE(read_mesh != nullptr);
+    checkMesh(*read_mesh);
+    checkProperty<int>(*read_mesh, "MaterialIDs");
+    EXPECT_FALSE(read_mesh->getProperties().hasPropertyVector("pressure"));
+
+    ASSERT_TRUE(reader.readProperty("pressure", read_mesh->getProperties()));
+    checkProperty<double>(*read_mesh, "pressure");
+    EXPECT_FALSE(reader.readProperty("unknown", read_mesh->getProperties()));
+}
+
+TEST_F(BinaryMeshIOTest, InvalidFile)
+{
+    {
+        std::ofstream out(file_name, std::ios::binary);
+        out << "This is not a mesh file, but it is long enough to contain a "
+               "header of the binary mesh format.";
+    }
+    MeshLib::IO::BinaryMeshReader const reader(file_name);
+    EXPECT_FALSE(reader.good());
+    EXPECT_EQ(nullptr, reader.readMesh());
+}
+
+TEST_F(BinaryMeshIOTest, InvalidPropertySize)
+{
+    namespace Format = MeshLib::IO::BinaryMeshFormat;
+    ASSERT_TRUE(MeshLib::IO::writeBinaryMesh(*mesh, file_name, false));
+
+    // Shrinks the "pressure" section, the only Float64 property, by the given
+    // number of bytes without changing the mesh sizes in the header.
+    auto const truncate_pressure = [this](std::uint64_t const n_bytes) {
+        std::fstream file(file_name,
+                          std::ios::binary | std::ios::in | std::ios::out);
+        Format::Header header;
+        file.read(reinterpret_cast<char*>(&header), sizeof(header));
+        for (std::uint64_t i = 0; i < header.n_sections; ++i)
+        {
+            auto const position =
+                header.section_table_offset + i * sizeof(Format::Section);
+            Format::Section section;
+            file.seekg(position);
+            file.read(reinterpret_cast<char*>(&section), sizeof(section));
+            if (section.kind != Format::SectionKind::Property ||
+                section.value_type != Format::ValueType::Float64)
+                continue;
+            section.raw_size -= n_bytes;
+            section.stored_size -= n_bytes;
+            file.seekp(position);
+            file.write(reinterpret_cast<char const*>(&section),
+                       sizeof(section));
+        }
+    };
+
+    // Not a multiple of the value size.
+    truncate_pressure(3);
+    {
+        MeshLib::IO::BinaryMeshReader const reader(file_name);
+        ASSERT_TRUE(reader.good());
+        EXPECT_EQ(nullptr, reader.readMesh({"pressure"}));
+
+        MeshLib::Properties properties;
+        EXPECT_FALSE(reader.readProperty("pressure", properties));
+        EXPECT_FALSE(properties.hasPropertyVector("pressure"));
+    }
+
+    // Whole values, but fewer than nodes.
+    truncate_pressure(5);
+    {
+        MeshLib::IO::BinaryMeshReader const reader(file_name);
+        ASSERT_TRUE(reader.good());
+        EXPECT_EQ(nullptr, reader.readMesh({"pressure"}));
+
+        std::unique_ptr<MeshLib::Mesh> read_mesh(
+            reader.readMesh({"MaterialIDs"}));
+        ASSERT_TRUE(read_mesh != nullptr);
+        checkProperty<int>(*read_mesh, "MaterialIDs");
+    }
+}
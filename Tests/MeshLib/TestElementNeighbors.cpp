@@ -0,0 +1,141 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Elements/LocalTopology.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/QuadraticMeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+bool isNeighbor(MeshLib::Element const& element,
+                MeshLib::Element const* const other)
+{
+    for (unsigned i = 0; i < element.getNumberOfNeighbors(); ++i)
+        if (element.getNeighbor(i) == other)
+            return true;
+    return false;
+}
+
+/// Checks the neighbors against a brute force search over all elements
+/// sharing at least dim base nodes.
+void checkNeighbors(MeshLib::Mesh const& mesh)
+{
+    for (auto const* element : mesh.getElements())
+    {
+        std::size_t n_expected = 0;
+        for (auto const* other : mesh.getElements())
+        {
+            if (other == element ||
+                other->getDimension() != element->getDimension())
+                continue;
+            unsigned shared = 0;
+            for (unsigned i = 0; i < element->getNumberOfBaseNodes(); ++i)
+                for (unsigned j = 0; j < other->getNumberOfBaseNodes(); ++j)
+                    if (element->getNode(i) == other->getNode(j))
+                        ++shared;
+            if (shared >= element->getDimension())
+            {
+                ++n_expected;
+                EXPECT_TRUE(isNeighbor(*element, other));
+            }
+        }
+
+        std::size_t n_neighbors = 0;
+        for (unsigned i = 0; i < element->getNumberOfNeighbors(); ++i)
+        {
+            auto const* neighbor = element->getNeighbor(i);
+            if (!neighbor)
+                continue;
+            ++n_neighbors;
+            // The relation is symmetric.
+            EXPECT_TRUE(isNeighbor(*neighbor, element));
+        }
+        EXPECT_EQ(n_expected, n_neighbors);
+    }
+}
+}  // namespace
+
+TEST(MeshLib, ElementNeighborsLineMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(1.0, 7));
+    checkNeighbors(*mesh);
+    EXPECT_EQ(nullptr, mesh->getElement(0)->getNeighbor(0));
+    EXPECT_EQ(mesh->getElement(1), mesh->getElement(0)->getNeighbor(1));
+}
+
+TEST(MeshLib, ElementNeighborsTriMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularTriMesh(1.0, 4));
+    checkNeighbors(*mesh);
+}
+
+TEST(MeshLib, ElementNeighborsHexMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 4));
+    checkNeighbors(*mesh);
+}
+
+TEST(MeshLib, ElementNeighborsPrismMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 1.0, 1.0, 3, 3,
+                                                         3));
+    checkNeighbors(*mesh);
+}
+
+TEST(MeshLib, ElementNeighborsQuadraticQuadMesh)
+{
+    std::unique_ptr<MeshLib::Mesh> linear_mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+    auto const mesh = MeshLib::createQuadraticOrderMesh(*linear_mesh);
+    checkNeighbors(*mesh);
+}
+
+// The first element is a quad with two identical nodes. The local topology
+// must not depend on the element it is computed from.
+TEST(MeshLib, ElementNeighborsDegenerateFirstElement)
+{
+    std::vector<MeshLib::Node*> nodes{
+        new MeshLib::Node(0, 0, 0, 0), new MeshLib::Node(1, 0, 0, 1),
+        new MeshLib::Node(1, 1, 0, 2), new MeshLib::Node(0, 1, 0, 3),
+        new MeshLib::Node(2, 0, 0, 4), new MeshLib::Node(2, 1, 0, 5),
+        new MeshLib::Node(0.5, 2, 0, 6)};
+    std::vector<MeshLib::Element*> elements{
+        new MeshLib::Quad(std::array<MeshLib::Node*, 4>{
+            {nodes[3], nodes[2], nodes[6], nodes[6]}}),
+        new MeshLib::Quad(std::array<MeshLib::Node*, 4>{
+            {nodes[0], nodes[1], nodes[2], nodes[3]}}),
+        new MeshLib::Quad(std::array<MeshLib::Node*, 4>{
+            {nodes[1], nodes[4], nodes[5], nodes[2]}})};
+
+    auto const degenerate = MeshLib::computeLocalTopology(*elements[0]);
+    auto const regular = MeshLib::computeLocalTopology(*elements[1]);
+    ASSERT_EQ(regular.edges.size(), degenerate.edges.size());
+    for (std::size_t i = 0; i < regular.edges.size(); ++i)
+        EXPECT_EQ(regular.edges[i].nodes, degenerate.edges[i].nodes);
+    EXPECT_EQ(regular.neighbor_faces, degenerate.neighbor_faces);
+
+    MeshLib::Mesh const mesh("degenerate", nodes, elements);
+    checkNeighbors(mesh);
+    EXPECT_TRUE(isNeighbor(*mesh.getElement(1), mesh.getElement(0)));
+    EXPECT_TRUE(isNeighbor(*mesh.getElement(1), mesh.getElement(2)));
+}
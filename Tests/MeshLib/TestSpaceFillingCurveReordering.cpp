@@ -0,0 +1,118 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/MathTools.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshEditing/SpaceFillingCurveReordering.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+bool isPermutation(std::vector<std::size_t> ordering, std::size_t const n)
+{
+    std::vector<std::size_t> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::sort(ordering.begin(), ordering.end());
+    return ordering == expected;
+}
+}  // namespace
+
+TEST(MeshLibSpaceFillingCurve, HilbertCurveVisitsNeighbouringGridPoints)
+{
+    // The points of an 8x8x8 grid fall into distinct cells of the third
+    // refinement level of the curve, hence consecutive points are neighbours.
+    std::vector<MathLib::Point3d> points;
+    for (int k = 0; k < 8; ++k)
+        for (int j = 0; j < 8; ++j)
+            for (int i = 0; i < 8; ++i)
+                points.emplace_back(std::array<double, 3>{{
+                    static_cast<double>(i), static_cast<double>(j),
+                    static_cast<double>(k)}});
+
+    auto const ordering = MeshLib::computeSpaceFillingCurveOrdering(
+        points, MeshLib::SpaceFillingCurve::Hilbert);
+    ASSERT_TRUE(isPermutation(ordering, points.size()));
+    for (std::size_t k = 1; k < ordering.size(); ++k)
+        ASSERT_EQ(1.0, MathLib::sqrDist(points[ordering[k - 1]],
+                                        points[ordering[k]]));
+
+    auto const morton_ordering = MeshLib::computeSpaceFillingCurveOrdering(
+        points, MeshLib::SpaceFillingCurve::Morton);
+    ASSERT_TRUE(isPermutation(morton_ordering, points.size()));
+    // The Morton curve starts with the first octant of the first octant.
+    EXPECT_EQ(0u, morton_ordering[0]);
+    EXPECT_EQ(1u, morton_ordering[1]);
+    EXPECT_EQ(8u, morton_ordering[2]);
+    EXPECT_EQ(9u, morton_ordering[3]);
+    EXPECT_EQ(64u, morton_ordering[4]);
+}
+
+TEST(MeshLibSpaceFillingCurve, ReorderedMeshKeepsGeometryAndProperties)
+{
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 5));
+
+    auto* const node_ids =
+        mesh->getProperties().createNewPropertyVector<std::size_t>(
+            "node_ids", MeshLib::MeshItemType::Node, 1);
+    node_ids->resize(mesh->getNumberOfNodes());
+    std::iota(node_ids->begin(), node_ids->end(), 0);
+
+    auto* const element_ids =
+        mesh->getProperties().createNewPropertyVector<double>(
+            "element_ids", MeshLib::MeshItemType::Cell, 2);
+    element_ids->resize(2 * mesh->getNumberOfElements());
+    std::iota(element_ids->begin(), element_ids->end(), 0);
+
+    auto const reordered_mesh = MeshLib::reorderMeshAlongSpaceFillingCurve(
+        *mesh, MeshLib::SpaceFillingCurve::Hilbert);
+    ASSERT_EQ(mesh->getNumberOfNodes(), reordered_mesh->getNumberOfNodes());
+    ASSERT_EQ(mesh->getNumberOfElements(),
+              reordered_mesh->getNumberOfElements());
+    EXPECT_EQ(mesh->getName(), reordered_mesh->getName());
+
+    auto const& new_node_ids =
+        *reordered_mesh->getProperties().getPropertyVector<std::size_t>(
+            "node_ids");
+    ASSERT_TRUE(isPermutation(
+        std::vector<std::size_t>(new_node_ids.begin(), new_node_ids.end()),
+        mesh->getNumberOfNodes()));
+    for (auto const* node : reordered_mesh->getNodes())
+    {
+        auto const* const original = mesh->getNode(new_node_ids[node->getID()]);
+        for (int k = 0; k < 3; ++k)
+            ASSERT_EQ((*original)[k], (*node)[k]);
+    }
+
+    auto const& new_element_ids =
+        *reordered_mesh->getProperties().getPropertyVector<double>(
+            "element_ids");
+    for (auto const* element : reordered_mesh->getElements())
+    {
+        auto const original_id = static_cast<std::size_t>(
+            new_element_ids[2 * element->getID()] / 2);
+        ASSERT_EQ(2 * original_id + 1,
+                  new_element_ids[2 * element->getID() + 1]);
+        auto const& original = *mesh->getElement(original_id);
+        ASSERT_EQ(original.getCellType(), element->getCellType());
+        for (unsigned i = 0; i < element->getNumberOfNodes(); ++i)
+            ASSERT_EQ(original.getNodeIndex(i),
+                      new_node_ids[element->getNodeIndex(i)]);
+    }
+}
@@ -0,0 +1,101 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <array>
+#include <memory>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshGenerators/QuadraticMeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+void checkView(MeshLib::SubElementView const& view,
+               MeshLib::Element const& sub_element)
+{
+    EXPECT_EQ(sub_element.getCellType(), view.getCellType());
+    EXPECT_EQ(sub_element.getNumberOfBaseNodes(), view.getNumberOfBaseNodes());
+    ASSERT_EQ(sub_element.getNumberOfNodes(), view.getNumberOfNodes());
+    for (unsigned i = 0; i < view.getNumberOfNodes(); ++i)
+        EXPECT_EQ(sub_element.getNode(i), view.getNode(i));
+}
+
+/// Compares the views of all elements with the edges and faces created by
+/// Element::getEdge() and Element::getFace().
+void checkViews(MeshLib::Mesh const& mesh)
+{
+    for (auto const* element : mesh.getElements())
+    {
+        for (unsigned i = 0; i < element->getNumberOfEdges(); ++i)
+        {
+            std::unique_ptr<MeshLib::Element const> const edge(
+                element->getEdge(i));
+            checkView(element->getEdgeView(i), *edge);
+        }
+        for (unsigned i = 0; i < element->getNumberOfFaces(); ++i)
+        {
+            std::unique_ptr<MeshLib::Element const> const face(
+                element->getFace(i));
+            checkView(element->getFaceView(i), *face);
+        }
+    }
+}
+}  // namespace
+
+TEST(MeshLib, SubElementViewsLinearElements)
+{
+    checkViews(*std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(2, 2)));
+    checkViews(*std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularTriMesh(2, 2)));
+    checkViews(*std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularHexMesh(2, 2)));
+    checkViews(*std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularPrismMesh(1.0, 1.0, 1.0, 2, 2,
+                                                         2)));
+    checkViews(*std::unique_ptr<MeshLib::Mesh>(
+        MeshLib::MeshGenerator::generateRegularTetMesh(1.0, 1.0, 1.0, 2, 2,
+                                                       2)));
+}
+
+TEST(MeshLib, SubElementViewsQuadraticElements)
+{
+    std::unique_ptr<MeshLib::Mesh> const quad(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(2, 2));
+    checkViews(*MeshLib::createQuadraticOrderMesh(*quad));
+
+    std::unique_ptr<MeshLib::Mesh> const hex(
+        MeshLib::MeshGenerator::generateRegularHexMesh(2, 2));
+    checkViews(*MeshLib::createQuadraticOrderMesh(*hex));
+}
+
+TEST(MeshLib, SubElementViewsDegenerateElement)
+{
+    // A quad collapsed to a triangle, as found in meshes before MeshRevision.
+    std::array<MeshLib::Node, 3> nodes{{MeshLib::Node(0, 0, 0, 0),
+                                        MeshLib::Node(1, 0, 0, 1),
+                                        MeshLib::Node(0, 1, 0, 2)}};
+    MeshLib::Quad const quad(std::array<MeshLib::Node*, 4>{
+        {&nodes[0], &nodes[1], &nodes[2], &nodes[2]}});
+
+    for (unsigned i = 0; i < quad.getNumberOfEdges(); ++i)
+    {
+        std::unique_ptr<MeshLib::Element const> const edge(quad.getEdge(i));
+        checkView(quad.getEdgeView(i), *edge);
+    }
+    // The local numbers are those of the reference element.
+    EXPECT_EQ(2u, quad.getEdgeView(2).getLocalNodeIDs()[0]);
+    EXPECT_EQ(3u, quad.getEdgeView(2).getLocalNodeIDs()[1]);
+    EXPECT_EQ(0.0, quad.getEdgeView(2).getLength());
+}
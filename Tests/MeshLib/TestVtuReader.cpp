@@ -0,0 +1,335 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+#include <vtk_zlib.h>
+
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/VtkIO/VtuReader.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+std::string encodeBase64(std::vector<unsigned char> const& bytes)
+{
+    char const* const chars =
+        "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    std::string encoded;
+    for (std::size_t i = 0; i < bytes.size(); i += 3)
+    {
+        unsigned const b0 = bytes[i];
+        unsigned const b1 = i + 1 < bytes.size() ? bytes[i + 1] : 0;
+        unsigned const b2 = i + 2 < bytes.size() ? bytes[i + 2] : 0;
+        encoded += chars[b0 >> 2];
+        encoded += chars[((b0 & 3) << 4) | (b1 >> 4)];
+        encoded += i + 1 < bytes.size() ? chars[((b1 & 15) << 2) | (b2 >> 6)]
+                                        : '=';
+        encoded += i + 2 < bytes.size() ? chars[b2 & 63] : '=';
+    }
+    return encoded;
+}
+
+template <typename T>
+std::vector<unsigned char> toBytes(std::vector<T> const& values)
+{
+    std::vector<unsigned char> bytes(values.size() * sizeof(T));
+    std::memcpy(bytes.data(), values.data(), bytes.size());
+    return bytes;
+}
+
+void appendHeaderValue(std::vector<unsigned char>& bytes, std::uint64_t value)
+{
+    auto const* const p = reinterpret_cast<unsigned char const*>(&value);
+    bytes.insert(bytes.end(), p, p + 8);
+}
+
+/// Compresses the data in blocks of the given size as vtkZLibDataCompressor
+/// does using UInt64 headers. Returns the header and the compressed blocks.
+std::pair<std::vector<unsigned char>, std::vector<unsigned char>> compress(
+    std::vector<unsigned char> const& data, std::size_t const block_size)
+{
+    std::size_t const n_blocks = (data.size() + block_size - 1) / block_size;
+    std::vector<unsigned char> header;
+    appendHeaderValue(header, n_blocks);
+    appendHeaderValue(header, block_size);
+    appendHeaderValue(header, data.size() % block_size);
+
+    std::vector<unsigned char> blocks;
+    for (std::size_t b = 0; b < n_blocks; ++b)
+    {
+        std::size_t const size =
+            std::min(block_size, data.size() - b * block_size);
+        uLongf compressed_size = compressBound(size);
+        std::vector<unsigned char> block(compressed_size);
+        ::compress(block.data(), &compressed_size,
+                   data.data() + b * block_size, size);
+        blocks.insert(blocks.end(), block.begin(),
+                      block.begin() + compressed_size);
+        appendHeaderValue(header, compressed_size);
+    }
+    return {header, blocks};
+}
+
+// Two triangles and a quad in the plane z = 0.
+std::vector<double> const coordinates = {0, 0, 0, 1, 0, 0, 2, 0, 0,
+                                         0, 1, 0, 1, 1, 0, 2, 1, 0};
+std::vector<std::int64_t> const connectivity = {0, 1, 4, 0, 4, 3, 1, 2, 5, 4};
+std::vector<std::int64_t> const offsets = {3, 6, 10};
+std::vector<std::uint8_t> const types = {5, 5, 9};
+std::vector<double> const pressure = {1.5, 2.5, 3.5, 4.5, 5.5, 6.5};
+std::vector<std::uint32_t> const material_ids = {0, 1, 1};
+
+void checkMesh(MeshLib::Mesh const* const mesh)
+{
+    ASSERT_TRUE(mesh != nullptr);
+    ASSERT_EQ(6u, mesh->getNumberOfNodes());
+    ASSERT_EQ(3u, mesh->getNumberOfElements());
+    for (std::size_t i = 0; i < mesh->getNumberOfNodes(); ++i)
+        for (int k = 0; k < 3; ++k)
+            ASSERT_EQ(coordinates[3 * i + k], (*mesh->getNode(i))[k]);
+    EXPECT_EQ(MeshLib::MeshElemType::TRIANGLE,
+              mesh->getElement(0)->getGeomType());
+    EXPECT_EQ(MeshLib::MeshElemType::QUAD, mesh->getElement(2)->getGeomType());
+    for (std::size_t i = 0; i < connectivity.size() - 4; ++i)
+        EXPECT_EQ(connectivity[i],
+                  static_cast<std::int64_t>(
+                      mesh->getElement(i / 3)->getNodeIndex(i % 3)));
+    for (unsigned k = 0; k < 4; ++k)
+        EXPECT_EQ(connectivity[6 + k],
+                  static_cast<std::int64_t>(
+                      mesh->getElement(2)->getNodeIndex(k)));
+
+    auto const* const p =
+        mesh->getProperties().getPropertyVector<double>("pressure");
+    ASSERT_TRUE(p != nullptr);
+    ASSERT_EQ(pressure.size(), p->size());
+    for (std::size_t i = 0; i < pressure.size(); ++i)
+        EXPECT_EQ(pressure[i], (*p)[i]);
+
+    // UInt32 material ids are converted to int like in VtkMeshConverter.
+    auto const* const ids =
+        mesh->getProperties().getPropertyVector<int>("MaterialIDs");
+    ASSERT_TRUE(ids != nullptr);
+    ASSERT_EQ(material_ids.size(), ids->size());
+    for (std::size_t i = 0; i < material_ids.size(); ++i)
+        EXPECT_EQ(static_cast<int>(material_ids[i]), (*ids)[i]);
+}
+
+std::string const vtk_file_begin = R"(<?xml version="1.0"?>
+<!-- written by hand -->
+<VTKFile type="UnstructuredGrid" version="1.0" byte_order="LittleEndian")";
+
+class VtuReaderTest : public ::testing::Test
+{
+public:
+    ~VtuReaderTest() override { std::remove(file_name.c_str()); }
+
+    void writeFile(std::string const& content) const
+    {
+        std::ofstream out(file_name, std::ios::binary);
+        out << content;
+    }
+
+    std::string const file_name =
+        BaseLib::BuildInfo::tests_tmp_path + "VtuReaderTest.vtu";
+};
+}  // namespace
+
+TEST_F(VtuReaderTest, Ascii)
+{
+    writeFile(vtk_file_begin + R"(>
+  <UnstructuredGrid>
+    <Piece NumberOfPoints="6" NumberOfCells="3">
+      <PointData>
+        <DataArray type="Float64" Name="pressure" format="ascii">
+          1.5 2.5 3.5
+          4.5 5.5 6.5
+        </DataArray>
+      </PointData>
+      <CellData>
+        <DataArray type="UInt32" Name="MaterialIDs" format="ascii">0 1 1</DataArray>
+      </CellData>
+      <Points>
+        <DataArray type="Float32" NumberOfComponents="3" format="ascii">
+          0 0 0 1 0 0 2 0 0 0 1 0 1 1 0 2 1 0
+        </DataArray>
+      </Points>
+      <Cells>
+        <DataArray type="Int32" Name="connectivity" format="ascii">0 1 4 0 4 3 1 2 5 4</DataArray>
+        <DataArray type="Int32" Name="offsets" format="ascii">3 6 10</DataArray>
+        <DataArray type="UInt8" Name="types" format="ascii">5 5 9</DataArray>
+      </Cells>
+    </Piece>
+  </UnstructuredGrid>
+</VTKFile>
+)");
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::IO::readVTUFileNative(file_name));
+    checkMesh(mesh.get());
+    EXPECT_EQ("VtuReaderTest", mesh->getName());
+}
+
+TEST_F(VtuReaderTest, BinaryBase64)
+{
+    auto encode = [](std::vector<unsigned char> const& data) {
+        std::vector<unsigned char> bytes;
+        std::uint32_t const n = static_cast<std::uint32_t>(data.size());
+        auto const* const p = reinterpret_cast<unsigned char const*>(&n);
+        bytes.insert(bytes.end(), p, p + 4);
+        bytes.insert(bytes.end(), data.begin(), data.end());
+        return encodeBase64(bytes);
+    };
+
+    writeFile(vtk_file_begin + R"(>
+  <UnstructuredGrid>
+    <Piece NumberOfPoints="6" NumberOfCells="3">
+      <PointData>
+        <DataArray type="Float64" Name="pressure" format="binary">
+          )" + encode(toBytes(pressure)) + R"(
+        </DataArray>
+      </PointData>
+      <CellData>
+        <DataArray type="UInt32" Name="MaterialIDs" format="binary">)" +
+              encode(toBytes(material_ids)) + R"(</DataArray>
+      </CellData>
+      <Points>
+        <DataArray type="Float64" NumberOfComponents="3" format="binary">)" +
+              encode(toBytes(coordinates)) + R"(</DataArray>
+      </Points>
+      <Cells>
+        <DataArray type="Int64" Name="connectivity" format="binary">)" +
+              encode(toBytes(connectivity)) + R"(</DataArray>
+        <DataArray type="Int64" Name="offsets" format="binary">)" +
+              encode(toBytes(offsets)) + R"(</DataArray>
+        <DataArray type="UInt8" Name="types" format="binary">)" +
+              encode(toBytes(types)) + R"(</DataArray>
+      </Cells>
+    </Piece>
+  </UnstructuredGrid>
+</VTKFile>
+)");
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::IO::readVTUFileNative(file_name));
+    checkMesh(mesh.get());
+}
+
+TEST_F(VtuReaderTest, AppendedCompressed)
+{
+    for (bool const raw : {true, false})
+    {
+        // Small blocks yield several blocks decompressed in parallel.
+        std::string appended;
+        std::vector<std::size_t> array_offsets;
+        for (auto const& data :
+             {toBytes(pressure), toBytes(material_ids), toBytes(coordinates),
+              toBytes(connectivity), toBytes(offsets), toBytes(types)})
+        {
+            array_offsets.push_back(appended.size());
+            auto const compressed = compress(data, 16);
+            if (raw)
+            {
+                appended.append(compressed.first.begin(),
+                                compressed.first.end());
+                appended.append(compressed.second.begin(),
+                                compressed.second.end());
+            }
+            else
+            {
+                appended += encodeBase64(compressed.first);
+                appended += encodeBase64(compressed.second);
+            }
+        }
+
+        auto offset = [&array_offsets](std::size_t i) {
+            return std::to_string(array_offsets[i]);
+        };
+        writeFile(vtk_file_begin +
+                  R"( header_type="UInt64" compressor="vtkZLibDataCompressor">
+  <UnstructuredGrid>
+    <Piece NumberOfPoints="6" NumberOfCells="3">
+      <PointData>
+        <DataArray type="Float64" Name="pressure" format="appended" offset=")" +
+                  offset(0) + R"("/>
+      </PointData>
+      <CellData>
+        <DataArray type="UInt32" Name="MaterialIDs" format="appended" offset=")" +
+                  offset(1) + R"("/>
+      </CellData>
+      <Points>
+        <DataArray type="Float64" NumberOfComponents="3" format="appended" offset=")" +
+                  offset(2) + R"("/>
+      </Points>
+      <Cells>
+        <DataArray type="Int64" Name="connectivity" format="appended" offset=")" +
+                  offset(3) + R"("/>
+        <DataArray type="Int64" Name="offsets" format="appended" offset=")" +
+                  offset(4) + R"("/>
+        <DataArray type="UInt8" Name="types" format="appended" offset=")" +
+                  offset(5) + R"("/>
+      </Cells>
+    </Piece>
+  </UnstructuredGrid>
+  <AppendedData encoding=")" +
+                  (raw ? "raw" : "base64") + R"(">
+   _)" + appended + R"(
+  </AppendedData>
+</VTKFile>
+)");
+
+        std::unique_ptr<MeshLib::Mesh> mesh(
+            MeshLib::IO::readVTUFileNative(file_name));
+        checkMesh(mesh.get());
+    }
+}
+
+TEST_F(VtuReaderTest, UnsupportedFiles)
+{
+    // Big endian data and invalid cell types are left to the VTK reader.
+    writeFile(vtk_file_begin.substr(0, vtk_file_begin.find("LittleEndian")) +
+              R"(BigEndian">
+  <UnstructuredGrid>
+    <Piece NumberOfPoints="1" NumberOfCells="0"/>
+  </UnstructuredGrid>
+</VTKFile>
+)");
+    EXPECT_EQ(nullptr, MeshLib::IO::readVTUFileNative(file_name));
+
+    writeFile(vtk_file_begin + R"(>
+  <UnstructuredGrid>
+    <Piece NumberOfPoints="3" NumberOfCells="1">
+      <Points>
+        <DataArray type="Float64" NumberOfComponents="3" format="ascii">
+          0 0 0 1 0 0 0 1 0
+        </DataArray>
+      </Points>
+      <Cells>
+        <DataArray type="Int32" Name="connectivity" format="ascii">0 1 2</DataArray>
+        <DataArray type="Int32" Name="offsets" format="ascii">3</DataArray>
+        <DataArray type="UInt8" Name="types" format="ascii">7</DataArray>
+      </Cells>
+    </Piece>
+  </UnstructuredGrid>
+</VTKFile>
+)");
+    EXPECT_EQ(nullptr, MeshLib::IO::readVTUFileNative(file_name));
+}
@@ -281,3 +281,47 @@ TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_MultipleVariablesMultipleCompon
     ASSERT_EQ(1u, ele1_c2_indices.rows.size());
     ASSERT_EQ(20u, ele1_c2_indices.rows[0]);
 }
+
+#ifndef USE_PETSC
+TEST_F(NumLibLocalToGlobalIndexMapTest, InactiveElements)
+#else
+TEST_F(NumLibLocalToGlobalIndexMapTest, DISABLED_InactiveElements)
+#endif
+{
+    // Only the elements 0 to 3 and their nodes 0 to 4 are active. The trailing
+    // inactive elements must still have (empty) rows in the DOF table.
+    std::vector<MeshLib::Element*> const active_elements(
+        mesh->getElements().begin(), mesh->getElements().begin() + 4);
+    std::vector<MeshLib::Node*> const active_nodes(
+        mesh->getNodes().begin(), mesh->getNodes().begin() + 5);
+    auto const active_subset =
+        std::make_unique<MeshLib::MeshSubset>(*mesh, &active_nodes);
+
+    std::vector<MeshLib::MeshSubsets> active_components;
+    active_components.emplace_back(active_subset.get());
+    active_components.emplace_back(active_subset.get());
+
+    std::vector<unsigned> const vec_var_n_components{2};
+    std::vector<std::vector<MeshLib::Element*> const*> const vec_var_elements{
+        &active_elements};
+
+    dof_map = std::make_unique<NumLib::LocalToGlobalIndexMap>(
+        std::move(active_components), vec_var_n_components, vec_var_elements,
+        NumLib::ComponentOrder::BY_LOCATION);
+
+    ASSERT_EQ(10u, dof_map->dofSizeWithGhosts());
+    ASSERT_EQ(mesh->getNumberOfElements(), dof_map->size());
+
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+        ASSERT_EQ(e < 4 ? 4u : 0u, dof_map->getNumberOfElementDOF(e));
+
+    MeshLib::Location const l_node4(mesh->getID(), MeshLib::MeshItemType::Node,
+                                    4);
+    ASSERT_EQ(8, dof_map->getGlobalIndex(l_node4, 0, 0));
+    ASSERT_EQ(9, dof_map->getGlobalIndex(l_node4, 0, 1));
+
+    MeshLib::Location const l_node5(mesh->getID(), MeshLib::MeshItemType::Node,
+                                    5);
+    ASSERT_EQ(std::numeric_limits<GlobalIndexType>::max(),
+              dof_map->getGlobalIndex(l_node5, 0, 0));
+}
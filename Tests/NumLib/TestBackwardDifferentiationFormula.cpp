@@ -0,0 +1,123 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "NumLib/NumericsConfig.h"
+#include "NumLib/ODESolver/TimeDiscretization.h"
+
+namespace
+{
+struct NoInternalMatrixStorage final : public NumLib::InternalMatrixStorage
+{
+    void pushMatrices() const override {}
+};
+
+// Polynomial of the given degree and its derivative.
+double p(unsigned const degree, double const t)
+{
+    double value = 0.0;
+    for (unsigned i = 0; i <= degree; ++i)
+        value += (i + 1.0) * std::pow(t, i);
+    return value;
+}
+
+double dp(unsigned const degree, double const t)
+{
+    double value = 0.0;
+    for (unsigned i = 1; i <= degree; ++i)
+        value += i * (i + 1.0) * std::pow(t, i - 1.0);
+    return value;
+}
+
+double get(GlobalVector& x)
+{
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    return x.get(0);
+}
+}  // namespace
+
+// A BDF of order k differentiates polynomials of degree k exactly, also for
+// varying time step sizes, and its predictor extrapolates them exactly.
+TEST(NumLib, BackwardDifferentiationFormulaVariableStep)
+{
+    std::vector<double> const ts = {0.0, 0.1, 0.4, 0.5, 1.2, 1.3, 2.0, 2.05};
+    NoInternalMatrixStorage const strg;
+
+    for (unsigned k = 1; k <= 6; ++k)
+    {
+        NumLib::BackwardDifferentiationFormula bdf(k);
+
+        GlobalVector x(1);
+        x.set(0, p(k, ts[0]));
+        bdf.setInitialState(ts[0], x);
+
+        for (std::size_t n = 1; n < ts.size(); ++n)
+        {
+            double const t = ts[n];
+            bdf.nextTimestep(t, t - ts[n - 1]);
+            bdf.predictX(x);
+            if (n > k)
+            {
+                EXPECT_NEAR(p(k, t), get(x), 1e-9 * p(k, t));
+            }
+
+            x.set(0, p(k, t));
+            if (n >= k)
+            {
+                GlobalVector xdot(1);
+                bdf.getXdot(x, xdot);
+                EXPECT_NEAR(dp(k, t), get(xdot), 1e-8 * dp(k, t));
+            }
+
+            if (n > k)
+            {
+                // the local truncation error of an exact solution vanishes
+                GlobalVector error(1);
+                EXPECT_EQ(k, bdf.estimateLocalTruncationError(x, error));
+                EXPECT_NEAR(0.0, get(error), 1e-9 * p(k, t));
+            }
+            bdf.pushState(t, x, strg);
+        }
+    }
+}
+
+// With variable order, the integration starts with the first order BDF, for
+// which no error estimate is available in the first time step.
+TEST(NumLib, BackwardDifferentiationFormulaVariableOrder)
+{
+    NumLib::BackwardDifferentiationFormula bdf(3);
+    bdf.enableVariableOrder();
+    NoInternalMatrixStorage const strg;
+
+    GlobalVector x(1);
+    x.set(0, 1.0);
+    bdf.setInitialState(0.0, x);
+
+    std::vector<unsigned> orders;
+    double const dt = 0.01;
+    for (int n = 1; n <= 12; ++n)
+    {
+        double const t = n * dt;
+        bdf.nextTimestep(t, dt);
+        bdf.predictX(x);
+        x.set(0, std::exp(-t));
+        GlobalVector error(1);
+        orders.push_back(bdf.estimateLocalTruncationError(x, error));
+        bdf.pushState(t, x, strg);
+    }
+
+    std::vector<unsigned> const expected_orders = {0, 1, 2, 2, 2, 3,
+                                                   3, 3, 3, 3, 3, 3};
+    EXPECT_EQ(expected_orders, orders);
+}
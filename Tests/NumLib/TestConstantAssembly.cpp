@@ -0,0 +1,180 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "NumLib/IndexValueVector.h"
+#include "NumLib/NumericsConfig.h"
+#include "NumLib/ODESolver/ConvergenceCriterionDeltaX.h"
+#include "NumLib/ODESolver/NonlinearSolver.h"
+#include "NumLib/ODESolver/ODESystem.h"
+#include "NumLib/ODESolver/TimeDiscretizedODESystem.h"
+#include "ProcessLib/StaggeredCouplingTerm.h"
+
+namespace
+{
+/// Linear ODE M x' + K x = b with constant M, K and b, which counts its
+/// assemblies.
+class ConstantODE final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Picard>
+{
+public:
+    explicit ConstantODE(bool const assembly_constant)
+        : _assembly_constant(assembly_constant)
+    {
+    }
+
+    void assemble(const double /*t*/, GlobalVector const& /*x*/,
+                  GlobalMatrix& M, GlobalMatrix& K, GlobalVector& b,
+                  ProcessLib::StaggeredCouplingTerm const& /*coupling_term*/
+                  ) override
+    {
+        ++number_of_assemblies;
+        MathLib::setMatrix(M, {1.0, 0.0, 0.0,
+                               0.0, 1.0, 0.0,
+                               0.0, 0.0, 1.0});
+        MathLib::setMatrix(K, { 2.0, -1.0,  0.0,
+                               -1.0,  2.0, -1.0,
+                                0.0, -1.0,  2.0});
+        MathLib::setVector(b, {1.0, 2.0, 3.0});
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications() const override
+    {
+        return {N, N, nullptr, nullptr};
+    }
+
+    bool isLinear() const override { return true; }
+
+    bool isAssemblyConstant() const override { return _assembly_constant; }
+
+    std::vector<NumLib::IndexValueVector<GlobalIndexType>> const*
+    getKnownSolutions(double const /*t*/) const override
+    {
+        return &known_solutions;
+    }
+
+    std::size_t const N = 3;
+    std::size_t number_of_assemblies = 0;
+    std::vector<NumLib::IndexValueVector<GlobalIndexType>> known_solutions;
+
+private:
+    bool const _assembly_constant;
+};
+
+/// Integrates a ConstantODE with backward Euler for the given time step sizes
+/// and Dirichlet boundary conditions.
+class ConstantODERun
+{
+public:
+    explicit ConstantODERun(bool const assembly_constant)
+        : ode(assembly_constant),
+          ode_sys(ode, time_disc),
+          linear_solver("", nullptr),
+          nonlinear_solver(linear_solver, 1),
+          convergence_criterion(1e-9, boost::none,
+                                MathLib::VecNormType::NORM2),
+          x(ode.N)
+    {
+        nonlinear_solver.setEquationSystem(ode_sys, convergence_criterion);
+        MathLib::setVector(x, {0.0, 0.0, 0.0});
+        time_disc.setInitialState(0.0, x);
+    }
+
+    void setDirichletBC(GlobalIndexType const id, double const value)
+    {
+        ode.known_solutions.clear();
+        ode.known_solutions.push_back({{id}, {value}});
+    }
+
+    void step(double const dt)
+    {
+        _t += dt;
+        time_disc.nextTimestep(_t, dt);
+        ASSERT_TRUE(nonlinear_solver.solve(
+            x, ProcessLib::createVoidStaggeredCouplingTerm(), nullptr));
+        time_disc.pushState(_t, x, ode_sys);
+    }
+
+    ConstantODE ode;
+    NumLib::BackwardEuler time_disc;
+    NumLib::TimeDiscretizedODESystem<
+        NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+        NumLib::NonlinearSolverTag::Picard>
+        ode_sys;
+    GlobalLinearSolver linear_solver;
+    NumLib::NonlinearSolver<NumLib::NonlinearSolverTag::Picard>
+        nonlinear_solver;
+    NumLib::ConvergenceCriterionDeltaX convergence_criterion;
+    GlobalVector x;
+
+private:
+    double _t = 0.0;
+};
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(NumLibODESolver, ConstantAssemblyReusesLinearSystem)
+#else
+TEST(NumLibODESolver, DISABLED_ConstantAssemblyReusesLinearSystem)
+#endif
+{
+    ConstantODERun run(true);
+    ConstantODERun reference(false);
+
+    // Each entry is a time step size, a Dirichlet node, its value, and
+    // whether the factorization of the previous step can be reused.
+    struct Step
+    {
+        double dt;
+        GlobalIndexType dirichlet_id;
+        double dirichlet_value;
+        bool reuse;
+    };
+    std::vector<Step> const steps{
+        {0.1, 0, 1.0, false},  // first step
+        {0.1, 0, 1.0, true},
+        {0.2, 0, 1.0, false},  // dt changed
+        {0.2, 0, 1.0, true},
+        {0.2, 2, 1.0, false},  // Dirichlet ids changed
+        {0.2, 2, 5.0, true},   // only the Dirichlet value changed
+    };
+
+    std::size_t number_of_setups = 0;
+    for (auto const& step : steps)
+    {
+        for (auto* r : {&run, &reference})
+        {
+            r->setDirichletBC(step.dirichlet_id, step.dirichlet_value);
+            r->step(step.dt);
+        }
+        if (!step.reuse)
+            ++number_of_setups;
+
+        EXPECT_EQ(1u, run.ode.number_of_assemblies);
+        EXPECT_EQ(step.reuse, run.ode_sys.isLinearSystemMatrixUnchanged());
+        EXPECT_EQ(number_of_setups, run.linear_solver.getNumberOfSetups());
+
+        MathLib::LinAlg::setLocalAccessibleVector(run.x);
+        MathLib::LinAlg::setLocalAccessibleVector(reference.x);
+        for (std::size_t i = 0; i < run.ode.N; ++i)
+            EXPECT_NEAR(reference.x[i], run.x[i], 1e-12);
+    }
+
+    // Without constant assembly everything is recomputed in each step.
+    EXPECT_EQ(steps.size(), reference.ode.number_of_assemblies);
+    EXPECT_EQ(steps.size(), reference.linear_solver.getNumberOfSetups());
+}
@@ -0,0 +1,119 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <cstdlib>
+#include <memory>
+#include <numeric>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubsets.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/DOFReordering.h"
+#include "NumLib/DOF/MeshComponentMap.h"
+
+namespace
+{
+bool isPermutation(std::vector<std::size_t> ordering, std::size_t const n)
+{
+    std::vector<std::size_t> expected(n);
+    std::iota(expected.begin(), expected.end(), 0);
+    std::sort(ordering.begin(), ordering.end());
+    return ordering == expected;
+}
+
+/// Maximal distance of the numbers of two connected nodes.
+std::size_t computeBandwidth(MeshLib::Mesh const& mesh,
+                             std::vector<std::size_t> const& ordering)
+{
+    std::vector<std::size_t> ranks(ordering.size());
+    for (std::size_t k = 0; k < ordering.size(); ++k)
+        ranks[ordering[k]] = k;
+
+    std::size_t bandwidth = 0;
+    for (auto const* node : mesh.getNodes())
+        for (auto const* n : node->getConnectedNodes())
+            bandwidth = std::max(
+                bandwidth,
+                static_cast<std::size_t>(std::abs(
+                    static_cast<long>(ranks[node->getID()]) -
+                    static_cast<long>(ranks[n->getID()]))));
+    return bandwidth;
+}
+}  // namespace
+
+class NumLibDOFReordering : public ::testing::Test
+{
+public:
+    NumLibDOFReordering()
+        : mesh(MeshLib::MeshGenerator::generateRegularQuadMesh(
+              30.0, 3.0, 30, 3))
+    {
+    }
+
+    std::unique_ptr<MeshLib::Mesh> const mesh;
+};
+
+TEST_F(NumLibDOFReordering, OrderingsArePermutations)
+{
+    std::size_t const n_nodes = mesh->getNumberOfNodes();
+    EXPECT_TRUE(NumLib::computeNodeOrdering(
+                    *mesh, NumLib::DOFReordering::None).empty());
+    EXPECT_TRUE(isPermutation(
+        NumLib::computeNodeOrdering(
+            *mesh, NumLib::DOFReordering::ReverseCuthillMcKee),
+        n_nodes));
+    EXPECT_TRUE(isPermutation(
+        NumLib::computeNodeOrdering(*mesh,
+                                    NumLib::DOFReordering::SpaceFillingCurve),
+        n_nodes));
+}
+
+TEST_F(NumLibDOFReordering, ReverseCuthillMcKeeReducesBandwidth)
+{
+    // The generated mesh is numbered along the long side.
+    std::vector<std::size_t> identity(mesh->getNumberOfNodes());
+    std::iota(identity.begin(), identity.end(), 0);
+    ASSERT_EQ(32u, computeBandwidth(*mesh, identity));
+
+    auto const ordering = NumLib::computeReverseCuthillMcKeeOrdering(*mesh);
+    // At most two levels of four nodes each along the short side.
+    EXPECT_GE(8u, computeBandwidth(*mesh, ordering));
+}
+
+#ifndef USE_PETSC
+TEST_F(NumLibDOFReordering, MeshComponentMapFollowsNodeOrdering)
+#else
+TEST_F(NumLibDOFReordering, DISABLED_MeshComponentMapFollowsNodeOrdering)
+#endif
+{
+    MeshLib::MeshSubset const all_nodes(*mesh, &mesh->getNodes());
+    std::vector<MeshLib::MeshSubsets> components;
+    components.emplace_back(&all_nodes);
+    components.emplace_back(&all_nodes);
+
+    auto const ordering = NumLib::computeReverseCuthillMcKeeOrdering(*mesh);
+    NumLib::MeshComponentMap const cmap(
+        components, NumLib::ComponentOrder::BY_LOCATION, ordering);
+
+    ASSERT_EQ(2 * mesh->getNumberOfNodes(), cmap.dofSizeWithGhosts());
+    for (std::size_t k = 0; k < ordering.size(); ++k)
+    {
+        MeshLib::Location const l(mesh->getID(), MeshLib::MeshItemType::Node,
+                                  ordering[k]);
+        EXPECT_EQ(static_cast<GlobalIndexType>(2 * k),
+                  cmap.getGlobalIndex(l, 0));
+        EXPECT_EQ(static_cast<GlobalIndexType>(2 * k + 1),
+                  cmap.getGlobalIndex(l, 1));
+    }
+}
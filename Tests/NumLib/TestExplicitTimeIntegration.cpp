@@ -0,0 +1,136 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/UnifiedMatrixSetters.h"
+#include "NumLib/ODESolver/ExplicitTimeIntegration.h"
+#include "ProcessLib/StaggeredCouplingTerm.h"
+
+namespace
+{
+//! The decoupled system x_i' = -lambda_i x_i, optionally with x_1 fixed.
+class DecayODE final
+    : public NumLib::ODESystem<
+          NumLib::ODESystemTag::FirstOrderImplicitQuasilinear,
+          NumLib::NonlinearSolverTag::Picard>
+{
+public:
+    DecayODE(double const lambda_0, double const lambda_1,
+             bool const fix_x_1)
+        : _lambda_0(lambda_0), _lambda_1(lambda_1)
+    {
+        if (fix_x_1)
+            _known_solutions.push_back({{1}, {2.0}});
+    }
+
+    void assemble(const double /*t*/, GlobalVector const& /*x*/,
+                  GlobalMatrix& /*M*/, GlobalMatrix& /*K*/,
+                  GlobalVector& /*b*/,
+                  ProcessLib::StaggeredCouplingTerm const& /*coupling_term*/
+                  ) override
+    {
+        FAIL() << "Only the lumped assembly is used.";
+    }
+
+    double assembleLumped(
+        const double /*t*/, GlobalVector const& x, GlobalVector& M_lumped,
+        GlobalVector& r,
+        ProcessLib::StaggeredCouplingTerm const& /*coupling_term*/) override
+    {
+        ++number_of_assemblies;
+        MathLib::LinAlg::setLocalAccessibleVector(x);
+        MathLib::setVector(M_lumped, {1.0, 1.0});
+        MathLib::setVector(r, {-_lambda_0 * x[0], -_lambda_1 * x[1]});
+        return 2.0 / std::max(_lambda_0, _lambda_1);
+    }
+
+    MathLib::MatrixSpecifications getMatrixSpecifications() const override
+    {
+        return {2, 2, nullptr, nullptr};
+    }
+
+    std::vector<NumLib::IndexValueVector<Index>> const* getKnownSolutions(
+        double const /*t*/) const override
+    {
+        return _known_solutions.empty() ? nullptr : &_known_solutions;
+    }
+
+    bool isLinear() const override { return true; }
+
+    unsigned number_of_assemblies = 0;
+
+private:
+    double const _lambda_0;
+    double const _lambda_1;
+    std::vector<NumLib::IndexValueVector<Index>> _known_solutions;
+};
+}  // namespace
+
+TEST(NumLibExplicitTimeIntegration, SingleStep)
+{
+    DecayODE ode(1.0, 2.0, false);
+    ProcessLib::StaggeredCouplingTerm coupling_term =
+        ProcessLib::createVoidStaggeredCouplingTerm();
+
+    GlobalVector x(2);
+    MathLib::setVector(x, {1.0, 1.0});
+
+    auto const n = NumLib::integrateExplicitlyWithLumpedMass(
+        ode, 0.0, 0.1, x, coupling_term);
+
+    EXPECT_EQ(1u, n);
+    EXPECT_EQ(1u, ode.number_of_assemblies);
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    EXPECT_NEAR(0.9, x[0], 1e-14);
+    EXPECT_NEAR(0.8, x[1], 1e-14);
+}
+
+TEST(NumLibExplicitTimeIntegration, Substepping)
+{
+    // The stable time step size is 2/20, hence 0.09 with the default safety
+    // factor; the time step of 1 is split into 12 equal substeps.
+    DecayODE ode(20.0, 1.0, false);
+    ProcessLib::StaggeredCouplingTerm coupling_term =
+        ProcessLib::createVoidStaggeredCouplingTerm();
+
+    GlobalVector x(2);
+    MathLib::setVector(x, {1.0, 1.0});
+
+    auto const n = NumLib::integrateExplicitlyWithLumpedMass(
+        ode, 0.0, 1.0, x, coupling_term);
+
+    EXPECT_EQ(12u, n);
+    EXPECT_EQ(12u, ode.number_of_assemblies);
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    double const h = 1.0 / 12;
+    EXPECT_NEAR(std::pow(1 - 20 * h, 12), x[0], 1e-14);
+    EXPECT_NEAR(std::pow(1 - h, 12), x[1], 1e-14);
+}
+
+TEST(NumLibExplicitTimeIntegration, KnownSolutions)
+{
+    DecayODE ode(1.0, 1.0, true);
+    ProcessLib::StaggeredCouplingTerm coupling_term =
+        ProcessLib::createVoidStaggeredCouplingTerm();
+
+    GlobalVector x(2);
+    MathLib::setVector(x, {1.0, 1.0});
+
+    NumLib::integrateExplicitlyWithLumpedMass(ode, 0.0, 0.5, x,
+                                              coupling_term);
+
+    MathLib::LinAlg::setLocalAccessibleVector(x);
+    EXPECT_NEAR(0.5, x[0], 1e-14);
+    EXPECT_EQ(2.0, x[1]);
+}
@@ -0,0 +1,98 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+
+#include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
+#include "NumLib/Fem/Integration/GaussIntegrationPolicy.h"
+#include "NumLib/Fem/ReferenceElementShapeData.h"
+#include "NumLib/Fem/ShapeFunction/ShapeHex8.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+
+#include "ProcessLib/Utils/InitShapeMatrices.h"
+
+#include "Tests/TestTools.h"
+
+namespace
+{
+using ShapeFunction = NumLib::ShapeHex8;
+unsigned const GlobalDim = 3;
+using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+using IntegrationMethod = NumLib::GaussIntegrationPolicy<
+    ShapeFunction::MeshElement>::IntegrationMethod;
+using ReferenceShapeData =
+    NumLib::ReferenceElementShapeData<ShapeFunction, ShapeMatricesType,
+                                      IntegrationMethod>;
+}  // namespace
+
+TEST(NumLib, ReferenceElementShapeDataIsShared)
+{
+    IntegrationMethod const integration_method_a(2);
+    IntegrationMethod const integration_method_b(2);
+    IntegrationMethod const integration_method_c(3);
+
+    auto const& data_a = ReferenceShapeData::get(integration_method_a);
+    auto const& data_b = ReferenceShapeData::get(integration_method_b);
+    auto const& data_c = ReferenceShapeData::get(integration_method_c);
+
+    EXPECT_EQ(&data_a, &data_b);
+    EXPECT_NE(&data_a, &data_c);
+    EXPECT_EQ(integration_method_a.getNumberOfPoints(),
+              data_a.getNumberOfPoints());
+    EXPECT_EQ(integration_method_c.getNumberOfPoints(),
+              data_c.getNumberOfPoints());
+}
+
+TEST(NumLib, ReferenceElementShapeDataMatchesIsoparametricMapping)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularHexMesh(1.0, 1.5, 0.5, 2, 3, 1));
+
+    IntegrationMethod const integration_method(3);
+    using FemType =
+        NumLib::TemplateIsoparametric<ShapeFunction, ShapeMatricesType>;
+
+    double const eps = std::numeric_limits<double>::epsilon();
+
+    for (auto const* e : mesh->getElements())
+    {
+        auto const shape_matrices =
+            ProcessLib::initShapeMatrices<ShapeFunction, ShapeMatricesType,
+                                          IntegrationMethod, GlobalDim>(
+                *e, false, integration_method);
+        ASSERT_EQ(integration_method.getNumberOfPoints(),
+                  shape_matrices.size());
+
+        FemType fe(*static_cast<ShapeFunction::MeshElement const*>(e));
+        for (unsigned ip = 0; ip < shape_matrices.size(); ++ip)
+        {
+            typename ShapeMatricesType::ShapeMatrices expected(
+                ShapeFunction::DIM, GlobalDim, ShapeFunction::NPOINTS);
+            fe.computeShapeFunctions(
+                integration_method.getWeightedPoint(ip).getCoords(), expected,
+                GlobalDim, false);
+
+            auto const& sm = shape_matrices[ip];
+            ASSERT_ARRAY_NEAR(expected.N.data(), sm.N.data(), sm.N.size(),
+                              eps);
+            ASSERT_ARRAY_NEAR(expected.dNdr.data(), sm.dNdr.data(),
+                              sm.dNdr.size(), eps);
+            ASSERT_ARRAY_NEAR(expected.dNdx.data(), sm.dNdx.data(),
+                              sm.dNdx.size(), eps);
+            ASSERT_NEAR(expected.detJ, sm.detJ, eps);
+            ASSERT_NEAR(expected.integralMeasure, sm.integralMeasure, eps);
+        }
+    }
+}
@@ -0,0 +1,125 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "NumLib/TimeStepping/Algorithms/ErrorControlledTimeStepping.h"
+#include "NumLib/TimeStepping/TimeStep.h"
+
+TEST(NumLib, TimeSteppingErrorControlled)
+{
+    NumLib::ErrorControlledTimeStepping alg(0, 10, 0.1, 4, 1, 1e-3, 0,
+                                            MathLib::VecNormType::NORM2);
+
+    // no estimate yet, start with the initial time step size
+    ASSERT_TRUE(alg.next());
+    NumLib::TimeStep ts = alg.getTimeStep();
+    ASSERT_EQ(1u, ts.steps());
+    ASSERT_EQ(1., ts.current());
+    ASSERT_EQ(1., ts.dt());
+    ASSERT_TRUE(alg.accepted());
+
+    // no estimate, keep the time step size
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_EQ(2u, ts.steps());
+    ASSERT_EQ(2., ts.current());
+
+    // scaled error 1/4 at order 1: dt *= 0.9 * 4^(1/2)
+    alg.addErrorEstimate(0.25e-3, 1, 1);
+    ASSERT_TRUE(alg.accepted());
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_EQ(3u, ts.steps());
+    ASSERT_NEAR(1.8, ts.dt(), 1e-14);
+    ASSERT_NEAR(3.8, ts.current(), 1e-14);
+
+    // the largest error of several processes counts; scaled error 4 at
+    // order 3: the step is repeated with dt *= 0.9 * 4^(-1/4)
+    alg.addErrorEstimate(4e-3, 1, 3);
+    alg.addErrorEstimate(1e-4, 1, 1);
+    ASSERT_FALSE(alg.accepted());
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_EQ(3u, ts.steps());
+    ASSERT_EQ(2., ts.previous());
+    ASSERT_NEAR(1.8 * 0.9 * std::pow(4., -0.25), ts.dt(), 1e-14);
+    ASSERT_EQ(1u, alg.getNumberOfRepeatedSteps());
+
+    // a vanishing error increases the step size by the maximum factor,
+    // bounded by the maximum step size
+    alg.addErrorEstimate(0, 1, 1);
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_EQ(4u, ts.steps());
+    ASSERT_EQ(4., ts.dt());
+
+    // a large error reduces the step size by the minimum factor, and steps of
+    // the minimum size are accepted
+    for (int i = 0; i < 4; ++i)
+    {
+        alg.addErrorEstimate(1, 1, 1);
+        ASSERT_TRUE(alg.next());
+    }
+    ts = alg.getTimeStep();
+    ASSERT_NEAR(0.1, ts.dt(), 1e-14);
+    alg.addErrorEstimate(1, 1, 1);
+    ASSERT_TRUE(alg.accepted());
+
+    // the last step ends at t_end
+    double t = ts.current();
+    while (alg.next())
+    {
+        ts = alg.getTimeStep();
+        ASSERT_LT(t, ts.current());
+        t = ts.current();
+    }
+    ASSERT_EQ(10., t);
+    ASSERT_EQ(4u, alg.getNumberOfRepeatedSteps());
+}
+
+TEST(NumLib, TimeSteppingErrorControlledNonlinearSolverFailure)
+{
+    NumLib::ErrorControlledTimeStepping alg(0, 10, 0.1, 4, 1, 1e-3, 0,
+                                            MathLib::VecNormType::NORM2);
+
+    ASSERT_TRUE(alg.next());
+    alg.addErrorEstimate(0.25e-3, 1, 1);
+    ASSERT_TRUE(alg.next());
+    NumLib::TimeStep ts = alg.getTimeStep();
+    ASSERT_EQ(2u, ts.steps());
+    ASSERT_NEAR(1.8, ts.dt(), 1e-14);
+
+    // A failed nonlinear solution rejects the step regardless of its error
+    // estimate, and the step is repeated with dt reduced by the minimum
+    // factor.
+    alg.addErrorEstimate(0, 1, 1);
+    ASSERT_TRUE(alg.rejectNonlinearSolverFailure());
+    ASSERT_FALSE(alg.accepted());
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_EQ(2u, ts.steps());
+    ASSERT_EQ(1., ts.previous());
+    ASSERT_NEAR(1.8 * 0.2, ts.dt(), 1e-14);
+    ASSERT_EQ(1u, alg.getNumberOfRepeatedSteps());
+
+    // The repeated step is accepted without further information.
+    ASSERT_TRUE(alg.accepted());
+
+    // Steps of the minimum size cannot be reduced any further.
+    ASSERT_TRUE(alg.rejectNonlinearSolverFailure());
+    ASSERT_TRUE(alg.next());
+    ts = alg.getTimeStep();
+    ASSERT_NEAR(0.1, ts.dt(), 1e-14);
+    ASSERT_FALSE(alg.rejectNonlinearSolverFailure());
+    ASSERT_TRUE(alg.accepted());
+    ASSERT_EQ(2u, alg.getNumberOfRepeatedSteps());
+}
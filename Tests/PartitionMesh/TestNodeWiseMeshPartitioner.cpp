@@ -0,0 +1,150 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <algorithm>
+#include <array>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "Applications/Utils/ModelPreparation/PartitionMesh/NodeWiseMeshPartitioner.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+
+namespace
+{
+/// Cell (i, j) of a regular quad mesh with unit cell size.
+std::array<int, 2> cell(MeshLib::Element const& element)
+{
+    auto const centre = element.getCenterOfGravity();
+    return {{static_cast<int>(centre[0]), static_cast<int>(centre[1])}};
+}
+
+std::vector<std::array<int, 2>> cells(
+    std::vector<const MeshLib::Element*> const& elements)
+{
+    std::vector<std::array<int, 2>> cells;
+    for (auto const* element : elements)
+        cells.push_back(cell(*element));
+    std::sort(cells.begin(), cells.end());
+    return cells;
+}
+}  // namespace
+
+// 3 x 2 quads, where the nodes with x <= 1 belong to partition 0, and the
+// nodes with x >= 2 belong to partition 1 if y = 0 and to partition 2
+// otherwise. The element of cell (1, 0) has nodes in all three partitions.
+TEST(ApplicationUtilsNodeWiseMeshPartitioner, RegularAndGhostElements)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(3u, 2u, 1.0));
+
+    std::string const file_name_base =
+        BaseLib::BuildInfo::tests_tmp_path + "NodeWiseMeshPartitioner";
+    {
+        std::ofstream os(file_name_base + ".mesh.npart.3");
+        for (auto const* node : mesh->getNodes())
+            os << ((*node)[0] < 1.5 ? 0 : ((*node)[1] < 0.5 ? 1 : 2)) << "\n";
+    }
+
+    ApplicationUtils::NodeWiseMeshPartitioner partitioner(3, std::move(mesh));
+    partitioner.readMetisData(file_name_base);
+    partitioner.partitionByMETIS(false);
+
+    auto const& partitions = partitioner.getPartitions();
+    ASSERT_EQ(3u, partitions.size());
+
+    using Cells = std::vector<std::array<int, 2>>;
+    EXPECT_EQ((Cells{{{0, 0}}, {{0, 1}}}),
+              cells(partitions[0].regular_elements));
+    EXPECT_EQ((Cells{{{1, 0}}, {{1, 1}}}), cells(partitions[0].ghost_elements));
+
+    EXPECT_TRUE(partitions[1].regular_elements.empty());
+    EXPECT_EQ((Cells{{{1, 0}}, {{2, 0}}}), cells(partitions[1].ghost_elements));
+
+    EXPECT_EQ((Cells{{{2, 1}}}), cells(partitions[2].regular_elements));
+    EXPECT_EQ((Cells{{{1, 0}}, {{1, 1}}, {{2, 0}}}),
+              cells(partitions[2].ghost_elements));
+
+    // The ghost nodes are the nodes of other partitions in ghost elements.
+    std::array<std::size_t, 3> const non_ghost_nodes{{6, 2, 4}};
+    std::array<std::size_t, 3> const ghost_nodes{{3, 4, 5}};
+    for (std::size_t p = 0; p < partitions.size(); ++p)
+    {
+        EXPECT_EQ(non_ghost_nodes[p],
+                  partitions[p].number_of_non_ghost_base_nodes);
+        EXPECT_EQ(non_ghost_nodes[p], partitions[p].number_of_non_ghost_nodes);
+        EXPECT_EQ(non_ghost_nodes[p] + ghost_nodes[p],
+                  partitions[p].nodes.size());
+    }
+}
+
+// The partitions computed by METIS are written to the binary files, which are
+// read by the NodePartitionedMeshReader.
+TEST(ApplicationUtilsNodeWiseMeshPartitioner, WriteBinaryWithMETIS)
+{
+    ApplicationUtils::NodeWiseMeshPartitioner::IntegerType const
+        n_partitions = 4;
+    ApplicationUtils::NodeWiseMeshPartitioner partitioner(
+        n_partitions,
+        std::unique_ptr<MeshLib::Mesh>(
+            MeshLib::MeshGenerator::generateRegularQuadMesh(8u, 8u, 1.0)));
+    partitioner.computeNodePartitionsWithMETIS({});
+    partitioner.partitionByMETIS(false);
+
+    std::string const file_name_base =
+        BaseLib::BuildInfo::tests_tmp_path + "NodeWiseMeshPartitionerMETIS";
+    partitioner.writeBinary(file_name_base);
+
+    std::ifstream is_parts(file_name_base + "_partitioned_msh_parts.txt");
+    int n_partitions_read = 0;
+    ASSERT_TRUE(static_cast<bool>(is_parts >> n_partitions_read));
+    EXPECT_EQ(n_partitions, n_partitions_read);
+
+    // 14 integers per partition, see writeConfigDataBinary().
+    std::size_t const n_config_data = 14;
+    std::vector<ApplicationUtils::NodeWiseMeshPartitioner::IntegerType>
+        config_data(n_partitions * n_config_data);
+    std::ifstream is_cfg(
+        file_name_base + "_partitioned_msh_cfg4.bin", std::ios::binary);
+    ASSERT_TRUE(static_cast<bool>(is_cfg.read(
+        reinterpret_cast<char*>(config_data.data()),
+        config_data.size() * sizeof(config_data[0]))));
+
+    std::size_t const n_nodes = 81;
+    std::size_t n_non_ghost_nodes = 0;
+    std::size_t n_elements = 0;
+    for (std::size_t p = 0; p < static_cast<std::size_t>(n_partitions); ++p)
+    {
+        std::vector<std::size_t> const data(
+            config_data.begin() + p * n_config_data,
+            config_data.begin() + (p + 1) * n_config_data);
+        auto const& partition = partitioner.getPartitions()[p];
+
+        EXPECT_EQ(partition.nodes.size(), data[0]);
+        EXPECT_EQ(partition.regular_elements.size(), data[2]);
+        EXPECT_EQ(partition.ghost_elements.size(), data[3]);
+        EXPECT_EQ(partition.number_of_non_ghost_nodes, data[5]);
+        EXPECT_EQ(n_nodes, data[7]);
+
+        // METIS assigns nodes to each partition.
+        EXPECT_LT(0u, data[5]);
+        n_non_ghost_nodes += data[5];
+        n_elements += data[2];
+    }
+    EXPECT_EQ(n_nodes, n_non_ghost_nodes);
+    // Elements between partitions are ghost elements only.
+    EXPECT_GT(64u, n_elements);
+}
@@ -0,0 +1,163 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#ifdef USE_PETSC
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <mpi.h>
+
+#include <gtest/gtest.h>
+
+#include "Applications/Utils/ModelPreparation/PartitionMesh/NodeWiseMeshPartitioner.h"
+#include "BaseLib/BuildInfo.h"
+#include "MeshLib/Elements/Element.h"
+#include "MeshLib/IO/MPI_IO/NodePartitionedMeshReader.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "MeshLib/NodePartitionedMesh.h"
+
+// A strip of 4*n x 2 unit squares is partitioned into 2*n partitions of two
+// node columns each, which are read by n processes. Each process merges two
+// neighbouring partitions, i.e. the process of rank r holds the active nodes
+// with 4*r <= x < 4*(r+1).
+TEST(MPITestNodePartitionedMeshReader, ReadBinaryMergingPartitions)
+{
+    int mpi_size;
+    MPI_Comm_size(MPI_COMM_WORLD, &mpi_size);
+    int mpi_rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &mpi_rank);
+
+    unsigned const n_x_cells = 4 * mpi_size;
+    unsigned const n_y_cells = 2;
+    long const n_partitions = 2 * mpi_size;
+    std::unique_ptr<MeshLib::Mesh> const mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(n_x_cells, n_y_cells,
+                                                        1.0));
+
+    std::string const file_name_base =
+        BaseLib::BuildInfo::tests_tmp_path + "MergingPartitions" +
+        std::to_string(mpi_size);
+
+    if (mpi_rank == 0)
+    {
+        {
+            std::ofstream os(file_name_base + ".mesh.npart." +
+                             std::to_string(n_partitions));
+            for (auto const* node : mesh->getNodes())
+                os << std::min(static_cast<long>((*node)[0]) / 2,
+                               n_partitions - 1)
+                   << "\n";
+        }
+
+        ApplicationUtils::NodeWiseMeshPartitioner partitioner(
+            n_partitions,
+            std::unique_ptr<MeshLib::Mesh>(
+                MeshLib::MeshGenerator::generateRegularQuadMesh(
+                    n_x_cells, n_y_cells, 1.0)));
+        partitioner.readMetisData(file_name_base);
+        partitioner.partitionByMETIS(false);
+        partitioner.writeBinary(file_name_base);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    MeshLib::IO::NodePartitionedMeshReader reader(MPI_COMM_WORLD);
+    std::unique_ptr<MeshLib::NodePartitionedMesh> const partitioned_mesh(
+        reader.read(file_name_base));
+    ASSERT_TRUE(partitioned_mesh != nullptr);
+
+    std::size_t const n_nodes = mesh->getNumberOfNodes();
+    ASSERT_EQ(n_nodes, partitioned_mesh->getNumberOfGlobalNodes());
+
+    // Index of a node or an element of the unpartitioned mesh from the
+    // coordinates of a node or the centre of an element.
+    auto const node_index = [&](MeshLib::Node const& node) {
+        return std::lround(node[0]) + (n_x_cells + 1) * std::lround(node[1]);
+    };
+    auto const element_index = [&](MeshLib::Element const& element) {
+        auto const centre = element.getCenterOfGravity();
+        return static_cast<long>(centre[0]) +
+               n_x_cells * static_cast<long>(centre[1]);
+    };
+
+    // Each node is active in exactly one process.
+    std::vector<int> node_counts(n_nodes);
+    std::vector<double> node_coordinates(2 * n_nodes);
+    for (auto const* node : partitioned_mesh->getNodes())
+    {
+        if (partitioned_mesh->isGhostNode(node->getID()))
+            continue;
+        auto const global_id =
+            partitioned_mesh->getGlobalNodeID(node->getID());
+        node_counts[global_id]++;
+        node_coordinates[2 * global_id] = (*node)[0];
+        node_coordinates[2 * global_id + 1] = (*node)[1];
+        EXPECT_EQ(mpi_rank,
+                  std::min(static_cast<int>((*node)[0]) / 4, mpi_size - 1));
+    }
+    MPI_Allreduce(MPI_IN_PLACE, node_counts.data(), n_nodes, MPI_INT, MPI_SUM,
+                  MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, node_coordinates.data(), 2 * n_nodes,
+                  MPI_DOUBLE, MPI_SUM, MPI_COMM_WORLD);
+
+    std::vector<int> original_node_counts(n_nodes);
+    for (std::size_t i = 0; i < n_nodes; ++i)
+    {
+        ASSERT_EQ(1, node_counts[i]);
+        MeshLib::Node const node(node_coordinates[2 * i],
+                                 node_coordinates[2 * i + 1], 0.0);
+        original_node_counts[node_index(node)]++;
+    }
+    for (auto const count : original_node_counts)
+        ASSERT_EQ(1, count);
+
+    // An element is regular in the process holding all of its nodes, and it
+    // is a ghost element in each process holding some of its nodes
+    // otherwise. Elements between the merged partitions are regular, too.
+    std::size_t const n_elements = mesh->getNumberOfElements();
+    std::vector<int> regular_counts(n_elements);
+    std::vector<int> ghost_counts(n_elements);
+    for (auto const* element : partitioned_mesh->getElements())
+    {
+        EXPECT_NEAR(1.0, element->getContent(), 1e-15);
+
+        bool const is_regular =
+            std::none_of(element->getNodes(),
+                         element->getNodes() + element->getNumberOfNodes(),
+                         [&](MeshLib::Node const* node) {
+                             return partitioned_mesh->isGhostNode(
+                                 node->getID());
+                         });
+        (is_regular ? regular_counts
+                    : ghost_counts)[element_index(*element)]++;
+    }
+    MPI_Allreduce(MPI_IN_PLACE, regular_counts.data(), n_elements, MPI_INT,
+                  MPI_SUM, MPI_COMM_WORLD);
+    MPI_Allreduce(MPI_IN_PLACE, ghost_counts.data(), n_elements, MPI_INT,
+                  MPI_SUM, MPI_COMM_WORLD);
+
+    for (auto const* element : mesh->getElements())
+    {
+        auto const e = element_index(*element);
+        auto const column =
+            static_cast<unsigned>(element->getCenterOfGravity()[0]);
+        bool const is_on_process_boundary =
+            column % 4 == 3 && column != n_x_cells - 1;
+        EXPECT_EQ(is_on_process_boundary ? 0 : 1, regular_counts[e]);
+        EXPECT_EQ(is_on_process_boundary ? 2 : 0, ghost_counts[e]);
+    }
+}
+
+#endif
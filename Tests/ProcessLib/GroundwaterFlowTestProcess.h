@@ -0,0 +1,85 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <boost/property_tree/ptree.hpp>
+
+#include "BaseLib/ConfigTree.h"
+#include "GeoLib/GEOObjects.h"
+#include "MeshLib/Mesh.h"
+#include "NumLib/NamedFunctionCaller.h"
+#include "ProcessLib/AnalyticalJacobianAssembler.h"
+#include "ProcessLib/GroundwaterFlow/GroundwaterFlowProcess.h"
+#include "ProcessLib/Parameter/ConstantParameter.h"
+#include "ProcessLib/ProcessVariable.h"
+#include "ProcessLib/SecondaryVariable.h"
+#include "Tests/TestTools.h"
+
+/// Sets up a groundwater flow process with a scalar pressure variable without
+/// boundary conditions, a constant hydraulic conductivity and the darcy
+/// velocity as secondary variable on the given mesh. The number of components
+/// of the variable can be changed for tests, which do not assemble.
+class GroundwaterFlowTestProcess
+{
+public:
+    GroundwaterFlowTestProcess(MeshLib::Mesh& mesh,
+                               double const hydraulic_conductivity,
+                               std::string const& variable_name = "pressure",
+                               int const number_of_components = 1)
+    {
+        _parameters.push_back(
+            std::make_unique<ProcessLib::ConstantParameter<double>>(
+                "K", hydraulic_conductivity));
+        _parameters.push_back(
+            std::make_unique<ProcessLib::ConstantParameter<double>>(
+                "p0", std::vector<double>(number_of_components, 0.0)));
+
+        std::string const xml = "<process_variable><name>" + variable_name +
+                                "</name><components>" +
+                                std::to_string(number_of_components) +
+                                "</components><order>1</order>"
+                                "<initial_condition>p0</initial_condition>"
+                                "</process_variable>";
+        auto const ptree = readXml(xml.c_str());
+        BaseLib::ConfigTree const config(ptree, "",
+                                         BaseLib::ConfigTree::onerror,
+                                         BaseLib::ConfigTree::onwarning);
+        _process_variable = std::make_unique<ProcessLib::ProcessVariable>(
+            config.getConfigSubtree("process_variable"), mesh, _geometries,
+            _parameters);
+
+        ProcessLib::SecondaryVariableCollection secondary_variables;
+        secondary_variables.addNameMapping("darcy_velocity_x",
+                                           "darcy_velocity_x");
+
+        process = std::make_unique<
+            ProcessLib::GroundwaterFlow::GroundwaterFlowProcess>(
+            mesh, std::make_unique<ProcessLib::AnalyticalJacobianAssembler>(),
+            _parameters, 2,
+            std::vector<std::reference_wrapper<ProcessLib::ProcessVariable>>{
+                *_process_variable},
+            ProcessLib::GroundwaterFlow::GroundwaterFlowProcessData{
+                static_cast<ProcessLib::Parameter<double> const&>(
+                    *_parameters[0])},
+            std::move(secondary_variables),
+            NumLib::NamedFunctionCaller{{"GWFlow_pressure"}}, nullptr, "", "");
+    }
+
+    std::unique_ptr<ProcessLib::Process> process;
+
+private:
+    std::vector<std::unique_ptr<ProcessLib::ParameterBase>> _parameters;
+    GeoLib::GEOObjects _geometries;
+    std::unique_ptr<ProcessLib::ProcessVariable> _process_variable;
+};
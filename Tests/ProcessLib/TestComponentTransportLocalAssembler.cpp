@@ -0,0 +1,182 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include <Eigen/Dense>
+
+#include "MaterialLib/Fluid/ConstantFluidProperty.h"
+#include "MaterialLib/Fluid/FluidProperties/PrimaryVariableDependentFluidProperties.h"
+#include "MaterialLib/PorousMedium/Porosity/ConstantPorosity.h"
+#include "MaterialLib/PorousMedium/Storage/ConstantStorage.h"
+#include "MeshLib/Elements/Quad.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "NumLib/Fem/FiniteElement/TemplateIsoparametric.h"
+#include "NumLib/Fem/Integration/GaussIntegrationPolicy.h"
+#include "NumLib/Fem/ShapeFunction/ShapeQuad4.h"
+#include "NumLib/Fem/ShapeMatrixPolicy.h"
+#include "ProcessLib/ComponentTransport/ComponentTransportFEM.h"
+#include "ProcessLib/ComponentTransport/ComponentTransportProcessData.h"
+#include "ProcessLib/Parameter/ConstantParameter.h"
+
+namespace
+{
+std::unique_ptr<MaterialLib::Fluid::FluidProperties> createFluidProperties(
+    double const density, double const viscosity)
+{
+    using MaterialLib::Fluid::ConstantFluidProperty;
+    return std::make_unique<
+        MaterialLib::Fluid::PrimaryVariableDependentFluidProperties>(
+        std::make_unique<ConstantFluidProperty>(density),
+        std::make_unique<ConstantFluidProperty>(viscosity),
+        std::make_unique<ConstantFluidProperty>(1.0),
+        std::make_unique<ConstantFluidProperty>(1.0));
+}
+}  // namespace
+
+// The transport parameters are evaluated per integration point. The test
+// checks the assembled matrices for a constant flow field along the x-axis,
+// for which the hydrodynamic dispersion tensor is diagonal.
+TEST(ProcessLibComponentTransport, LocalAssemblerUsesTransportParameters)
+{
+    using ShapeFunction = NumLib::ShapeQuad4;
+    unsigned const GlobalDim = 2;
+    using IntegrationMethod = NumLib::GaussIntegrationPolicy<
+        ShapeFunction::MeshElement>::IntegrationMethod;
+    using ShapeMatricesType = ShapeMatrixPolicyType<ShapeFunction, GlobalDim>;
+    using LocalAssembler =
+        ProcessLib::ComponentTransport::LocalAssemblerData<
+            ShapeFunction, IntegrationMethod, GlobalDim>;
+
+    double const porosity = 0.4;
+    double const permeability = 2.0;
+    double const viscosity = 1.0;
+    double const storage = 0.01;
+    double const molecular_diffusion = 0.1;
+    double const dispersivity_longitudinal = 0.3;
+    double const dispersivity_transverse = 0.05;
+    double const retardation_factor = 1.5;
+    double const decay_rate = 0.7;
+
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 1.0, 1, 1));
+    auto const& element = *mesh->getElement(0);
+
+    std::vector<std::unique_ptr<MaterialLib::PorousMedium::Porosity>>
+        porosity_models;
+    porosity_models.push_back(
+        std::make_unique<MaterialLib::PorousMedium::ConstantPorosity>(
+            porosity));
+    std::vector<Eigen::MatrixXd> permeability_models{
+        Eigen::MatrixXd::Identity(GlobalDim, GlobalDim) * permeability};
+    std::vector<std::unique_ptr<MaterialLib::PorousMedium::Storage>>
+        storage_models;
+    storage_models.push_back(
+        std::make_unique<MaterialLib::PorousMedium::ConstantStorage>(storage));
+
+    ProcessLib::ConstantParameter<double> const reference_density(
+        "rho_ref", 1000.0);
+    ProcessLib::ConstantParameter<double> const diffusion(
+        "D_m", molecular_diffusion);
+    ProcessLib::ConstantParameter<double> const longitudinal(
+        "alpha_L", dispersivity_longitudinal);
+    ProcessLib::ConstantParameter<double> const transverse(
+        "alpha_T", dispersivity_transverse);
+    ProcessLib::ConstantParameter<double> const retardation(
+        "R", retardation_factor);
+    ProcessLib::ConstantParameter<double> const decay("lambda", decay_rate);
+
+    ProcessLib::ComponentTransport::ComponentTransportProcessData const
+        process_data{
+            ProcessLib::ComponentTransport::PorousMediaProperties{
+                std::move(porosity_models), std::move(permeability_models),
+                std::move(storage_models), std::vector<int>{0}},
+            reference_density,
+            createFluidProperties(1000.0, viscosity),
+            diffusion,
+            longitudinal,
+            transverse,
+            retardation,
+            decay,
+            Eigen::VectorXd::Zero(GlobalDim),
+            false};
+
+    unsigned const integration_order = 2;
+    auto const n = ShapeFunction::NPOINTS;
+    LocalAssembler local_assembler(element, 2 * n, false, integration_order,
+                                   process_data);
+
+    // Concentration is constant, the pressure decreases along the x-axis.
+    std::vector<double> local_x(2 * n);
+    for (unsigned i = 0; i < n; ++i)
+    {
+        local_x[i] = 0.5;
+        local_x[n + i] = -(*element.getNode(i))[0];
+    }
+
+    std::vector<double> local_M_data, local_K_data, local_b_data;
+    local_assembler.assemble(0.0, local_x, local_M_data, local_K_data,
+                             local_b_data);
+    ASSERT_EQ(4u * n * n, local_M_data.size());
+    ASSERT_EQ(4u * n * n, local_K_data.size());
+
+    // The local matrices are stored row-major.
+    using LocalMatrix =
+        Eigen::Matrix<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>;
+    Eigen::Map<LocalMatrix const> const local_M(local_M_data.data(), 2 * n,
+                                                2 * n);
+    Eigen::Map<LocalMatrix const> const local_K(local_K_data.data(), 2 * n,
+                                                2 * n);
+
+    // The Darcy velocity is (k / mu, 0).
+    Eigen::Vector2d const velocity(permeability / viscosity, 0.0);
+    double const v = velocity.norm();
+    Eigen::Matrix2d dispersion = Eigen::Matrix2d::Zero();
+    dispersion(0, 0) =
+        porosity * molecular_diffusion + dispersivity_longitudinal * v;
+    dispersion(1, 1) =
+        porosity * molecular_diffusion + dispersivity_transverse * v;
+
+    Eigen::MatrixXd KCC = Eigen::MatrixXd::Zero(n, n);
+    Eigen::MatrixXd MCC = Eigen::MatrixXd::Zero(n, n);
+    Eigen::MatrixXd Kpp = Eigen::MatrixXd::Zero(n, n);
+    Eigen::MatrixXd Mpp = Eigen::MatrixXd::Zero(n, n);
+
+    IntegrationMethod const integration_method(integration_order);
+    NumLib::TemplateIsoparametric<ShapeFunction, ShapeMatricesType> fe(
+        static_cast<MeshLib::Quad const&>(element));
+    for (unsigned ip = 0; ip < integration_method.getNumberOfPoints(); ++ip)
+    {
+        auto const& wp = integration_method.getWeightedPoint(ip);
+        typename ShapeMatricesType::ShapeMatrices sm(
+            ShapeFunction::DIM, GlobalDim, ShapeFunction::NPOINTS);
+        fe.computeShapeFunctions(wp.getCoords(), sm, GlobalDim, false);
+        double const w = wp.getWeight() * sm.detJ * sm.integralMeasure;
+
+        KCC += (sm.dNdx.transpose() * dispersion * sm.dNdx +
+                sm.N.transpose() * velocity.transpose() * sm.dNdx +
+                sm.N.transpose() * decay_rate * porosity * retardation_factor *
+                    sm.N) *
+               w;
+        MCC += sm.N.transpose() * porosity * retardation_factor * sm.N * w;
+        Kpp += sm.dNdx.transpose() * permeability / viscosity * sm.dNdx * w;
+        Mpp += sm.N.transpose() * storage * sm.N * w;
+    }
+
+    double const eps = 1e-12;
+    EXPECT_LT((local_K.topLeftCorner(n, n) - KCC).norm(), eps);
+    EXPECT_LT((local_M.topLeftCorner(n, n) - MCC).norm(), eps);
+    EXPECT_LT((local_K.bottomRightCorner(n, n) - Kpp).norm(), eps);
+    EXPECT_LT((local_M.bottomRightCorner(n, n) - Mpp).norm(), eps);
+}
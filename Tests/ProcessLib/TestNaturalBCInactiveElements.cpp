@@ -0,0 +1,101 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <array>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixSpecifications.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Elements/Line.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/MeshSubset.h"
+#include "MeshLib/MeshSubsets.h"
+#include "MeshLib/Node.h"
+#include "NumLib/DOF/LocalToGlobalIndexMap.h"
+#include "NumLib/NumericsConfig.h"
+#include "ProcessLib/BoundaryCondition/NeumannBoundaryCondition.h"
+#include "ProcessLib/Parameter/ConstantParameter.h"
+
+#ifndef USE_PETSC
+TEST(ProcessLibBoundaryCondition, NeumannBCStraddlingInactiveElements)
+#else
+TEST(ProcessLibBoundaryCondition,
+     DISABLED_NeumannBCStraddlingInactiveElements)
+#endif
+{
+    // A row of four unit squares. The elements 2 and 3 (2 <= x <= 4) are
+    // inactive, i.e. only the nodes with x <= 2 carry degrees of freedom.
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(4.0, 1.0, 4, 1));
+    auto const& nodes = mesh->getNodes();
+
+    std::vector<MeshLib::Element*> const active_elements(
+        mesh->getElements().begin(), mesh->getElements().begin() + 2);
+    std::vector<MeshLib::Node*> active_nodes;
+    for (auto* const node : nodes)
+        if ((*node)[0] <= 2.0)
+            active_nodes.push_back(node);
+    MeshLib::MeshSubset const active_subset(*mesh, &active_nodes);
+
+    std::vector<MeshLib::MeshSubsets> components;
+    components.emplace_back(&active_subset);
+    std::vector<unsigned> const vec_var_n_components{1};
+    std::vector<std::vector<MeshLib::Element*> const*> const vec_var_elements{
+        &active_elements};
+    NumLib::LocalToGlobalIndexMap const dof_table(
+        std::move(components), vec_var_n_components, vec_var_elements,
+        NumLib::ComponentOrder::BY_LOCATION);
+
+    // The Neumann boundary y = 0 spans the whole mesh. The generator numbers
+    // the bottom nodes first.
+    std::vector<MeshLib::Element*> boundary_elements;
+    for (std::size_t i = 0; i < 4; ++i)
+        boundary_elements.push_back(new MeshLib::Line(
+            std::array<MeshLib::Node*, 2>{{nodes[i], nodes[i + 1]}}));
+
+    ProcessLib::ConstantParameter<double> const flux("flux", 2.0);
+    ProcessLib::NeumannBoundaryCondition bc(
+        false, 2, 1, dof_table, 0, 0, 2, std::move(boundary_elements),
+        static_cast<ProcessLib::Parameter<double> const&>(flux));
+
+    auto const n_dofs = dof_table.dofSizeWithGhosts();
+    ASSERT_EQ(6u, n_dofs);
+    MathLib::MatrixSpecifications const specs{n_dofs, n_dofs, nullptr,
+                                              nullptr};
+    auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(specs);
+    auto b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+
+    bc.applyNaturalBC(0.0, *x, *K, *b);
+    MathLib::LinAlg::finalizeAssembly(*b);
+    MathLib::LinAlg::setLocalAccessibleVector(*b);
+
+    // Only the two active edges contribute. In particular the node at x = 2
+    // gets half of the flux of its active edge and nothing from the inactive
+    // one.
+    std::array<double, 3> const expected{{1.0, 2.0, 1.0}};
+    for (std::size_t i = 0; i < expected.size(); ++i)
+    {
+        MeshLib::Location const l(mesh->getID(), MeshLib::MeshItemType::Node,
+                                  nodes[i]->getID());
+        EXPECT_NEAR(expected[i], (*b)[dof_table.getGlobalIndex(l, 0, 0)],
+                    1e-14);
+    }
+
+    // The nodes on the top boundary do not belong to the Neumann boundary.
+    double sum = 0;
+    for (GlobalIndexType i = 0; i < static_cast<GlobalIndexType>(n_dofs); ++i)
+        sum += (*b)[i];
+    EXPECT_NEAR(4.0, sum, 1e-14);
+}
@@ -11,6 +11,7 @@
 #include <logog/include/logog.hpp>
 
 #include <boost/property_tree/xml_parser.hpp>
+#include <algorithm>
 #include <numeric>
 #include <sstream>
 #include <vector>
@@ -22,7 +23,12 @@
 #include "MeshLib/PropertyVector.h"
 #include "MeshLib/MeshGenerators/MeshGenerator.h"
 
+#include "MathLib/InterpolationAlgorithms/PiecewiseLinearInterpolation.h"
+#include "ProcessLib/Parameter/ConstantParameter.h"
+#include "ProcessLib/Parameter/CurveScaledParameter.h"
 #include "ProcessLib/Parameter/GroupBasedParameter.h"
+#include "ProcessLib/Parameter/MeshElementParameter.h"
+#include "ProcessLib/Parameter/MeshNodeParameter.h"
 
 TEST(ProcessLib_Parameter, GroupBasedParameterElement)
 {
@@ -103,3 +109,91 @@ TEST(ProcessLib_Parameter, GroupBasedParameterNode)
     ASSERT_ANY_THROW((*parameter)(t, x));
 }
 
+
+TEST(ProcessLib_Parameter, MeshElementParameterAtIntegrationPoints)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(3u, 1.0));
+    std::vector<double> values({1, 2, 3, 4, 5, 6});
+    MeshLib::addPropertyToMesh(*mesh, "values", MeshLib::MeshItemType::Cell,
+                               2, values);
+    auto const* const property =
+        mesh->getProperties().getPropertyVector<double>("values");
+
+    ProcessLib::MeshElementParameter<double> const parameter("", *property);
+    ASSERT_EQ(2u, parameter.getNumberOfComponents());
+
+    unsigned const n_integration_points = 3;
+    std::vector<double> ip_values(n_integration_points * 2);
+    double const t = 0;
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+    {
+        parameter.evaluateAtIntegrationPoints(t, e, n_integration_points,
+                                              ip_values.data());
+
+        ProcessLib::SpatialPosition x;
+        x.setElementID(e);
+        for (unsigned ip = 0; ip < n_integration_points; ++ip)
+        {
+            x.setIntegrationPoint(ip);
+            auto const value = parameter(t, x);
+            ASSERT_EQ(2u, value.size());
+            ASSERT_EQ(values[2 * e], value[0]);
+            ASSERT_EQ(values[2 * e + 1], value[1]);
+            ASSERT_EQ(values[2 * e], ip_values[2 * ip]);
+            ASSERT_EQ(values[2 * e + 1], ip_values[2 * ip + 1]);
+        }
+    }
+}
+
+TEST(ProcessLib_Parameter, ConstantParameterManyComponents)
+{
+    // More components than the in-place storage of ParameterValue provides.
+    std::vector<double> values(12);
+    std::iota(values.begin(), values.end(), 1.0);
+    ProcessLib::ConstantParameter<double> const parameter("", values);
+
+    ProcessLib::SpatialPosition x;
+    x.setElementID(0);
+    auto const value = parameter(0, x);
+    ASSERT_EQ(values.size(), value.size());
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), value.begin()));
+
+    std::vector<double> ip_values(2 * values.size());
+    parameter.evaluateAtIntegrationPoints(0, 0, 2, ip_values.data());
+    ASSERT_TRUE(std::equal(values.begin(), values.end(), ip_values.begin()));
+    ASSERT_TRUE(std::equal(values.begin(), values.end(),
+                           ip_values.begin() + values.size()));
+}
+
+TEST(ProcessLib_Parameter, CurveScaledParameterAtNodes)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(4u, 1.0));
+    std::vector<double> values({1, 2, 3, 4, 5});
+    MeshLib::addPropertyToMesh(*mesh, "values", MeshLib::MeshItemType::Node,
+                               1, values);
+
+    std::vector<std::unique_ptr<ProcessLib::ParameterBase>> parameters;
+    parameters.push_back(std::make_unique<ProcessLib::MeshNodeParameter<double>>(
+        "values",
+        *mesh->getProperties().getPropertyVector<double>("values")));
+
+    MathLib::PiecewiseLinearInterpolation const curve({0, 1}, {0, 2});
+    ProcessLib::CurveScaledParameter<double> parameter("scaled", curve,
+                                                       "values");
+    parameter.initialize(parameters);
+
+    std::vector<std::size_t> const node_ids({4, 0, 2});
+    std::vector<double> node_values(node_ids.size());
+    double const t = 0.25;
+    parameter.evaluateAtNodes(t, node_ids, node_values.data());
+
+    ProcessLib::SpatialPosition x;
+    for (std::size_t i = 0; i < node_ids.size(); ++i)
+    {
+        x.setNodeID(node_ids[i]);
+        ASSERT_EQ(parameter(t, x)[0], node_values[i]);
+        ASSERT_EQ(0.5 * values[node_ids[i]], node_values[i]);
+    }
+}
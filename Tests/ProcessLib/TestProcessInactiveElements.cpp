@@ -0,0 +1,99 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cmath>
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/ElementStatus.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "NumLib/NumericsConfig.h"
+#include "ProcessLib/StaggeredCouplingTerm.h"
+
+#include "GroundwaterFlowTestProcess.h"
+
+#ifndef USE_PETSC
+TEST(ProcessLibProcess, InactiveElementsDarcyVelocity)
+#else
+TEST(ProcessLibProcess, DISABLED_InactiveElementsDarcyVelocity)
+#endif
+{
+    // A row of four unit squares. The elements 2 and 3 (2 <= x <= 4) have the
+    // inactive material id 1.
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(4.0, 1.0, 4, 1));
+    MeshLib::addPropertyToMesh(*mesh, "MaterialIDs",
+                               MeshLib::MeshItemType::Cell, 1,
+                               std::vector<int>{0, 0, 1, 1});
+
+    double const hydraulic_conductivity = 3.0;
+    GroundwaterFlowTestProcess gwf(*mesh, hydraulic_conductivity);
+    auto& process = *gwf.process;
+    process.setElementStatus(std::make_unique<MeshLib::ElementStatus>(
+        mesh.get(), std::vector<int>{1}));
+    process.initialize();
+
+    auto const& dof_table = process.getDOFTable();
+    ASSERT_EQ(6u, dof_table.dofSizeWithoutGhosts());
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+        EXPECT_EQ(e < 2 ? 4u : 0u, dof_table.getNumberOfElementDOF(e));
+
+    // The pressure decreases linearly along the x-axis in the active region.
+    auto const specs = process.getMatrixSpecifications();
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    for (auto const* node : mesh->getNodes())
+    {
+        if ((*node)[0] > 2.0)
+            continue;
+        MeshLib::Location const l(mesh->getID(), MeshLib::MeshItemType::Node,
+                                  node->getID());
+        x->set(dof_table.getGlobalIndex(l, 0, 0), -(*node)[0]);
+    }
+
+    auto M = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(specs);
+    auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(specs);
+    auto b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    auto const coupling_term = ProcessLib::createVoidStaggeredCouplingTerm();
+    process.assemble(0.0, *x, *M, *K, *b, coupling_term);
+    process.computeSecondaryVariable(0.0, *x, coupling_term);
+
+    // The extrapolated velocity is the conductivity on all nodes of the
+    // active elements and zero elsewhere.
+    auto secondary_variables = process.getSecondaryVariables();
+    auto const& velocity = secondary_variables.get("darcy_velocity_x");
+    std::unique_ptr<GlobalVector> result_cache;
+    auto const& nodal_values =
+        velocity.fcts.eval_field(*x, dof_table, result_cache);
+    ASSERT_EQ(static_cast<GlobalIndexType>(mesh->getNumberOfNodes()),
+              nodal_values.size());
+    for (auto const* node : mesh->getNodes())
+    {
+        double const expected =
+            (*node)[0] <= 2.0 ? hydraulic_conductivity : 0.0;
+        EXPECT_NEAR(expected, nodal_values[node->getID()], 1e-12)
+            << "at node " << node->getID();
+    }
+
+    std::unique_ptr<GlobalVector> residuals_cache;
+    auto const& residuals =
+        velocity.fcts.eval_residuals(*x, dof_table, residuals_cache);
+    ASSERT_EQ(static_cast<GlobalIndexType>(mesh->getNumberOfElements()),
+              residuals.size());
+    for (std::size_t e = 0; e < mesh->getNumberOfElements(); ++e)
+    {
+        EXPECT_FALSE(std::isnan(residuals[e]));
+        EXPECT_NEAR(0.0, residuals[e], 1e-12);
+    }
+}
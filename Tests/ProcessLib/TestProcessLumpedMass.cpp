@@ -0,0 +1,218 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <vector>
+
+#include <boost/math/constants/constants.hpp>
+#include <boost/property_tree/ptree.hpp>
+#include <gtest/gtest.h>
+
+#include "BaseLib/ConfigTree.h"
+#include "GeoLib/GEOObjects.h"
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "NumLib/NumericsConfig.h"
+#include "NumLib/ODESolver/ExplicitTimeIntegration.h"
+#include "ProcessLib/AnalyticalJacobianAssembler.h"
+#include "ProcessLib/HeatConduction/HeatConductionProcess.h"
+#include "ProcessLib/Parameter/ConstantParameter.h"
+#include "ProcessLib/ProcessVariable.h"
+#include "ProcessLib/StaggeredCouplingTerm.h"
+#include "Tests/TestTools.h"
+
+namespace
+{
+/// Sets up a heat conduction process with constant material properties and
+/// without boundary conditions on the given mesh.
+class HeatConductionTestProcess
+{
+public:
+    HeatConductionTestProcess(MeshLib::Mesh& mesh, double const conductivity,
+                              double const heat_capacity, double const density)
+    {
+        _parameters.push_back(
+            std::make_unique<ProcessLib::ConstantParameter<double>>(
+                "lambda", conductivity));
+        _parameters.push_back(
+            std::make_unique<ProcessLib::ConstantParameter<double>>(
+                "c", heat_capacity));
+        _parameters.push_back(
+            std::make_unique<ProcessLib::ConstantParameter<double>>(
+                "rho", density));
+        _parameters.push_back(
+            std::make_unique<ProcessLib::ConstantParameter<double>>("T0", 0.0));
+
+        auto const ptree = readXml(
+            "<process_variable><name>temperature</name>"
+            "<components>1</components><order>1</order>"
+            "<initial_condition>T0</initial_condition></process_variable>");
+        BaseLib::ConfigTree const config(ptree, "",
+                                         BaseLib::ConfigTree::onerror,
+                                         BaseLib::ConfigTree::onwarning);
+        _process_variable = std::make_unique<ProcessLib::ProcessVariable>(
+            config.getConfigSubtree("process_variable"), mesh, _geometries,
+            _parameters);
+
+        auto const parameter = [this](std::size_t const i)
+            -> ProcessLib::Parameter<double> const& {
+            return static_cast<ProcessLib::Parameter<double> const&>(
+                *_parameters[i]);
+        };
+        process = std::make_unique<
+            ProcessLib::HeatConduction::HeatConductionProcess>(
+            mesh, std::make_unique<ProcessLib::AnalyticalJacobianAssembler>(),
+            _parameters, 2,
+            std::vector<std::reference_wrapper<ProcessLib::ProcessVariable>>{
+                *_process_variable},
+            ProcessLib::HeatConduction::HeatConductionProcessData{
+                parameter(0), parameter(1), parameter(2)},
+            ProcessLib::SecondaryVariableCollection{},
+            NumLib::NamedFunctionCaller{{"HeatConduction_temperature"}});
+    }
+
+    std::unique_ptr<ProcessLib::Process> process;
+
+private:
+    std::vector<std::unique_ptr<ProcessLib::ParameterBase>> _parameters;
+    GeoLib::GEOObjects _geometries;
+    std::unique_ptr<ProcessLib::ProcessVariable> _process_variable;
+};
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(ProcessLibProcess, LumpedMassRowSums)
+#else
+TEST(ProcessLibProcess, DISABLED_LumpedMassRowSums)
+#endif
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 3));
+    HeatConductionTestProcess heat_conduction(*mesh, 2.0, 3.0, 5.0);
+    auto& process = *heat_conduction.process;
+    process.initialize();
+
+    auto const specs = process.getMatrixSpecifications();
+    auto const& dof_table = process.getDOFTable();
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    for (auto const* node : mesh->getNodes())
+    {
+        MeshLib::Location const l(mesh->getID(), MeshLib::MeshItemType::Node,
+                                  node->getID());
+        x->set(dof_table.getGlobalIndex(l, 0, 0),
+               (*node)[0] * (*node)[0] - (*node)[1]);
+    }
+
+    // Consistent mass matrix, its row sums and the residual b - K x.
+    auto M = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(specs);
+    auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(specs);
+    auto b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    MathLib::LinAlg::set(*b, 0.0);
+    auto const coupling_term = ProcessLib::createVoidStaggeredCouplingTerm();
+    process.assemble(0.0, *x, *M, *K, *b, coupling_term);
+    MathLib::LinAlg::finalizeAssembly(*M);
+    MathLib::LinAlg::finalizeAssembly(*K);
+
+    auto ones = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    MathLib::LinAlg::set(*ones, 1.0);
+    auto row_sums =
+        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    MathLib::LinAlg::matMult(*M, *ones, *row_sums);
+    auto residual =
+        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    MathLib::LinAlg::matMult(*K, *x, *residual);
+    MathLib::LinAlg::aypx(*residual, -1.0, *b);
+
+    auto M_lumped =
+        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    auto r = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    double const stable_time_step =
+        process.assembleLumped(0.0, *x, *M_lumped, *r, coupling_term);
+
+    MathLib::LinAlg::setLocalAccessibleVector(*row_sums);
+    MathLib::LinAlg::setLocalAccessibleVector(*residual);
+    MathLib::LinAlg::setLocalAccessibleVector(*M_lumped);
+    MathLib::LinAlg::setLocalAccessibleVector(*r);
+    ASSERT_EQ(row_sums->size(), M_lumped->size());
+    for (GlobalIndexType i = 0; i < row_sums->size(); ++i)
+    {
+        EXPECT_LT(0.0, (*row_sums)[i]);
+        EXPECT_NEAR((*row_sums)[i], (*M_lumped)[i], 1e-14);
+        EXPECT_NEAR((*residual)[i], (*r)[i], 1e-13);
+    }
+
+    EXPECT_LT(0.0, stable_time_step);
+    EXPECT_GT(std::numeric_limits<double>::infinity(), stable_time_step);
+}
+
+// Decay of the cosine mode of the no-flux diffusion problem on the unit
+// interval, T(x, t) = exp(-kappa pi^2 t) cos(pi x) with the diffusivity kappa
+// = lambda / (rho c).
+#ifndef USE_PETSC
+TEST(ProcessLibProcess, LumpedMassForwardEulerDiffusion)
+#else
+TEST(ProcessLibProcess, DISABLED_LumpedMassForwardEulerDiffusion)
+#endif
+{
+    double const pi = boost::math::constants::pi<double>();
+    double const kappa = 0.5;
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateLineMesh(1.0, 20));
+    HeatConductionTestProcess heat_conduction(*mesh, 2 * kappa, 1.0, 2.0);
+    auto& process = *heat_conduction.process;
+    process.initialize();
+
+    auto const specs = process.getMatrixSpecifications();
+    auto const& dof_table = process.getDOFTable();
+    auto const global_index = [&](MeshLib::Node const& node) {
+        return dof_table.getGlobalIndex(
+            {mesh->getID(), MeshLib::MeshItemType::Node, node.getID()}, 0, 0);
+    };
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    for (auto const* node : mesh->getNodes())
+        x->set(global_index(*node), std::cos(pi * (*node)[0]));
+
+    // Without fluxes across the boundary, the total heat stored in the lumped
+    // mass is conserved.
+    auto const coupling_term = ProcessLib::createVoidStaggeredCouplingTerm();
+    auto M_lumped =
+        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    auto r = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    auto const heat = [&]() {
+        process.assembleLumped(0.0, *x, *M_lumped, *r, coupling_term);
+        MathLib::LinAlg::setLocalAccessibleVector(*M_lumped);
+        MathLib::LinAlg::setLocalAccessibleVector(*x);
+        double sum = 0;
+        for (GlobalIndexType i = 0; i < x->size(); ++i)
+            sum += (*M_lumped)[i] * (*x)[i];
+        return sum;
+    };
+    double const initial_heat = heat();
+
+    double const t_end = 0.1;
+    auto const number_of_substeps = NumLib::integrateExplicitlyWithLumpedMass(
+        process, 0.0, t_end, *x, coupling_term);
+    // The stable time step size is about h^2 / (2 kappa) = 2.5e-3.
+    EXPECT_LT(40u, number_of_substeps);
+
+    EXPECT_NEAR(initial_heat, heat(), 1e-12);
+    MathLib::LinAlg::setLocalAccessibleVector(*x);
+    double const decay = std::exp(-kappa * pi * pi * t_end);
+    for (auto const* node : mesh->getNodes())
+    {
+        EXPECT_NEAR(decay * std::cos(pi * (*node)[0]),
+                    (*x)[global_index(*node)], 2e-3)
+            << "at x = " << (*node)[0];
+    }
+}
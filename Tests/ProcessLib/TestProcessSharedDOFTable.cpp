@@ -0,0 +1,144 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+#include "MathLib/LinAlg/LinAlg.h"
+#include "MathLib/LinAlg/MatrixVectorTraits.h"
+#include "MeshLib/ElementStatus.h"
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "MeshLib/Node.h"
+#include "NumLib/NumericsConfig.h"
+#include "ProcessLib/StaggeredCouplingTerm.h"
+
+#include "GroundwaterFlowTestProcess.h"
+
+namespace
+{
+/// Assembles the process for a pressure field depending on the coordinates
+/// and returns M*x, K*x and b.
+std::vector<std::unique_ptr<GlobalVector>> assemble(
+    ProcessLib::Process& process, MeshLib::Mesh const& mesh)
+{
+    auto const& dof_table = process.getDOFTable();
+    auto const specs = process.getMatrixSpecifications();
+    auto x = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    for (auto const* node : mesh.getNodes())
+    {
+        MeshLib::Location const l(mesh.getID(), MeshLib::MeshItemType::Node,
+                                  node->getID());
+        x->set(dof_table.getGlobalIndex(l, 0, 0),
+               (*node)[0] * (*node)[0] + 2 * (*node)[1]);
+    }
+
+    auto M = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(specs);
+    auto K = MathLib::MatrixVectorTraits<GlobalMatrix>::newInstance(specs);
+    auto b = MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs);
+    MathLib::LinAlg::set(*b, 0.0);
+    process.assemble(0.0, *x, *M, *K, *b,
+                     ProcessLib::createVoidStaggeredCouplingTerm());
+    MathLib::LinAlg::finalizeAssembly(*M);
+    MathLib::LinAlg::finalizeAssembly(*K);
+
+    std::vector<std::unique_ptr<GlobalVector>> result;
+    result.push_back(
+        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs));
+    MathLib::LinAlg::matMult(*M, *x, *result.back());
+    result.push_back(
+        MathLib::MatrixVectorTraits<GlobalVector>::newInstance(specs));
+    MathLib::LinAlg::matMult(*K, *x, *result.back());
+    result.push_back(std::move(b));
+    return result;
+}
+}  // namespace
+
+#ifndef USE_PETSC
+TEST(ProcessLibProcess, SharedDOFTable)
+#else
+TEST(ProcessLibProcess, DISABLED_SharedDOFTable)
+#endif
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+
+    GroundwaterFlowTestProcess gwf_source(*mesh, 3.0, "pressure");
+    GroundwaterFlowTestProcess gwf_shared(*mesh, 3.0, "pressure_shared");
+    GroundwaterFlowTestProcess gwf_reference(*mesh, 3.0, "pressure_reference");
+    auto& source = *gwf_source.process;
+    auto& shared = *gwf_shared.process;
+    auto& reference = *gwf_reference.process;
+
+    // The DOF table is available after the initialization only.
+    EXPECT_FALSE(shared.canShareDOFTableWith(source));
+    source.initialize();
+    ASSERT_TRUE(shared.canShareDOFTableWith(source));
+    shared.setDOFTableSource(source);
+    shared.initialize();
+    reference.initialize();
+
+    EXPECT_EQ(&source.getDOFTable(), &shared.getDOFTable());
+    EXPECT_EQ(source.getMatrixSpecifications().sparsity_pattern,
+              shared.getMatrixSpecifications().sparsity_pattern);
+    EXPECT_NE(&reference.getDOFTable(), &shared.getDOFTable());
+
+    auto const shared_result = assemble(shared, *mesh);
+    auto const reference_result = assemble(reference, *mesh);
+    EXPECT_LT(0.0, MathLib::LinAlg::normMax(*reference_result[1]));
+    for (std::size_t i = 0; i < reference_result.size(); ++i)
+    {
+        MathLib::LinAlg::axpy(*shared_result[i], -1.0, *reference_result[i]);
+        EXPECT_NEAR(0.0, MathLib::LinAlg::normMax(*shared_result[i]), 1e-15);
+    }
+}
+
+#ifndef USE_PETSC
+TEST(ProcessLibProcess, SharedDOFTableDifferentVariables)
+#else
+TEST(ProcessLibProcess, DISABLED_SharedDOFTableDifferentVariables)
+#endif
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+
+    GroundwaterFlowTestProcess gwf_scalar(*mesh, 3.0, "pressure");
+    GroundwaterFlowTestProcess gwf_vector(*mesh, 3.0, "displacement", 2);
+    gwf_scalar.process->initialize();
+
+    EXPECT_FALSE(
+        gwf_vector.process->canShareDOFTableWith(*gwf_scalar.process));
+}
+
+#ifndef USE_PETSC
+TEST(ProcessLibProcess, SharedDOFTableElementStatus)
+#else
+TEST(ProcessLibProcess, DISABLED_SharedDOFTableElementStatus)
+#endif
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(1.0, 4));
+    MeshLib::addPropertyToMesh(*mesh, "MaterialIDs",
+                               MeshLib::MeshItemType::Cell, 1,
+                               std::vector<int>(16, 0));
+
+    GroundwaterFlowTestProcess gwf_with_status(*mesh, 3.0, "pressure");
+    GroundwaterFlowTestProcess gwf_without_status(*mesh, 3.0, "temperature");
+    auto& with_status = *gwf_with_status.process;
+    auto& without_status = *gwf_without_status.process;
+    with_status.setElementStatus(std::make_unique<MeshLib::ElementStatus>(
+        mesh.get(), std::vector<int>{1}));
+    with_status.initialize();
+    without_status.initialize();
+
+    EXPECT_FALSE(without_status.canShareDOFTableWith(with_status));
+    EXPECT_FALSE(with_status.canShareDOFTableWith(without_status));
+}
@@ -0,0 +1,50 @@
+/**
+ * \copyright
+ * Copyright (c) 2012-2017, OpenGeoSys Community (http://www.opengeosys.org)
+ *            Distributed under a Modified BSD License.
+ *              See accompanying file LICENSE.txt or
+ *              http://www.opengeosys.org/project/license
+ *
+ */
+
+#include <memory>
+#include <typeindex>
+#include <unordered_map>
+
+#include <gtest/gtest.h>
+
+#include "MeshLib/Mesh.h"
+#include "MeshLib/MeshGenerators/MeshGenerator.h"
+#include "NumLib/DOF/DOFReordering.h"
+#include "ProcessLib/StaggeredCouplingTerm.h"
+
+#include "GroundwaterFlowTestProcess.h"
+
+TEST(ProcessLibStaggeredCouplingTerm, CheckDOFReorderingOfCoupledProcesses)
+{
+    std::unique_ptr<MeshLib::Mesh> mesh(
+        MeshLib::MeshGenerator::generateRegularQuadMesh(2.0, 2.0, 2, 2));
+
+    GroundwaterFlowTestProcess gwf(*mesh, 1.0);
+    GroundwaterFlowTestProcess coupled_gwf(*mesh, 1.0, "coupled_pressure");
+    auto& process = *gwf.process;
+    auto& coupled_process = *coupled_gwf.process;
+
+    std::unordered_map<std::type_index, ProcessLib::Process const&> const
+        coupled_processes{{std::type_index(typeid(coupled_process)),
+                           coupled_process}};
+
+    EXPECT_NO_THROW(ProcessLib::checkDOFReorderingOfCoupledProcesses(
+        process, coupled_processes));
+
+    // Reading the coupled solution with differently renumbered indices would
+    // give wrong values.
+    coupled_process.setDOFReordering(
+        NumLib::DOFReordering::ReverseCuthillMcKee);
+    EXPECT_ANY_THROW(ProcessLib::checkDOFReorderingOfCoupledProcesses(
+        process, coupled_processes));
+
+    process.setDOFReordering(NumLib::DOFReordering::ReverseCuthillMcKee);
+    EXPECT_NO_THROW(ProcessLib::checkDOFReorderingOfCoupledProcesses(
+        process, coupled_processes));
+}